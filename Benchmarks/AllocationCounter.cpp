@@ -0,0 +1,103 @@
+/**
+ * @file AllocationCounter.cpp
+ * @brief 전역 operator new/delete 교체 (할당 횟수 측정용)
+ */
+
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> g_allocationCount{ 0 };
+    thread_local uint64_t t_allocationCount = 0;
+
+    void* CountedAlloc(std::size_t size)
+    {
+        g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        t_allocationCount++;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* CountedAlignedAlloc(std::size_t size, std::align_val_t alignment)
+    {
+        g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        t_allocationCount++;
+#ifdef _MSC_VER
+        return _aligned_malloc(size == 0 ? 1 : size, static_cast<std::size_t>(alignment));
+#else
+        const std::size_t align = static_cast<std::size_t>(alignment);
+        return std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+    }
+
+    void AlignedFree(void* ptr)
+    {
+#ifdef _MSC_VER
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+}
+
+namespace DX12GameEngine::Benchmark
+{
+    uint64_t GetAllocationCount()
+    {
+        return g_allocationCount.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetThreadAllocationCount()
+    {
+        return t_allocationCount;
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    if (void* ptr = CountedAlloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (void* ptr = CountedAlignedAlloc(size, alignment))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { AlignedFree(ptr); }
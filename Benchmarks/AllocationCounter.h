@@ -0,0 +1,24 @@
+/**
+ * @file AllocationCounter.h
+ * @brief 힙 할당 횟수 측정
+ *
+ * 벤치마크 실행 파일 전체의 전역 operator new를 교체해 할당 횟수를 셉니다.
+ * 프로세스 전체 횟수와 호출 스레드 횟수를 따로 제공합니다.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace DX12GameEngine::Benchmark
+{
+    /**
+     * @brief 프로세스 전체 누적 할당 횟수
+     */
+    uint64_t GetAllocationCount();
+
+    /**
+     * @brief 호출 스레드의 누적 할당 횟수
+     */
+    uint64_t GetThreadAllocationCount();
+}
@@ -0,0 +1,66 @@
+/**
+ * @file BenchmarkUtils.h
+ * @brief 벤치마크 공용 유틸리티
+ *
+ * 시간 측정과 결과 출력 헬퍼, 카테고리별 벤치마크 진입점 선언을 제공합니다.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace DX12GameEngine::Benchmark
+{
+    /**
+     * @brief 고해상도 경과 시간 측정기
+     */
+    class Stopwatch
+    {
+    public:
+        Stopwatch() : m_start(Clock::now()) {}
+
+        void Restart() { m_start = Clock::now(); }
+
+        double ElapsedMs() const
+        {
+            return std::chrono::duration<double, std::milli>(Clock::now() - m_start).count();
+        }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point m_start;
+    };
+
+    /**
+     * @brief 벤치마크 섹션 제목 출력
+     */
+    inline void PrintHeader(const char* title)
+    {
+        std::printf("\n-------------------------------------------------\n");
+        std::printf(" %s\n", title);
+        std::printf("-------------------------------------------------\n");
+    }
+
+    /**
+     * @brief 처리량 결과 한 줄 출력
+     * @param name 측정 항목 이름
+     * @param operations 수행한 연산 수
+     * @param elapsedMs 경과 시간 (ms)
+     */
+    inline void PrintThroughput(const char* name, uint64_t operations, double elapsedMs)
+    {
+        const double opsPerSec = elapsedMs > 0.0 ? operations * 1000.0 / elapsedMs : 0.0;
+        const double nsPerOp = operations > 0 ? elapsedMs * 1.0e6 / operations : 0.0;
+        std::printf("  %-44s %10.2f ms  %12.0f ops/s  %8.1f ns/op\n", name, elapsedMs, opsPerSec, nsPerOp);
+    }
+
+    // 카테고리별 벤치마크 진입점
+    void RunLoggerBenchmarks();
+    void RunDescriptorBenchmarks();
+    void RunDescriptorContentionBenchmarks();
+    void RunCommandListBenchmarks();
+    void RunQueueSchedulerBenchmarks();
+    void RunRenderCommandStreamBenchmarks();
+}
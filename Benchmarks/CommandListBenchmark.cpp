@@ -0,0 +1,242 @@
+/**
+ * @file CommandListBenchmark.cpp
+ * @brief 커맨드 리스트 병렬 기록 벤치마크
+ *
+ * CommandListManager의 병렬 기록 컨텍스트로 한 프레임의 드로우를 스레드 수만큼 나눠 기록하고,
+ * 1스레드 대비 병렬화 효율((T1 / TN) / N)을 출력합니다. 목표는 90% 이상입니다 (README 참고).
+ * 생산자마다 따로 제출(Execute + Signal)할 때와 CommandQueue 묶음 제출의 CPU 비용도 비교합니다.
+ *
+ * 기록 측정은 유지되는 작업 스레드의 기록 + Close만 재며 GPU에 제출하지 않습니다.
+ * 제출 측정은 빈 CommandList만 제출합니다.
+ * 파이프라인 없이 기록하므로 Debug Layer는 끈 상태로 실행합니다.
+ */
+
+#include "BenchmarkUtils.h"
+#include <Graphics/CommandListManager.h>
+#include <Graphics/CommandQueue.h>
+#include <Graphics/Device.h>
+#include <algorithm>
+#include <barrier>
+#include <thread>
+#include <vector>
+
+namespace DX12GameEngine::Benchmark
+{
+    namespace
+    {
+        constexpr uint32_t kDrawsPerFrame = 200000;
+        constexpr uint32_t kWarmupFrames = 4;
+        constexpr uint32_t kMeasuredFrames = 16;
+        constexpr uint32_t kSubmitListsPerFrame = 32;
+
+        /**
+         * @brief 드로우 하나에 해당하는 명령 기록 (상태 설정 + Draw)
+         */
+        void RecordDraws(ID3D12GraphicsCommandList* commandList, uint32_t first, uint32_t count)
+        {
+            D3D12_VIEWPORT viewport = { 0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f };
+            for (uint32_t draw = first; draw < first + count; draw++)
+            {
+                commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+                commandList->RSSetViewports(1, &viewport);
+                commandList->OMSetStencilRef(draw & 0xFF);
+                commandList->DrawInstanced(3, 1, draw * 3, 0);
+            }
+            commandList->Close();
+        }
+
+        /**
+         * @brief 기록 스레드 하나의 프레임 작업
+         */
+        struct RecordingTask
+        {
+            ID3D12GraphicsCommandList* commandList;
+            uint32_t first;
+            uint32_t count;
+            double elapsedMs;   // 기록 + Close 시간
+        };
+
+        /**
+         * @brief threadCount개 컨텍스트로 프레임을 기록하고 측정 프레임의 평균 시간 반환 (ms)
+         *
+         * 기록 스레드는 시나리오 동안 유지하고 프레임마다 barrier로 동시에 출발시킵니다.
+         * 스레드 생성/join과 컨텍스트 준비는 측정에서 빼고, 가장 늦게 끝난 스레드의
+         * 기록 + Close 시간을 프레임 시간으로 봅니다.
+         */
+        double RunRecordingScenario(CommandListManager& manager, CommandQueue& queue, uint32_t threadCount)
+        {
+            std::vector<ID3D12CommandList*> commandLists;
+            std::vector<RecordingTask> tasks(threadCount);
+            std::barrier frameStart(threadCount + 1);
+            std::barrier frameEnd(threadCount + 1);
+            bool stopping = false;
+
+            std::vector<std::thread> threads;
+            threads.reserve(threadCount);
+            for (uint32_t t = 0; t < threadCount; t++)
+            {
+                threads.emplace_back([&, t]() {
+                    for (;;)
+                    {
+                        frameStart.arrive_and_wait();
+                        if (stopping)
+                        {
+                            return;
+                        }
+
+                        RecordingTask& task = tasks[t];
+                        Stopwatch stopwatch;
+                        RecordDraws(task.commandList, task.first, task.count);
+                        task.elapsedMs = stopwatch.ElapsedMs();
+
+                        frameEnd.arrive_and_wait();
+                    }
+                });
+            }
+
+            double totalMs = 0.0;
+            for (uint32_t frame = 0; frame < kWarmupFrames + kMeasuredFrames; frame++)
+            {
+                manager.BeginFrame(queue.GetFence(), queue.GetFenceEvent());
+                manager.BeginParallelRecording(threadCount);
+
+                const uint32_t drawsPerThread = kDrawsPerFrame / threadCount;
+                for (uint32_t t = 0; t < threadCount; t++)
+                {
+                    RecordingTask& task = tasks[t];
+                    task.commandList = manager.GetRecordingContext(t);
+                    task.first = t * drawsPerThread;
+                    task.count = t + 1 == threadCount ? kDrawsPerFrame - task.first : drawsPerThread;
+                    manager.ReportRecordedCommands(manager.GetRecordingLease(t), task.count);
+                }
+
+                frameStart.arrive_and_wait();
+                frameEnd.arrive_and_wait();
+
+                double elapsedMs = 0.0;
+                for (const RecordingTask& task : tasks)
+                {
+                    elapsedMs = std::max(elapsedMs, task.elapsedMs);
+                }
+
+                // 제출하지 않고 반환 (Allocator는 Fence 완료 후 풀에서 재사용)
+                commandLists.clear();
+                manager.GetParallelCommandLists(commandLists);
+                manager.EndParallelRecording();
+                manager.EndFrame(queue.Signal());
+
+                if (frame >= kWarmupFrames)
+                {
+                    totalMs += elapsedMs;
+                }
+            }
+
+            stopping = true;
+            frameStart.arrive_and_wait();
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            queue.Flush();
+            return totalMs / kMeasuredFrames;
+        }
+
+        /**
+         * @brief 빈 CommandList kSubmitListsPerFrame개를 제출하고 측정 프레임의 평균 제출 시간 반환 (ms)
+         * @param batched true면 Enqueue + FlushSubmissions, false면 리스트마다 ExecuteCommandLists + Signal
+         */
+        double RunSubmissionScenario(CommandListManager& manager, CommandQueue& queue, bool batched)
+        {
+            std::vector<ID3D12CommandList*> commandLists;
+            double totalMs = 0.0;
+
+            for (uint32_t frame = 0; frame < kWarmupFrames + kMeasuredFrames; frame++)
+            {
+                manager.BeginFrame(queue.GetFence(), queue.GetFenceEvent());
+                manager.BeginParallelRecording(kSubmitListsPerFrame);
+                for (uint32_t i = 0; i < kSubmitListsPerFrame; i++)
+                {
+                    manager.GetRecordingContext(i)->Close();
+                }
+                commandLists.clear();
+                manager.GetParallelCommandLists(commandLists);
+
+                Stopwatch stopwatch;
+                if (batched)
+                {
+                    queue.Enqueue(commandLists.data(), static_cast<uint32_t>(commandLists.size()), 0);
+                    queue.FlushSubmissions();
+                }
+                else
+                {
+                    for (ID3D12CommandList* commandList : commandLists)
+                    {
+                        queue.ExecuteCommandLists(&commandList, 1);
+                        queue.Signal();
+                    }
+                }
+                const double elapsedMs = stopwatch.ElapsedMs();
+
+                manager.EndParallelRecording();
+                manager.EndFrame(queue.GetCurrentFenceValue());
+
+                if (frame >= kWarmupFrames)
+                {
+                    totalMs += elapsedMs;
+                }
+            }
+
+            queue.Flush();
+            return totalMs / kMeasuredFrames;
+        }
+    }
+
+    void RunCommandListBenchmarks()
+    {
+        PrintHeader("Parallel command list recording");
+
+        Device device;
+        CommandQueue queue;
+        CommandListManager manager;
+        if (!device.Initialize(false) ||
+            !queue.Initialize(device.GetDevice(), D3D12_COMMAND_LIST_TYPE_DIRECT) ||
+            !manager.Initialize(device.GetDevice(), D3D12_COMMAND_LIST_TYPE_DIRECT))
+        {
+            std::printf("  D3D12 device unavailable, skipped\n");
+            return;
+        }
+
+        const uint32_t maxThreads = std::min(std::max(2u, std::thread::hardware_concurrency()),
+                                             kMaxRecordingContexts);
+        double singleThreadMs = 0.0;
+        for (uint32_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+        {
+            const double frameMs = RunRecordingScenario(manager, queue, threadCount);
+            if (threadCount == 1)
+            {
+                singleThreadMs = frameMs;
+            }
+
+            char name[128];
+            std::snprintf(name, sizeof(name), "Record %u draws - %2u threads", kDrawsPerFrame, threadCount);
+            PrintThroughput(name, kDrawsPerFrame, frameMs);
+
+            const double efficiency = frameMs > 0.0 ? singleThreadMs / (frameMs * threadCount) * 100.0 : 0.0;
+            std::printf("  %-44s %9.1f %%%s\n", "  parallel efficiency", efficiency,
+                        threadCount > 1 && efficiency < 90.0 ? "  (target > 90%)" : "");
+        }
+
+        char name[128];
+        std::snprintf(name, sizeof(name), "Submit %u lists - per list", kSubmitListsPerFrame);
+        PrintThroughput(name, kSubmitListsPerFrame, RunSubmissionScenario(manager, queue, false));
+
+        queue.ResetSubmissionStats();
+        std::snprintf(name, sizeof(name), "Submit %u lists - batched", kSubmitListsPerFrame);
+        PrintThroughput(name, kSubmitListsPerFrame, RunSubmissionScenario(manager, queue, true));
+
+        const SubmissionStats& stats = queue.GetSubmissionStats();
+        std::printf("  %-44s %9.1f lists/submit, %.3f ms/submit\n", "  batch stats",
+                    stats.GetAverageListsPerSubmit(), stats.GetAverageSubmitMs());
+    }
+}
@@ -0,0 +1,313 @@
+/**
+ * @file DescriptorBenchmark.cpp
+ * @brief 디스크립터 프리 리스트 벤치마크
+ *
+ * 기존 방식(Initialize에서 모든 인덱스를 채운 std::queue)과
+ * 계층 비트맵 프리 리스트(DescriptorFreeList)를 1K / 100K / 1M 디스크립터에서 비교합니다.
+ * 디바이스 없이 인덱스 할당 경로만 측정합니다.
+ *
+ * 경합 벤치마크는 스레드 수를 1부터 늘려 가며, 연산마다 전역 뮤텍스를 잡는 방식과
+ * 스레드별 인덱스 캐시(DescriptorIndexCache, 배치당 한 번 잠금)를 비교합니다.
+ */
+
+#include "BenchmarkUtils.h"
+#include <Graphics/DescriptorFreeList.h>
+#include <Graphics/DescriptorIndexCache.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace DX12GameEngine::Benchmark
+{
+    namespace
+    {
+        constexpr uint32_t kChurnOperations = 1000000;
+        constexpr uint32_t kRangeSize = 16;
+        constexpr uint32_t kContentionCapacity = 1000000;
+        constexpr uint32_t kContentionOpsPerThread = 1000000;
+        constexpr uint32_t kContentionWorkingSet = 64;     // 스레드가 한 번에 들고 있는 디스크립터 수
+
+        /**
+         * @brief 기존 DescriptorHeap의 프리 리스트 (비교 기준)
+         */
+        class QueueFreeList
+        {
+        public:
+            void Initialize(uint32_t capacity)
+            {
+                m_freeIndices = {};
+                for (uint32_t i = 0; i < capacity; i++)
+                {
+                    m_freeIndices.push(i);
+                }
+            }
+
+            uint32_t Allocate()
+            {
+                if (m_freeIndices.empty())
+                {
+                    return DescriptorFreeList::kInvalidIndex;
+                }
+
+                const uint32_t index = m_freeIndices.front();
+                m_freeIndices.pop();
+                return index;
+            }
+
+            void Free(uint32_t index) { m_freeIndices.push(index); }
+
+        private:
+            std::queue<uint32_t> m_freeIndices;
+        };
+
+        /**
+         * @brief 초기화 / 전체 할당 후 무작위 순서 해제 / 절반 찬 상태에서 해제+할당 반복
+         */
+        template<typename FreeList>
+        void RunFreeListScenario(const char* label, uint32_t capacity, const std::vector<uint32_t>& freeOrder,
+                                 const std::vector<uint32_t>& churnSlots)
+        {
+            char name[128];
+            volatile uint32_t sink = 0;
+
+            FreeList freeList;
+            Stopwatch stopwatch;
+            freeList.Initialize(capacity);
+            std::snprintf(name, sizeof(name), "%s - Initialize", label);
+            PrintThroughput(name, capacity, stopwatch.ElapsedMs());
+
+            std::vector<uint32_t> indices(capacity);
+            stopwatch.Restart();
+            for (uint32_t i = 0; i < capacity; i++)
+            {
+                indices[i] = freeList.Allocate();
+            }
+            for (uint32_t i : freeOrder)
+            {
+                freeList.Free(indices[i]);
+            }
+            std::snprintf(name, sizeof(name), "%s - Allocate all + Free shuffled", label);
+            PrintThroughput(name, static_cast<uint64_t>(capacity) * 2, stopwatch.ElapsedMs());
+
+            // 절반을 할당해 둔 상태에서 무작위 슬롯을 해제하고 다시 할당
+            const uint32_t live = capacity / 2;
+            for (uint32_t i = 0; i < live; i++)
+            {
+                indices[i] = freeList.Allocate();
+            }
+
+            stopwatch.Restart();
+            for (uint32_t slot : churnSlots)
+            {
+                freeList.Free(indices[slot]);
+                indices[slot] = freeList.Allocate();
+                sink = sink + indices[slot];
+            }
+            std::snprintf(name, sizeof(name), "%s - Churn (Free + Allocate)", label);
+            PrintThroughput(name, static_cast<uint64_t>(churnSlots.size()) * 2, stopwatch.ElapsedMs());
+        }
+
+        /**
+         * @brief 절반쯤 조각난 상태에서 연속 구간 할당/해제
+         */
+        void RunRangeScenario(uint32_t capacity, std::mt19937& random)
+        {
+            DescriptorFreeList freeList;
+            freeList.Initialize(capacity);
+
+            // 크기가 섞인 구간으로 채운 뒤 절반을 무작위로 해제해 단편화
+            std::vector<std::pair<uint32_t, uint32_t>> ranges;
+            for (;;)
+            {
+                const uint32_t count = 1 + random() % (kRangeSize * 2);
+                const uint32_t first = freeList.AllocateRange(count);
+                if (first == DescriptorFreeList::kInvalidIndex)
+                {
+                    break;
+                }
+                ranges.emplace_back(first, count);
+            }
+
+            std::shuffle(ranges.begin(), ranges.end(), random);
+            const size_t keep = ranges.size() / 2;
+            for (size_t i = keep; i < ranges.size(); i++)
+            {
+                freeList.FreeRange(ranges[i].first, ranges[i].second);
+            }
+            ranges.resize(keep);
+
+            const uint32_t operations = std::min<uint32_t>(kChurnOperations, static_cast<uint32_t>(keep));
+            Stopwatch stopwatch;
+            for (uint32_t i = 0; i < operations; i++)
+            {
+                auto& range = ranges[i];
+                freeList.FreeRange(range.first, range.second);
+                range.first = freeList.AllocateRange(kRangeSize);
+                range.second = kRangeSize;
+                if (range.first == DescriptorFreeList::kInvalidIndex)
+                {
+                    range.first = freeList.AllocateRange(1);
+                    range.second = 1;
+                }
+            }
+            PrintThroughput("Bitmap - FreeRange + AllocateRange(16), ~50% fragmented",
+                            static_cast<uint64_t>(operations) * 2, stopwatch.ElapsedMs());
+        }
+
+        /**
+         * @brief 연산마다 전역 뮤텍스를 잡는 중앙 풀 접근
+         */
+        struct GlobalLockAllocator
+        {
+            DescriptorFreeList& pool;
+            std::mutex& poolMutex;
+
+            uint32_t Allocate()
+            {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                return pool.Allocate();
+            }
+
+            void Free(uint32_t index)
+            {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                pool.Free(index);
+            }
+
+            void Finish() {}
+        };
+
+        /**
+         * @brief 스레드별 캐시를 거치는 중앙 풀 접근
+         */
+        struct ThreadCacheAllocator
+        {
+            DescriptorFreeList& pool;
+            std::mutex& poolMutex;
+            DescriptorIndexCache cache;
+
+            ThreadCacheAllocator(DescriptorFreeList& freeList, std::mutex& mutex)
+                : pool(freeList)
+                , poolMutex(mutex)
+            {
+            }
+
+            uint32_t Allocate() { return cache.Allocate(pool, poolMutex, DescriptorIndexCache::kMaxBatchSize); }
+            void Free(uint32_t index) { cache.Free(index, pool, poolMutex, DescriptorIndexCache::kMaxBatchSize); }
+            void Finish() { cache.Drain(pool, poolMutex); }
+        };
+
+        /**
+         * @brief 스레드마다 작업 집합을 채우고 비우며 할당/해제 반복 (로더 스레드의 리소스 생성/파괴 흉내)
+         * @return 경과 시간 (ms)
+         */
+        template<typename Allocator>
+        double RunContentionScenario(uint32_t threadCount)
+        {
+            DescriptorFreeList pool;
+            pool.Initialize(kContentionCapacity);
+            std::mutex poolMutex;
+
+            std::atomic<uint32_t> readyCount{ 0 };
+            std::atomic<bool> start{ false };
+
+            std::vector<std::thread> threads;
+            threads.reserve(threadCount);
+            for (uint32_t t = 0; t < threadCount; t++)
+            {
+                threads.emplace_back([&]() {
+                    Allocator allocator{ pool, poolMutex };
+                    uint32_t workingSet[kContentionWorkingSet];
+
+                    readyCount.fetch_add(1);
+                    while (!start.load(std::memory_order_acquire))
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    for (uint32_t op = 0; op < kContentionOpsPerThread; op += kContentionWorkingSet * 2)
+                    {
+                        for (uint32_t& index : workingSet)
+                        {
+                            index = allocator.Allocate();
+                        }
+                        for (uint32_t index : workingSet)
+                        {
+                            allocator.Free(index);
+                        }
+                    }
+                    allocator.Finish();
+                });
+            }
+
+            while (readyCount.load() < threadCount)
+            {
+                std::this_thread::yield();
+            }
+
+            Stopwatch stopwatch;
+            start.store(true, std::memory_order_release);
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            return stopwatch.ElapsedMs();
+        }
+    }
+
+    void RunDescriptorBenchmarks()
+    {
+        const uint32_t capacities[] = { 1000, 100000, 1000000 };
+        std::mt19937 random(12345);
+
+        for (uint32_t capacity : capacities)
+        {
+            char title[128];
+            std::snprintf(title, sizeof(title), "Descriptor free list: %u descriptors (queue vs bitmap)", capacity);
+            PrintHeader(title);
+
+            std::vector<uint32_t> freeOrder(capacity);
+            std::iota(freeOrder.begin(), freeOrder.end(), 0u);
+            std::shuffle(freeOrder.begin(), freeOrder.end(), random);
+
+            std::vector<uint32_t> churnSlots(kChurnOperations);
+            for (uint32_t& slot : churnSlots)
+            {
+                slot = random() % (capacity / 2);
+            }
+
+            RunFreeListScenario<QueueFreeList>("Queue ", capacity, freeOrder, churnSlots);
+            RunFreeListScenario<DescriptorFreeList>("Bitmap", capacity, freeOrder, churnSlots);
+            RunRangeScenario(capacity, random);
+
+            // std::queue(deque)는 인덱스당 4바이트 + 블록 관리 비용
+            DescriptorFreeList bitmap;
+            bitmap.Initialize(capacity);
+            std::printf("  %-44s %10zu bytes (queue >= %zu bytes)\n", "Bitmap memory",
+                        bitmap.GetMemoryUsage(), static_cast<size_t>(capacity) * sizeof(uint32_t));
+        }
+    }
+
+    void RunDescriptorContentionBenchmarks()
+    {
+        PrintHeader("Descriptor allocation contention (global lock vs thread cache)");
+
+        const uint32_t maxThreads = std::max(2u, std::thread::hardware_concurrency());
+        for (uint32_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+        {
+            const uint64_t operations = static_cast<uint64_t>(threadCount) * kContentionOpsPerThread;
+            char name[128];
+
+            std::snprintf(name, sizeof(name), "Global lock  - %2u threads", threadCount);
+            PrintThroughput(name, operations, RunContentionScenario<GlobalLockAllocator>(threadCount));
+
+            std::snprintf(name, sizeof(name), "Thread cache - %2u threads", threadCount);
+            PrintThroughput(name, operations, RunContentionScenario<ThreadCacheAllocator>(threadCount));
+        }
+    }
+}
@@ -0,0 +1,164 @@
+/**
+ * @file LoggerBenchmark.cpp
+ * @brief 로깅 시스템 벤치마크
+ *
+ * 동기 경로(호출 스레드에서 포맷 + mutex + 라인별 flush)와
+ * 비동기 경로(링 버퍼 + writer 스레드 일괄 출력)의 처리량을 비교합니다.
+ * 비동기 경로는 호출 지점 포맷팅(eager)과 지연 포맷 + 바이너리 파일(deferred)을 함께 측정합니다.
+ * 워밍업 이후 메시지당 힙 할당 횟수도 측정합니다 (목표: 0).
+ */
+
+#include "BenchmarkUtils.h"
+#include "AllocationCounter.h"
+#include <Utils/Logger.h>
+#include <thread>
+#include <vector>
+
+namespace DX12GameEngine::Benchmark
+{
+    namespace
+    {
+        constexpr uint32_t kMessagesPerThread = 100000;
+        constexpr uint32_t kAllocationWarmupMessages = 10000;
+        constexpr uint32_t kAllocationMessages = 100000;
+
+        struct LoggerRunResult
+        {
+            double callSiteMs;  // 모든 호출 스레드가 로그 호출을 마칠 때까지
+            double totalMs;     // Shutdown()으로 모든 레코드가 기록될 때까지
+        };
+
+        LoggerRunResult RunLoggerScenario(LogMode mode, uint32_t threadCount,
+                                          LogFileFormat fileFormat, bool deferredFormatting)
+        {
+            LoggerDesc desc;
+            desc.minLevel = LogLevel::Trace;
+            desc.logToFile = true;
+            desc.logToConsole = false;
+            desc.logFilePrefix = L"LoggerBenchmark";
+            desc.mode = mode;
+            desc.fileFormat = fileFormat;
+            desc.deferredFormatting = deferredFormatting;
+            desc.overflowPolicy = LogOverflowPolicy::Block;  // 버려지는 로그 없이 처리량 비교
+            desc.bufferSize = 4 * 1024 * 1024;
+
+            Logger& logger = Logger::Get();
+            logger.Initialize(desc);
+
+            Stopwatch stopwatch;
+
+            std::vector<std::thread> threads;
+            threads.reserve(threadCount);
+            for (uint32_t t = 0; t < threadCount; t++)
+            {
+                threads.emplace_back([t]() {
+                    for (uint32_t i = 0; i < kMessagesPerThread; i++)
+                    {
+                        LOG_WARNING(LogCategory::Core, L"Benchmark message {} from thread {} (frame {})", i, t, i / 100);
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            LoggerRunResult result;
+            result.callSiteMs = stopwatch.ElapsedMs();
+
+            logger.Shutdown();
+            result.totalMs = stopwatch.ElapsedMs();
+
+            return result;
+        }
+
+        struct AllocationRunResult
+        {
+            uint64_t callSiteAllocations;   // 호출 스레드 할당 횟수
+            uint64_t totalAllocations;      // writer 스레드 포함 프로세스 전체
+        };
+
+        AllocationRunResult RunAllocationScenario(LogMode mode, LogFileFormat fileFormat, bool deferredFormatting)
+        {
+            LoggerDesc desc;
+            desc.minLevel = LogLevel::Trace;
+            desc.logToFile = true;
+            desc.logToConsole = false;
+            desc.logFilePrefix = L"LoggerAllocBenchmark";
+            desc.mode = mode;
+            desc.fileFormat = fileFormat;
+            desc.deferredFormatting = deferredFormatting;
+            desc.overflowPolicy = LogOverflowPolicy::Block;
+            desc.bufferSize = 4 * 1024 * 1024;
+
+            Logger& logger = Logger::Get();
+            logger.Initialize(desc);
+
+            const std::wstring name = L"allocation";
+
+            // 워밍업: 포맷 ID 등록, 스레드 로컬 버퍼/배치 버퍼 확보
+            for (uint32_t i = 0; i < kAllocationWarmupMessages; i++)
+            {
+                LOG_WARNING(LogCategory::Core, L"Alloc test {} value {:.3f} name {}", i, i * 0.5, name);
+            }
+
+            const uint64_t threadStart = GetThreadAllocationCount();
+            const uint64_t totalStart = GetAllocationCount();
+
+            for (uint32_t i = 0; i < kAllocationMessages; i++)
+            {
+                LOG_WARNING(LogCategory::Core, L"Alloc test {} value {:.3f} name {}", i, i * 0.5, name);
+            }
+
+            AllocationRunResult result;
+            result.callSiteAllocations = GetThreadAllocationCount() - threadStart;
+            result.totalAllocations = GetAllocationCount() - totalStart;
+
+            logger.Shutdown();
+            return result;
+        }
+
+        void PrintAllocations(const char* name, const AllocationRunResult& result)
+        {
+            std::printf("  %-44s call site %6.3f allocs/msg  total %6.3f allocs/msg\n", name,
+                        static_cast<double>(result.callSiteAllocations) / kAllocationMessages,
+                        static_cast<double>(result.totalAllocations) / kAllocationMessages);
+        }
+    }
+
+    void RunLoggerBenchmarks()
+    {
+        PrintHeader("Logging: Synchronous vs Asynchronous");
+
+        const uint32_t threadCounts[] = { 1, 4 };
+        char name[128];
+
+        for (uint32_t threadCount : threadCounts)
+        {
+            const uint64_t totalMessages = static_cast<uint64_t>(kMessagesPerThread) * threadCount;
+
+            LoggerRunResult sync = RunLoggerScenario(LogMode::Synchronous, threadCount, LogFileFormat::Text, false);
+            std::snprintf(name, sizeof(name), "Sync  %u thread(s) - call site", threadCount);
+            PrintThroughput(name, totalMessages, sync.callSiteMs);
+
+            LoggerRunResult async = RunLoggerScenario(LogMode::Asynchronous, threadCount, LogFileFormat::Text, false);
+            std::snprintf(name, sizeof(name), "Async %u thread(s) - call site", threadCount);
+            PrintThroughput(name, totalMessages, async.callSiteMs);
+            std::snprintf(name, sizeof(name), "Async %u thread(s) - drained to sinks", threadCount);
+            PrintThroughput(name, totalMessages, async.totalMs);
+
+            LoggerRunResult deferred = RunLoggerScenario(LogMode::Asynchronous, threadCount, LogFileFormat::Binary, true);
+            std::snprintf(name, sizeof(name), "Async %u thread(s) deferred binary - call site", threadCount);
+            PrintThroughput(name, totalMessages, deferred.callSiteMs);
+            std::snprintf(name, sizeof(name), "Async %u thread(s) deferred binary - drained", threadCount);
+            PrintThroughput(name, totalMessages, deferred.totalMs);
+        }
+
+        PrintHeader("Logging: Heap allocations per message (after warm-up)");
+        PrintAllocations("Sync  text", RunAllocationScenario(LogMode::Synchronous, LogFileFormat::Text, false));
+        PrintAllocations("Async text (eager format)", RunAllocationScenario(LogMode::Asynchronous, LogFileFormat::Text, false));
+        PrintAllocations("Async text (deferred format)", RunAllocationScenario(LogMode::Asynchronous, LogFileFormat::Text, true));
+        PrintAllocations("Async binary (deferred format)", RunAllocationScenario(LogMode::Asynchronous, LogFileFormat::Binary, true));
+    }
+}
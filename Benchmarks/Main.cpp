@@ -3,13 +3,40 @@
  * @brief DX12GameEngine Benchmark Tool
  *
  * 엔진의 성능을 측정하고 결과를 출력하는 벤치마크 도구입니다.
- * 현재는 프로젝트 구조만 생성되어 있으며,
- * 이슈 #14-15 (벤치마크 프레임워크) 완료 후 실제 측정 기능이 추가됩니다.
+ * 카테고리별 CPU 측 벤치마크를 실행하며,
+ * GPU 타이밍 등은 이슈 #14-15 (벤치마크 프레임워크) 완료 후 추가됩니다.
  */
 
+#include "BenchmarkUtils.h"
 #include <Windows.h>
 #include <iostream>
 #include <string>
+#include <cstring>
+
+using namespace DX12GameEngine::Benchmark;
+
+namespace
+{
+    /**
+     * @brief 벤치마크 카테고리 등록 정보
+     */
+    struct BenchmarkCategory
+    {
+        const char* name;
+        const char* description;
+        void (*run)();
+    };
+
+    const BenchmarkCategory kCategories[] =
+    {
+        { "logging", "로깅 처리량 (동기 vs 비동기)", RunLoggerBenchmarks },
+        { "descriptor", "디스크립터 프리 리스트 (queue vs 계층 비트맵)", RunDescriptorBenchmarks },
+        { "descriptor-mt", "디스크립터 할당 경합 (전역 잠금 vs 스레드별 캐시)", RunDescriptorContentionBenchmarks },
+        { "commandlist", "커맨드 리스트 병렬 기록 효율 (1 ~ N 스레드)", RunCommandListBenchmarks },
+        { "queue", "멀티 큐 스케줄 계획 (큐 간 겹침, Wait 생략)", RunQueueSchedulerBenchmarks },
+        { "commandstream", "렌더 명령 스트림 기록 / 번역 (직접 기록 대비)", RunRenderCommandStreamBenchmarks },
+    };
+}
 
 /**
  * @brief 벤치마크 정보 출력
@@ -21,14 +48,17 @@ void PrintBenchmarkInfo()
     std::cout << "=================================================\n\n";
 
     std::cout << "현재 사용 가능한 벤치마크:\n";
-    std::cout << "  (이슈 #14-15 완료 후 추가 예정)\n\n";
+    for (const BenchmarkCategory& category : kCategories)
+    {
+        std::cout << "  - " << category.name << ": " << category.description << "\n";
+    }
+    std::cout << "\n";
 
     std::cout << "계획된 벤치마크:\n";
     std::cout << "  - FPS 측정\n";
     std::cout << "  - 프레임 타임 측정\n";
     std::cout << "  - GPU 타이밍 (Timestamp Query)\n";
-    std::cout << "  - PSO 생성 시간\n";
-    std::cout << "  - 디스크립터 할당 성능\n\n";
+    std::cout << "  - PSO 생성 시간\n\n";
 }
 
 /**
@@ -36,17 +66,49 @@ void PrintBenchmarkInfo()
  */
 int main(int argc, char* argv[])
 {
-    // TODO: #14 기본 벤치마크 프레임워크 구현
+    // TODO: #14 기본 벤치마크 프레임워크 구현 (결과 파일 출력)
     // TODO: #15 GPU 타이밍 구현
 
     PrintBenchmarkInfo();
 
-    std::cout << "벤치마크 도구가 준비되면 다음과 같이 실행할 수 있습니다:\n";
-    std::cout << "  EngineBenchmark.exe --all\n";
-    std::cout << "  EngineBenchmark.exe --category <category_name>\n";
-    std::cout << "  EngineBenchmark.exe --output <json|csv>\n\n";
+    const char* categoryName = nullptr;
+    bool runAll = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--all") == 0)
+        {
+            runAll = true;
+        }
+        else if (std::strcmp(argv[i], "--category") == 0 && i + 1 < argc)
+        {
+            categoryName = argv[++i];
+        }
+    }
+
+    if (!runAll && !categoryName)
+    {
+        std::cout << "사용법:\n";
+        std::cout << "  EngineBenchmark.exe --all\n";
+        std::cout << "  EngineBenchmark.exe --category <category_name>\n\n";
+        return 0;
+    }
+
+    bool found = false;
+    for (const BenchmarkCategory& category : kCategories)
+    {
+        if (runAll || std::strcmp(category.name, categoryName) == 0)
+        {
+            category.run();
+            found = true;
+        }
+    }
 
-    std::cout << "결과는 Benchmarks/Results/ 폴더에 저장됩니다.\n";
+    if (!found)
+    {
+        std::cout << "알 수 없는 카테고리: " << categoryName << "\n";
+        return 1;
+    }
 
     return 0;
 }
@@ -0,0 +1,239 @@
+/**
+ * @file RenderCommandStreamBenchmark.cpp
+ * @brief 렌더 명령 스트림 기록 / 재생 벤치마크
+ *
+ * RenderCommandStream에 드로우(토폴로지, 뷰포트, 루트 상수, Draw)를 기록하는 비용,
+ * 스트림을 훑으며 명령을 해석하는 비용, 스레드별 스트림을 Append로 합치는 비용을 측정합니다.
+ * 여기까지는 GPU 없이 동작합니다.
+ *
+ * D3D12 장치가 있으면 CommandList에 직접 기록할 때와 스트림 기록 + 번역의 CPU 비용도 비교합니다.
+ * 드로우마다 토폴로지와 뷰포트를 다시 기록하므로, 번역기의 중복 상태 제거를 끄고 켠 비용과
+ * 버린 호출 수도 함께 출력합니다.
+ * 파이프라인 없이 기록하므로 Debug Layer는 끈 상태로 실행하며, 제출하지 않습니다.
+ */
+
+#include "BenchmarkUtils.h"
+#include <Graphics/CommandListManager.h>
+#include <Graphics/CommandQueue.h>
+#include <Graphics/D3D12CommandTranslator.h>
+#include <Graphics/Device.h>
+#include <Graphics/RenderCommandStream.h>
+
+namespace DX12GameEngine::Benchmark
+{
+    namespace
+    {
+        constexpr uint32_t kDrawsPerFrame = 200000;
+        constexpr uint32_t kWarmupFrames = 4;
+        constexpr uint32_t kMeasuredFrames = 16;
+        constexpr uint32_t kMergedStreams = 8;
+
+        /**
+         * @brief 드로우 하나에 해당하는 명령을 스트림에 기록 (상태 설정 + Draw)
+         */
+        void RecordDraws(RenderCommandStream& stream, uint32_t first, uint32_t count)
+        {
+            const RenderViewport viewport = { 0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f };
+            for (uint32_t draw = first; draw < first + count; draw++)
+            {
+                stream.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+                stream.SetViewport(viewport);
+                stream.SetGraphicsRoot32BitConstants(0, 1, &draw);
+                stream.Draw(3, 1, draw * 3, 0);
+            }
+        }
+
+        /**
+         * @brief 같은 드로우를 CommandList에 직접 기록 (스트림과 비교용)
+         */
+        void RecordDraws(ID3D12GraphicsCommandList* commandList, uint32_t first, uint32_t count)
+        {
+            const D3D12_VIEWPORT viewport = { 0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f };
+            for (uint32_t draw = first; draw < first + count; draw++)
+            {
+                commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+                commandList->RSSetViewports(1, &viewport);
+                commandList->SetGraphicsRoot32BitConstants(0, 1, &draw, 0);
+                commandList->DrawInstanced(3, 1, draw * 3, 0);
+            }
+        }
+
+        /**
+         * @brief 스트림을 훑으며 Draw의 정점 수를 합산 (해석 비용 측정, 최적화로 제거되지 않도록 결과 반환)
+         */
+        uint64_t DecodeStream(const RenderCommandStream& stream)
+        {
+            uint64_t vertexCount = 0;
+            for (const RenderCommandHeader& header : stream)
+            {
+                if (header.type == RenderCommandType::Draw)
+                {
+                    vertexCount += header.As<RenderCommand::Draw>().vertexCount;
+                }
+            }
+            return vertexCount;
+        }
+
+        /**
+         * @brief 헤드리스 측정 (기록, 해석, 합치기)
+         */
+        void RunHeadlessBenchmarks()
+        {
+            RenderCommandStream stream;
+            double recordMs = 0.0;
+            double decodeMs = 0.0;
+            uint64_t vertexCount = 0;
+
+            for (uint32_t frame = 0; frame < kWarmupFrames + kMeasuredFrames; frame++)
+            {
+                Stopwatch recordWatch;
+                stream.Reset();
+                RecordDraws(stream, 0, kDrawsPerFrame);
+                const double frameRecordMs = recordWatch.ElapsedMs();
+
+                Stopwatch decodeWatch;
+                vertexCount = DecodeStream(stream);
+                const double frameDecodeMs = decodeWatch.ElapsedMs();
+
+                if (frame >= kWarmupFrames)
+                {
+                    recordMs += frameRecordMs;
+                    decodeMs += frameDecodeMs;
+                }
+            }
+
+            char name[128];
+            std::snprintf(name, sizeof(name), "Record %u draws (stream)", kDrawsPerFrame);
+            PrintThroughput(name, kDrawsPerFrame, recordMs / kMeasuredFrames);
+            std::printf("  %-44s %10.2f MB, %.1f bytes/draw\n", "  stream size",
+                        static_cast<double>(stream.GetSizeInBytes()) / (1024.0 * 1024.0),
+                        static_cast<double>(stream.GetSizeInBytes()) / kDrawsPerFrame);
+
+            std::snprintf(name, sizeof(name), "Decode %u commands", stream.GetCommandCount());
+            PrintThroughput(name, stream.GetCommandCount(), decodeMs / kMeasuredFrames);
+            std::printf("  %-44s %10llu%s\n", "  vertices",
+                        static_cast<unsigned long long>(vertexCount),
+                        vertexCount == static_cast<uint64_t>(kDrawsPerFrame) * 3 ? "" : " (MISMATCH)");
+
+            // 스레드별 스트림을 하나로 합치는 비용 (기록은 측정에서 제외)
+            RenderCommandStream parts[kMergedStreams];
+            const uint32_t drawsPerPart = kDrawsPerFrame / kMergedStreams;
+            for (uint32_t part = 0; part < kMergedStreams; part++)
+            {
+                RecordDraws(parts[part], part * drawsPerPart, drawsPerPart);
+            }
+
+            double appendMs = 0.0;
+            for (uint32_t frame = 0; frame < kWarmupFrames + kMeasuredFrames; frame++)
+            {
+                Stopwatch stopwatch;
+                stream.Reset();
+                for (const RenderCommandStream& part : parts)
+                {
+                    stream.Append(part);
+                }
+                if (frame >= kWarmupFrames)
+                {
+                    appendMs += stopwatch.ElapsedMs();
+                }
+            }
+
+            std::snprintf(name, sizeof(name), "Append %u streams (per command)", kMergedStreams);
+            PrintThroughput(name, stream.GetCommandCount(), appendMs / kMeasuredFrames);
+        }
+
+        /**
+         * @brief 직접 기록 또는 스트림 기록 + 번역으로 프레임을 기록하고 측정 프레임의 평균 시간 반환 (ms)
+         */
+        double RunTranslationScenario(CommandListManager& manager, CommandQueue& queue, RenderCommandStream& stream,
+                                      D3D12CommandTranslator& translator, bool useStream)
+        {
+            double totalMs = 0.0;
+
+            for (uint32_t frame = 0; frame < kWarmupFrames + kMeasuredFrames; frame++)
+            {
+                manager.BeginFrame(queue.GetFence(), queue.GetFenceEvent());
+                CommandListLease commandList = manager.GetCommandList();
+
+                Stopwatch stopwatch;
+                if (useStream)
+                {
+                    stream.Reset();
+                    RecordDraws(stream, 0, kDrawsPerFrame);
+                    translator.Translate(stream, commandList.Get());
+                }
+                else
+                {
+                    RecordDraws(commandList.Get(), 0, kDrawsPerFrame);
+                }
+                commandList->Close();
+                const double elapsedMs = stopwatch.ElapsedMs();
+
+                translator.EndFrame();
+
+                // 제출하지 않고 반환 (Allocator는 Fence 완료 후 풀에서 재사용)
+                manager.ReturnCommandList(commandList);
+                manager.EndFrame(queue.Signal());
+
+                if (frame >= kWarmupFrames)
+                {
+                    totalMs += elapsedMs;
+                }
+            }
+
+            queue.Flush();
+            return totalMs / kMeasuredFrames;
+        }
+    }
+
+    void RunRenderCommandStreamBenchmarks()
+    {
+        PrintHeader("Render command stream (headless)");
+        RunHeadlessBenchmarks();
+
+        PrintHeader("Render command stream vs direct recording (D3D12)");
+
+        Device device;
+        CommandQueue queue;
+        CommandListManager manager;
+        if (!device.Initialize(false) ||
+            !queue.Initialize(device.GetDevice(), D3D12_COMMAND_LIST_TYPE_DIRECT) ||
+            !manager.Initialize(device.GetDevice(), D3D12_COMMAND_LIST_TYPE_DIRECT))
+        {
+            std::printf("  D3D12 device unavailable, skipped\n");
+            return;
+        }
+
+        RenderCommandStream stream;
+        D3D12CommandTranslator translator;
+
+        char name[128];
+        std::snprintf(name, sizeof(name), "Record %u draws - direct", kDrawsPerFrame);
+        const double directMs = RunTranslationScenario(manager, queue, stream, translator, false);
+        PrintThroughput(name, kDrawsPerFrame, directMs);
+
+        translator.SetStateFilteringEnabled(false);
+        std::snprintf(name, sizeof(name), "Record %u draws - stream + translate", kDrawsPerFrame);
+        const double streamMs = RunTranslationScenario(manager, queue, stream, translator, true);
+        PrintThroughput(name, kDrawsPerFrame, streamMs);
+        std::printf("  %-44s %9.1f %%\n", "  stream overhead", directMs > 0.0 ? (streamMs / directMs - 1.0) * 100.0 : 0.0);
+
+        translator.SetStateFilteringEnabled(true);
+        std::snprintf(name, sizeof(name), "Record %u draws - stream + filtered", kDrawsPerFrame);
+        const double filteredMs = RunTranslationScenario(manager, queue, stream, translator, true);
+        PrintThroughput(name, kDrawsPerFrame, filteredMs);
+        std::printf("  %-44s %9.1f %%\n", "  vs direct", directMs > 0.0 ? (filteredMs / directMs - 1.0) * 100.0 : 0.0);
+
+        const CommandTranslationStats& stats = translator.GetLastFrameStats();
+        std::printf("  %-44s %10u / %u (%.1f %%)\n", "  elided calls per frame", stats.elidedCount,
+                    stats.commandCount, stats.GetElidedRatio() * 100.0);
+        for (uint32_t type = 0; type < kRenderCommandTypeCount; type++)
+        {
+            if (stats.elidedByType[type] > 0)
+            {
+                std::printf("    %-42s %10u\n", GetRenderCommandTypeName(static_cast<RenderCommandType>(type)),
+                            stats.elidedByType[type]);
+            }
+        }
+    }
+}
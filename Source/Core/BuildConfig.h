@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include <Utils/Logger.h>
+#include <Utils/LogTypes.h>
 
 namespace DX12GameEngine
 {
@@ -59,13 +59,19 @@ namespace DX12GameEngine
         // 메모리
         static constexpr bool EnableMemoryLeakTracking = true;  // 메모리 누수 추적
         static constexpr bool EnableBoundsChecking = true;      // 배열 범위 검사
+        static constexpr bool ValidateDescriptorHandles = true; // 해제된 디스크립터 사용 검출 (세대 비교)
 
         // 로깅
         static constexpr bool EnableVerboseLogging = true;      // 상세 로그
         static constexpr bool LogFrameTime = true;              // 프레임 타임 로그
         static constexpr bool LogToFile = true;                 // 파일 로그
         static constexpr bool LogToConsole = true;              // 콘솔 로그
-        static constexpr LogLevel MinLogLevel = LogLevel::Trace; // 모든 로그 출력
+        static constexpr LogLevel MinLogLevel = LogLevel::Trace; // 모든 로그 출력 (미만 레벨의 출력은 컴파일에서 제거)
+        static constexpr bool LogAsync = false;                 // 동기 로깅 (중단점 시점에 로그가 이미 출력됨)
+        static constexpr uint32_t LogFileSegmentSize = 0;       // 단일 텍스트 파일 (바로 열어볼 수 있음)
+        static constexpr uint32_t LogFileSegmentCount = 8;
+        static constexpr bool EnableFlightRecorder = true;      // 런타임 레벨로 걸러진 Trace/Debug 보관
+        static constexpr bool LogToJsonFile = false;            // JSON Lines 구조화 로그 (Profile에서 사용)
 
         // 렌더링
         static constexpr bool EnableVSync = true;               // VSync (프레임 안정성)
@@ -90,13 +96,21 @@ namespace DX12GameEngine
         // 메모리
         static constexpr bool EnableMemoryLeakTracking = false;
         static constexpr bool EnableBoundsChecking = false;
+        static constexpr bool ValidateDescriptorHandles = false;
 
         // 로깅
         static constexpr bool EnableVerboseLogging = false;
         static constexpr bool LogFrameTime = false;
         static constexpr bool LogToFile = true;                 // 파일 로그 (크래시 분석용)
         static constexpr bool LogToConsole = false;             // 성능을 위해 끔
-        static constexpr LogLevel MinLogLevel = LogLevel::Warning; // Warning 이상만 출력
+        static constexpr LogLevel MinLogLevel = LogLevel::Warning; // Warning 이상만 출력 (미만 레벨의 출력은 컴파일에서 제거)
+        static constexpr bool LogAsync = true;                  // writer 스레드로 출력 (호출 스레드 블로킹 없음)
+        static constexpr uint32_t LogFileSegmentSize = 16 * 1024 * 1024; // 메모리 맵 세그먼트 16MB (장시간 실행 시 크기 제한)
+        static constexpr uint32_t LogFileSegmentCount = 8;      // 최근 8개 세그먼트 유지 (최대 128MB)
+        // 오류 시 최근 Trace/Debug 덤프. 켜져 있으면 MinLogLevel 미만인 Trace/Debug 호출도 제거되지 않고
+        // 매번 인자를 평가해 레코더에 인코딩함 (호출당 링 버퍼 쓰기 한 번, 비싼 인자 식은 그대로 비용이 됨)
+        static constexpr bool EnableFlightRecorder = true;
+        static constexpr bool LogToJsonFile = false;            // 배포 빌드에서는 끔
 
         // 렌더링
         static constexpr bool EnableVSync = true;               // 기본 VSync 켜기 (화면 찢김 방지)
@@ -121,13 +135,19 @@ namespace DX12GameEngine
         // 메모리
         static constexpr bool EnableMemoryLeakTracking = true;  // 메모리는 추적 (성능 영향 작음)
         static constexpr bool EnableBoundsChecking = false;
+        static constexpr bool ValidateDescriptorHandles = true; // 세대 비교 한 번 (비용 작음)
 
         // 로깅
         static constexpr bool EnableVerboseLogging = false;
         static constexpr bool LogFrameTime = true;              // 프레임 타임은 측정
         static constexpr bool LogToFile = true;                 // 파일 로그 (성능 분석용)
         static constexpr bool LogToConsole = false;             // 성능을 위해 끔
-        static constexpr LogLevel MinLogLevel = LogLevel::Info; // Info 이상만 출력
+        static constexpr LogLevel MinLogLevel = LogLevel::Info; // Info 이상만 출력 (미만 레벨의 출력은 컴파일에서 제거)
+        static constexpr bool LogAsync = true;                  // writer 스레드로 출력 (측정 왜곡 최소화)
+        static constexpr uint32_t LogFileSegmentSize = 64 * 1024 * 1024; // 메모리 맵 세그먼트 64MB
+        static constexpr uint32_t LogFileSegmentCount = 4;      // 최근 4개 세그먼트 유지 (최대 256MB)
+        static constexpr bool EnableFlightRecorder = true;      // 오류 시 최근 Trace/Debug 덤프 (Trace/Debug 인자도 평가됨)
+        static constexpr bool LogToJsonFile = true;             // 성능 대시보드 수집용 JSON Lines 로그
 
         // 렌더링
         static constexpr bool EnableVSync = false;              // 프로파일링 시 VSync 끔 (정확한 측정)
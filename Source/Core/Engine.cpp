@@ -6,6 +6,7 @@
 #include "Engine.h"
 #include <Graphics/Renderer.h>
 #include <Utils/Logger.h>
+#include <Utils/JsonLinesLogSink.h>
 
 namespace DX12GameEngine
 {
@@ -23,10 +24,25 @@ namespace DX12GameEngine
     bool Engine::Initialize(const EngineDesc& desc)
     {
         // 0. 로거 초기화 (가장 먼저)
-        Logger::Get().Initialize(
-            BUILD_DEFAULT(MinLogLevel),
-            BUILD_DEFAULT(LogToFile)
-        );
+        LoggerDesc loggerDesc;
+        loggerDesc.minLevel = BUILD_DEFAULT(MinLogLevel);
+        loggerDesc.logToFile = BUILD_DEFAULT(LogToFile);
+        loggerDesc.logToConsole = BUILD_DEFAULT(LogToConsole);
+        loggerDesc.mode = BUILD_DEFAULT(LogAsync) ? LogMode::Asynchronous : LogMode::Synchronous;
+        loggerDesc.fileSegmentSize = BUILD_DEFAULT(LogFileSegmentSize);
+        loggerDesc.maxFileSegments = BUILD_DEFAULT(LogFileSegmentCount);
+        loggerDesc.enableFlightRecorder = BUILD_DEFAULT(EnableFlightRecorder);
+        Logger::Get().Initialize(loggerDesc);
+
+        // 구조화 로그 싱크 (텍스트 로그와 같은 이름의 .jsonl)
+        if (BUILD_DEFAULT(LogToJsonFile))
+        {
+            auto jsonSink = std::make_shared<JsonLinesLogSink>();
+            if (jsonSink->Open(Logger::Get().GetLogFilePath(L".jsonl")))
+            {
+                Logger::Get().AddSink(std::move(jsonSink));
+            }
+        }
 
         if (m_initialized)
         {
@@ -77,8 +93,12 @@ namespace DX12GameEngine
         LOG_INFO(LogCategory::Engine, L"Starting game loop...");
 
         // 게임 루프
+        uint64_t frameNumber = 0;
         while (m_running)
         {
+            // Present 대기열에 자리가 날 때까지 대기 (이후에 읽는 입력이 이번 프레임에 반영되도록 입력 처리 전)
+            m_renderer->WaitForNextFrame();
+
             // 윈도우 메시지 처리 (이벤트 기반, 틱 아님)
             if (!m_window.ProcessMessages())
             {
@@ -86,6 +106,9 @@ namespace DX12GameEngine
                 break;
             }
 
+            // 이번 프레임에 기록되는 로그의 프레임 번호
+            Logger::SetFrameNumber(++frameNumber);
+
             // 렌더링 (매 프레임 Update)
             m_renderer->BeginFrame();
             m_renderer->RenderFrame();
@@ -150,5 +173,14 @@ namespace DX12GameEngine
             LOG_INFO(LogCategory::Engine, L"ESC pressed, exiting...");
             m_running = false;
         }
+
+        // F2 키로 프레임 지연 모드 전환 (저지연 <-> 처리량)
+        if (event.isPressed && !event.isRepeat && event.keyCode == VK_F2 && m_renderer)
+        {
+            const FrameLatencyMode mode = m_renderer->GetFrameLatencyMode() == FrameLatencyMode::LowLatency
+                ? FrameLatencyMode::Throughput
+                : FrameLatencyMode::LowLatency;
+            m_renderer->SetFrameLatencyMode(mode);
+        }
     }
 }
@@ -0,0 +1,190 @@
+/**
+ * @file BindlessDescriptorTable.cpp
+ * @brief 세대 카운터 기반 바인드리스 디스크립터 테이블 구현
+ */
+
+#include "BindlessDescriptorTable.h"
+#include <Utils/Logger.h>
+
+namespace DX12GameEngine
+{
+    BindlessDescriptorTable::BindlessDescriptorTable()
+        : m_heap(nullptr)
+        , m_copyBatch(nullptr)
+        , m_capacity(0)
+        , m_registeredCount(0)
+        , m_initialized(false)
+    {
+    }
+
+    BindlessDescriptorTable::~BindlessDescriptorTable()
+    {
+        Shutdown();
+    }
+
+    bool BindlessDescriptorTable::Initialize(DescriptorHeap* heap, DescriptorCopyBatch* copyBatch, uint32_t capacity)
+    {
+        if (m_initialized)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"BindlessDescriptorTable already initialized");
+            return true;
+        }
+
+        if (!heap || !heap->IsShaderVisible() || !copyBatch || capacity == 0)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"BindlessDescriptorTable::Initialize - invalid parameters");
+            return false;
+        }
+
+        m_base = heap->AllocateRange(capacity);
+        if (!m_base.IsValid())
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to reserve {} bindless descriptors", capacity);
+            return false;
+        }
+
+        m_heap = heap;
+        m_copyBatch = copyBatch;
+        m_capacity = capacity;
+        m_freeSlots.Initialize(capacity);
+        m_generations.assign(capacity, 1);
+        m_retiredSlots.clear();
+        m_registeredCount = 0;
+        m_initialized = true;
+
+        LOG_INFO(LogCategory::Renderer, L"BindlessDescriptorTable initialized ({} slots at heap index {})",
+                 capacity, m_base.heapIndex);
+        return true;
+    }
+
+    void BindlessDescriptorTable::Shutdown()
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        if (m_registeredCount > 0)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"BindlessDescriptorTable destroyed with {} slots still registered",
+                        m_registeredCount);
+        }
+
+        m_heap->FreeRange(m_base, m_capacity);
+        m_heap = nullptr;
+        m_copyBatch = nullptr;
+        m_base = DescriptorHandle();
+        m_capacity = 0;
+        m_generations.clear();
+        m_retiredSlots.clear();
+        m_registeredCount = 0;
+        m_initialized = false;
+    }
+
+    BindlessHandle BindlessDescriptorTable::Register(const DescriptorHandle& source, uint32_t sourcePage)
+    {
+        if (!m_initialized || !source.IsValid())
+        {
+            return BindlessHandle();
+        }
+
+        BindlessHandle handle;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const uint32_t index = m_freeSlots.Allocate();
+            if (index == DescriptorFreeList::kInvalidIndex)
+            {
+                LOG_ERROR(LogCategory::Renderer, L"BindlessDescriptorTable is full ({} slots, {} awaiting fence)",
+                          m_capacity, m_retiredSlots.size());
+                return BindlessHandle();
+            }
+
+            handle.index = index;
+            handle.generation = m_generations[index];
+            m_registeredCount++;
+        }
+
+        m_copyBatch->Add(GetSlotCpuHandle(handle.index), source.cpuHandle, 1, sourcePage);
+        return handle;
+    }
+
+    bool BindlessDescriptorTable::Update(const BindlessHandle& handle, const DescriptorHandle& source, uint32_t sourcePage)
+    {
+        if (!m_initialized || !source.IsValid())
+        {
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!IsAliveLocked(handle))
+            {
+                LOG_WARNING(LogCategory::Renderer, L"BindlessDescriptorTable::Update - stale handle (index {})",
+                            handle.index);
+                return false;
+            }
+        }
+
+        // 진행 중인 프레임이 읽는 슬롯을 덮어쓰므로, 호출자는 GPU가 이전 내용을 더 읽지 않을 때 갱신해야 함
+        m_copyBatch->Add(GetSlotCpuHandle(handle.index), source.cpuHandle, 1, sourcePage);
+        return true;
+    }
+
+    bool BindlessDescriptorTable::Release(const BindlessHandle& handle, uint64_t fenceValue)
+    {
+        if (!m_initialized)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!IsAliveLocked(handle))
+        {
+            LOG_WARNING(LogCategory::Renderer, L"BindlessDescriptorTable::Release - stale handle (index {})",
+                        handle.index);
+            return false;
+        }
+
+        // 세대를 즉시 올려 남아 있는 핸들을 무효화 (0은 건너뜀)
+        uint32_t& generation = m_generations[handle.index];
+        generation = generation + 1 == 0 ? 1 : generation + 1;
+
+        m_retiredSlots.push_back({ fenceValue, handle.index });
+        m_registeredCount--;
+        return true;
+    }
+
+    void BindlessDescriptorTable::ProcessRetiredSlots(uint64_t completedFenceValue)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        while (!m_retiredSlots.empty() && m_retiredSlots.front().fenceValue <= completedFenceValue)
+        {
+            m_freeSlots.Free(m_retiredSlots.front().index);
+            m_retiredSlots.pop_front();
+        }
+    }
+
+    bool BindlessDescriptorTable::IsAlive(const BindlessHandle& handle) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return IsAliveLocked(handle);
+    }
+
+    uint32_t BindlessDescriptorTable::GetRegisteredCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_registeredCount;
+    }
+
+    bool BindlessDescriptorTable::IsAliveLocked(const BindlessHandle& handle) const
+    {
+        return m_initialized && handle.index < m_capacity &&
+               m_generations[handle.index] == handle.generation &&
+               m_freeSlots.IsAllocated(handle.index);
+    }
+
+    D3D12_CPU_DESCRIPTOR_HANDLE BindlessDescriptorTable::GetSlotCpuHandle(uint32_t index) const
+    {
+        return m_heap->GetCpuHandle(m_base.heapIndex + index);
+    }
+}
@@ -0,0 +1,165 @@
+/**
+ * @file BindlessDescriptorTable.h
+ * @brief 세대 카운터 기반 바인드리스 디스크립터 테이블
+ *
+ * 셰이더 가시 힙의 연속 구간 하나를 큰 디스크립터 테이블로 사용합니다.
+ * 등록한 리소스는 테이블 안의 고정 슬롯(셰이더 인덱스)을 받으며, 셰이더는
+ * ResourceDescriptorHeap 배열처럼 이 인덱스로 직접 접근합니다. 드로우마다 테이블을 바꿀 필요가 없습니다.
+ *
+ * - 슬롯마다 세대(generation)를 두어 해제된 핸들(stale)을 검출
+ * - 해제된 슬롯은 Fence 완료 후에만 재사용 (GPU가 읽는 중인 디스크립터를 덮어쓰지 않음)
+ * - 디스크립터는 CPU 스테이징 힙에서 DescriptorCopyBatch로 복사
+ *
+ * 스레드 안전합니다.
+ */
+
+#pragma once
+
+#include "DescriptorHeap.h"
+#include "DescriptorCopyBatch.h"
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 바인드리스 테이블 핸들
+     *
+     * index는 셰이더에 넘기는 안정적인 32비트 인덱스이고, generation은 CPU 측 유효성 검사용입니다.
+     */
+    struct BindlessHandle
+    {
+        uint32_t index;
+        uint32_t generation;
+
+        BindlessHandle()
+            : index(UINT32_MAX)
+            , generation(0)
+        {
+        }
+
+        bool IsValid() const { return index != UINT32_MAX; }
+
+        /**
+         * @brief 셰이더에 넘길 인덱스 (테이블 시작 기준)
+         */
+        uint32_t GetShaderIndex() const { return index; }
+    };
+
+    /**
+     * @brief 바인드리스 디스크립터 테이블
+     */
+    class BindlessDescriptorTable
+    {
+    public:
+        BindlessDescriptorTable();
+        ~BindlessDescriptorTable();
+
+        // 복사 및 이동 금지
+        BindlessDescriptorTable(const BindlessDescriptorTable&) = delete;
+        BindlessDescriptorTable& operator=(const BindlessDescriptorTable&) = delete;
+        BindlessDescriptorTable(BindlessDescriptorTable&&) = delete;
+        BindlessDescriptorTable& operator=(BindlessDescriptorTable&&) = delete;
+
+        /**
+         * @brief 셰이더 가시 힙에서 연속 구간을 예약
+         * @param heap 셰이더 가시 힙 (CBV/SRV/UAV 또는 Sampler)
+         * @param copyBatch 스테이징 → 테이블 복사에 사용할 배치 (heap과 같은 타입)
+         * @param capacity 테이블 크기 (슬롯 개수)
+         * @return 성공 시 true
+         */
+        bool Initialize(DescriptorHeap* heap, DescriptorCopyBatch* copyBatch, uint32_t capacity);
+
+        /**
+         * @brief 예약한 구간을 힙에 반환 (GPU가 테이블을 더 이상 참조하지 않아야 함)
+         */
+        void Shutdown();
+
+        /**
+         * @brief 디스크립터 등록
+         *
+         * 슬롯을 할당하고 source를 슬롯으로 복사 예약합니다. 복사는 다음 DescriptorCopyBatch::Flush에서 수행됩니다.
+         *
+         * @param source CPU 스테이징 힙의 디스크립터
+         * @param sourcePage source가 속한 스테이징 페이지 (DescriptorCopyBatch::Add 참고)
+         * @return 핸들 (테이블이 가득 차면 IsValid() == false)
+         */
+        BindlessHandle Register(const DescriptorHandle& source, uint32_t sourcePage);
+
+        /**
+         * @brief 등록된 슬롯의 디스크립터 교체 (핸들과 인덱스 유지)
+         * @return 핸들이 유효하면 true
+         */
+        bool Update(const BindlessHandle& handle, const DescriptorHandle& source, uint32_t sourcePage);
+
+        /**
+         * @brief 등록 해제
+         *
+         * 세대를 즉시 올려 기존 핸들을 무효화하고, 슬롯은 fenceValue 완료 후 재사용합니다.
+         *
+         * @param handle 해제할 핸들
+         * @param fenceValue 마지막으로 이 슬롯을 참조한 제출 이후의 Fence 값
+         * @return 핸들이 유효했으면 true (이미 해제된 핸들이면 false)
+         */
+        bool Release(const BindlessHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief 완료된 Fence까지 해제된 슬롯을 재사용 가능하게 함
+         */
+        void ProcessRetiredSlots(uint64_t completedFenceValue);
+
+        /**
+         * @brief 핸들이 현재 등록 상태인지 (세대 일치)
+         */
+        bool IsAlive(const BindlessHandle& handle) const;
+
+        /**
+         * @brief 테이블 시작 GPU 핸들 (SetGraphicsRootDescriptorTable에 전달)
+         */
+        D3D12_GPU_DESCRIPTOR_HANDLE GetGpuTableStart() const { return m_base.gpuHandle; }
+
+        /**
+         * @brief 테이블 크기
+         */
+        uint32_t GetCapacity() const { return m_capacity; }
+
+        /**
+         * @brief 등록된 슬롯 수 (재사용 대기 중인 슬롯 제외)
+         */
+        uint32_t GetRegisteredCount() const;
+
+    private:
+        /**
+         * @brief 재사용 대기 슬롯
+         */
+        struct RetiredSlot
+        {
+            uint64_t fenceValue;
+            uint32_t index;
+        };
+
+        /**
+         * @brief 세대 일치 검사 (m_mutex를 잡은 상태에서 호출)
+         */
+        bool IsAliveLocked(const BindlessHandle& handle) const;
+
+        /**
+         * @brief 슬롯의 CPU 핸들
+         */
+        D3D12_CPU_DESCRIPTOR_HANDLE GetSlotCpuHandle(uint32_t index) const;
+
+    private:
+        DescriptorHeap* m_heap;
+        DescriptorCopyBatch* m_copyBatch;
+        DescriptorHandle m_base;
+        uint32_t m_capacity;
+
+        mutable std::mutex m_mutex;
+        DescriptorFreeList m_freeSlots;
+        std::vector<uint32_t> m_generations;    // 슬롯별 세대 (해제할 때 증가, 0은 사용하지 않음)
+        std::deque<RetiredSlot> m_retiredSlots; // Fence 값 순서
+        uint32_t m_registeredCount;
+        bool m_initialized;
+    };
+}
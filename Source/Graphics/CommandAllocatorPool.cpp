@@ -0,0 +1,154 @@
+/**
+ * @file CommandAllocatorPool.cpp
+ * @brief Fence 기반 Command Allocator 재사용 풀 구현
+ */
+
+#include "CommandAllocatorPool.h"
+#include <Utils/Logger.h>
+#include <algorithm>
+
+namespace DX12GameEngine
+{
+    CommandAllocatorPool::CommandAllocatorPool()
+        : m_device(nullptr)
+        , m_type(D3D12_COMMAND_LIST_TYPE_DIRECT)
+        , m_averageCommands(0.0)
+        , m_oversizedReleaseCount(0)
+        , m_initialized(false)
+    {
+    }
+
+    CommandAllocatorPool::~CommandAllocatorPool()
+    {
+        if (!m_active.empty())
+        {
+            LOG_WARNING(LogCategory::Renderer, L"CommandAllocatorPool destroyed with {} allocators still in use",
+                        m_active.size());
+        }
+    }
+
+    bool CommandAllocatorPool::Initialize(ID3D12Device* device, D3D12_COMMAND_LIST_TYPE type)
+    {
+        if (m_initialized)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"CommandAllocatorPool already initialized");
+            return true;
+        }
+
+        if (!device)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"CommandAllocatorPool::Initialize - device is null");
+            return false;
+        }
+
+        m_device = device;
+        m_type = type;
+        m_initialized = true;
+        return true;
+    }
+
+    ID3D12CommandAllocator* CommandAllocatorPool::Acquire(uint64_t completedFenceValue)
+    {
+        if (!m_initialized)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"CommandAllocatorPool::Acquire - not initialized");
+            return nullptr;
+        }
+
+        // 가장 오래된 것부터 완료 여부 확인 (Fence 값 순서)
+        while (!m_retired.empty() && m_retired.front().fenceValue <= completedFenceValue)
+        {
+            Entry entry = std::move(m_retired.front().entry);
+            m_retired.pop_front();
+
+            if (IsOversized(entry))
+            {
+                // 급증 프레임에서 커진 Allocator는 버리고 다음 것을 사용 (GPU 완료 후이므로 해제 안전)
+                m_oversizedReleaseCount++;
+                LOG_DEBUG_EVERY_MS(LogCategory::Renderer, 1000,
+                                   L"Released oversized CommandAllocator ({} commands, average {:.0f})",
+                                   entry.highWaterCommands, m_averageCommands);
+                continue;
+            }
+
+            HRESULT hr = entry.allocator->Reset();
+            if (FAILED(hr))
+            {
+                LOG_ERROR(LogCategory::Renderer, L"Failed to reset CommandAllocator (HRESULT: {:#x})",
+                          static_cast<uint32_t>(hr));
+                continue;
+            }
+
+            ID3D12CommandAllocator* allocator = entry.allocator.Get();
+            m_active.emplace(allocator, std::move(entry));
+            return allocator;
+        }
+
+        Entry entry;
+        entry.highWaterCommands = 0;
+        HRESULT hr = m_device->CreateCommandAllocator(m_type, IID_PPV_ARGS(&entry.allocator));
+        if (FAILED(hr))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to create CommandAllocator (HRESULT: {:#x})",
+                      static_cast<uint32_t>(hr));
+            return nullptr;
+        }
+
+        ID3D12CommandAllocator* allocator = entry.allocator.Get();
+        m_active.emplace(allocator, std::move(entry));
+        // 워밍업 이후 계속 생성되면 반환 누락 신호이므로 요약만 남김
+        LOG_DEBUG_FIRST_N(LogCategory::Renderer, 8, L"Created new CommandAllocator (pool size: {})",
+                          GetAllocatorCount());
+        return allocator;
+    }
+
+    void CommandAllocatorPool::Release(ID3D12CommandAllocator* allocator, uint64_t fenceValue,
+                                       uint64_t recordedCommands)
+    {
+        auto it = m_active.find(allocator);
+        if (it == m_active.end())
+        {
+            LOG_WARNING(LogCategory::Renderer, L"CommandAllocatorPool::Release - allocator not in use");
+            return;
+        }
+
+        Entry entry = std::move(it->second);
+        m_active.erase(it);
+
+        if (recordedCommands > 0)
+        {
+            entry.highWaterCommands = std::max(entry.highWaterCommands, recordedCommands);
+            // 첫 보고는 그대로 평균으로 사용 (0에서 시작하면 초반 Allocator가 모두 급증으로 보임)
+            m_averageCommands = m_averageCommands == 0.0
+                ? static_cast<double>(recordedCommands)
+                : m_averageCommands + (static_cast<double>(recordedCommands) - m_averageCommands) / 16.0;
+        }
+
+        m_retired.push_back({ fenceValue, std::move(entry) });
+    }
+
+    uint32_t CommandAllocatorPool::Trim(uint64_t completedFenceValue, uint32_t keepCount)
+    {
+        // 완료된 유휴 Allocator는 앞쪽에 모여 있음 (GPU가 아직 쓰는 것은 세지 않음)
+        size_t idleCount = 0;
+        while (idleCount < m_retired.size() && m_retired[idleCount].fenceValue <= completedFenceValue)
+        {
+            idleCount++;
+        }
+
+        uint32_t released = 0;
+        while (idleCount > keepCount)
+        {
+            m_retired.pop_front();
+            idleCount--;
+            released++;
+        }
+        return released;
+    }
+
+    bool CommandAllocatorPool::IsOversized(const Entry& entry) const
+    {
+        return entry.highWaterCommands > kMinOversizeCommands &&
+               static_cast<double>(entry.highWaterCommands) > m_averageCommands * kOversizeFactor;
+    }
+}
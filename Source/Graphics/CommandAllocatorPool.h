@@ -0,0 +1,125 @@
+/**
+ * @file CommandAllocatorPool.h
+ * @brief Fence 기반 Command Allocator 재사용 풀
+ *
+ * 제출이 끝난 Allocator를 Fence 값과 함께 돌려받아, GPU가 완료한 뒤 Reset해서 다시 빌려줍니다.
+ * 프레임 슬롯에 묶이지 않으므로 한 프레임이 Allocator를 여러 개 쓸 수 있고, 쉬는 Allocator는 줄일 수 있습니다.
+ *
+ * Allocator는 Reset해도 메모리를 돌려주지 않으므로, 한 번 크게 기록한 Allocator는 계속 크게 남습니다.
+ * 풀은 Allocator마다 기록량의 최고치(high-water)를 추적하고, 최근 평균보다 훨씬 큰 Allocator는
+ * 재사용하지 않고 해제해 순간적인 급증이 메모리를 계속 차지하지 않게 합니다.
+ * D3D12는 Allocator 크기를 알려주지 않으므로 기록량은 호출자가 보고한 명령 수로 추정합니다.
+ *
+ * 스레드 안전하지 않습니다 (CommandListManager가 메인 스레드에서 사용).
+ */
+
+#pragma once
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+
+namespace DX12GameEngine
+{
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief Fence 기반 Command Allocator 풀
+     */
+    class CommandAllocatorPool
+    {
+    public:
+        CommandAllocatorPool();
+        ~CommandAllocatorPool();
+
+        // 복사 및 이동 금지
+        CommandAllocatorPool(const CommandAllocatorPool&) = delete;
+        CommandAllocatorPool& operator=(const CommandAllocatorPool&) = delete;
+        CommandAllocatorPool(CommandAllocatorPool&&) = delete;
+        CommandAllocatorPool& operator=(CommandAllocatorPool&&) = delete;
+
+        /**
+         * @brief 초기화
+         * @param device D3D12 디바이스
+         * @param type Command List 타입
+         * @return 성공 시 true
+         */
+        bool Initialize(ID3D12Device* device, D3D12_COMMAND_LIST_TYPE type);
+
+        /**
+         * @brief Reset된 Allocator 대여 (완료된 것이 없으면 새로 생성)
+         * @param completedFenceValue GPU가 완료한 Fence 값
+         * @return Allocator (생성 실패 시 nullptr)
+         */
+        ID3D12CommandAllocator* Acquire(uint64_t completedFenceValue);
+
+        /**
+         * @brief 제출한 Allocator 반환 (fenceValue 완료 후 재사용)
+         * @param allocator Acquire로 빌린 Allocator
+         * @param fenceValue 이 Allocator로 기록한 마지막 제출 이후의 Fence 값
+         * @param recordedCommands 이번에 기록한 명령 수 (추정치, 0이면 크기 추적에서 제외)
+         */
+        void Release(ID3D12CommandAllocator* allocator, uint64_t fenceValue, uint64_t recordedCommands);
+
+        /**
+         * @brief GPU가 완료한 유휴 Allocator를 keepCount개만 남기고 해제 (아직 GPU가 쓰는 것은 유지)
+         * @return 해제한 Allocator 수
+         */
+        uint32_t Trim(uint64_t completedFenceValue, uint32_t keepCount);
+
+        /**
+         * @brief 살아 있는 Allocator 수 (대여 중 + 대기 중)
+         */
+        uint32_t GetAllocatorCount() const { return static_cast<uint32_t>(m_active.size() + m_retired.size()); }
+
+        /**
+         * @brief 대여 중인 Allocator 수
+         */
+        uint32_t GetActiveCount() const { return static_cast<uint32_t>(m_active.size()); }
+
+        /**
+         * @brief 크기 급증으로 재사용하지 않고 해제한 누적 Allocator 수
+         */
+        uint64_t GetOversizedReleaseCount() const { return m_oversizedReleaseCount; }
+
+    private:
+        /**
+         * @brief Allocator와 기록량 최고치
+         */
+        struct Entry
+        {
+            ComPtr<ID3D12CommandAllocator> allocator;
+            uint64_t highWaterCommands;     // 생성 이후 한 번에 기록한 최대 명령 수
+        };
+
+        /**
+         * @brief GPU 완료를 기다리는 Allocator
+         */
+        struct RetiredEntry
+        {
+            uint64_t fenceValue;
+            Entry entry;
+        };
+
+        /**
+         * @brief 최근 평균보다 훨씬 크게 자란 Allocator인지
+         */
+        bool IsOversized(const Entry& entry) const;
+
+    private:
+        // 평균의 이 배수를 넘으면 급증으로 보고 재사용하지 않음 (작은 기록량은 무시)
+        static constexpr double kOversizeFactor = 4.0;
+        static constexpr uint64_t kMinOversizeCommands = 4096;
+
+        ID3D12Device* m_device;
+        D3D12_COMMAND_LIST_TYPE m_type;
+
+        std::unordered_map<ID3D12CommandAllocator*, Entry> m_active;
+        std::deque<RetiredEntry> m_retired;     // Fence 값 순서
+        double m_averageCommands;               // Allocator당 기록량의 지수 이동 평균
+        uint64_t m_oversizedReleaseCount;
+        bool m_initialized;
+    };
+}
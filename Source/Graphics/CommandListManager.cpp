@@ -4,6 +4,7 @@
  */
 
 #include "CommandListManager.h"
+#include "FenceTimeline.h"
 #include <Utils/Logger.h>
 
 namespace DX12GameEngine
@@ -12,8 +13,12 @@ namespace DX12GameEngine
         : m_device(nullptr)
         , m_type(D3D12_COMMAND_LIST_TYPE_DIRECT)
         , m_initialized(false)
+        , m_fenceTimeline(nullptr)
+        , m_lastFrameAllocatorCount(1)
+        , m_completedFenceValue(0)
         , m_fenceValues{}
-        , m_currentFrameIndex(0)
+        , m_frameCount(0)
+        , m_framesInFlight(kDefaultFramesInFlight)
     {
     }
 
@@ -21,6 +26,13 @@ namespace DX12GameEngine
     {
         if (m_initialized)
         {
+            // 기록 중이던 프레임의 Allocator는 제출되지 않았으므로 바로 재사용 가능한 상태로 반환
+            for (const FrameAllocator& frameAllocator : m_frameAllocators)
+            {
+                m_allocatorPool.Release(frameAllocator.allocator, 0, 0);
+            }
+            m_frameAllocators.clear();
+
             LOG_INFO(LogCategory::Renderer, L"CommandListManager destroyed");
         }
     }
@@ -43,36 +55,35 @@ namespace DX12GameEngine
         m_device = device;
         m_type = type;
 
-        // 프레임별 Allocator 생성
-        for (uint32_t i = 0; i < kMaxFramesInFlight; i++)
+        if (!m_allocatorPool.Initialize(device, type))
         {
-            HRESULT hr = device->CreateCommandAllocator(type, IID_PPV_ARGS(&m_allocators[i]));
-            if (FAILED(hr))
-            {
-                LOG_ERROR(LogCategory::Renderer,
-                          L"Failed to create CommandAllocator[{}] (HRESULT: {:#x})",
-                          i, static_cast<uint32_t>(hr));
-                return false;
-            }
-            m_fenceValues[i] = 0;
+            return false;
         }
 
-        LOG_INFO(LogCategory::Renderer,
-                 L"Created {} CommandAllocators for frame buffering",
-                 kMaxFramesInFlight);
+        // 초기 CommandList 풀 생성 (생성용 Allocator는 기록 없이 바로 풀에 반환)
+        ID3D12CommandAllocator* allocator = m_allocatorPool.Acquire(0);
+        if (!allocator)
+        {
+            return false;
+        }
 
-        // 초기 CommandList 풀 생성
         for (uint32_t i = 0; i < initialListCount; i++)
         {
-            CreateNewCommandList();
+            CreateNewCommandList(allocator);
         }
+        m_allocatorPool.Release(allocator, 0, 0);
 
         LOG_INFO(LogCategory::Renderer,
                  L"Created {} CommandLists in pool",
                  initialListCount);
 
+        for (uint32_t i = 0; i < kMaxFramesInFlight; i++)
+        {
+            m_fenceValues[i] = 0;
+        }
+
         m_initialized = true;
-        m_currentFrameIndex = 0;
+        m_frameCount = 0;
 
         LOG_INFO(LogCategory::Renderer, L"CommandListManager initialized");
 
@@ -93,36 +104,55 @@ namespace DX12GameEngine
             return;
         }
 
-        // 현재 프레임의 Allocator가 GPU에서 완료되었는지 확인
+        if (!m_frameAllocators.empty())
+        {
+            LOG_WARNING(LogCategory::Renderer, L"CommandListManager::BeginFrame - previous frame not ended");
+            return;
+        }
+
+        // m_framesInFlight 프레임 전의 작업이 GPU에서 완료되었는지 확인 (아직 그만큼 진행하지 않았으면 0)
         uint64_t completedValue = fence->GetCompletedValue();
-        uint64_t requiredValue = m_fenceValues[m_currentFrameIndex];
+        uint64_t requiredValue = m_frameCount >= m_framesInFlight
+            ? m_fenceValues[(m_frameCount - m_framesInFlight) % kMaxFramesInFlight]
+            : 0;
 
         if (completedValue < requiredValue)
         {
-            // GPU가 아직 이 Allocator를 사용 중 - 대기
-            HRESULT hr = fence->SetEventOnCompletion(requiredValue, fenceEvent);
-            if (FAILED(hr))
+            // GPU가 아직 그 프레임을 처리 중 - 대기 (FenceTimeline이 있으면 완료된 콜백을 처리하며 대기)
+            if (m_fenceTimeline && m_fenceTimeline->IsRunning())
             {
-                LOG_ERROR(LogCategory::Renderer,
-                          L"Failed to set fence event (HRESULT: {:#x})",
-                          static_cast<uint32_t>(hr));
-                return;
+                m_fenceTimeline->Wait(fence, requiredValue);
             }
-
-            WaitForSingleObject(fenceEvent, INFINITE);
-            LOG_DEBUG(LogCategory::Renderer,
-                      L"Waited for frame {} fence (value: {})",
-                      m_currentFrameIndex, requiredValue);
+            else
+            {
+                HRESULT hr = fence->SetEventOnCompletion(requiredValue, fenceEvent);
+                if (FAILED(hr))
+                {
+                    LOG_ERROR(LogCategory::Renderer,
+                              L"Failed to set fence event (HRESULT: {:#x})",
+                              static_cast<uint32_t>(hr));
+                    return;
+                }
+
+                WaitForSingleObject(fenceEvent, INFINITE);
+            }
+            // 매 프레임 발생할 수 있으므로 1초에 한 번만 출력
+            LOG_DEBUG_EVERY_MS(LogCategory::Renderer, 1000,
+                               L"Waited for frame {} fence (value: {})",
+                               m_frameCount - m_framesInFlight, requiredValue);
+            completedValue = fence->GetCompletedValue();
         }
 
-        // Allocator Reset
-        HRESULT hr = m_allocators[m_currentFrameIndex]->Reset();
-        if (FAILED(hr))
+        // 지난 프레임보다 많이 쌓인 유휴 Allocator 정리 후 메인 Allocator 대여
+        m_completedFenceValue = completedValue;
+        m_allocatorPool.Trim(completedValue, m_lastFrameAllocatorCount);
+
+        ID3D12CommandAllocator* allocator = m_allocatorPool.Acquire(completedValue);
+        if (!allocator)
         {
-            LOG_ERROR(LogCategory::Renderer,
-                      L"Failed to reset CommandAllocator[{}] (HRESULT: {:#x})",
-                      m_currentFrameIndex, static_cast<uint32_t>(hr));
+            return;
         }
+        m_frameAllocators.push_back({ allocator, 0 });
     }
 
     void CommandListManager::EndFrame(uint64_t fenceValue)
@@ -132,94 +162,236 @@ namespace DX12GameEngine
             return;
         }
 
-        // 현재 프레임의 Fence 값 기록
-        m_fenceValues[m_currentFrameIndex] = fenceValue;
+        // 이번 프레임의 Allocator를 Fence 값과 함께 반환 (완료 후 다른 프레임이 재사용)
+        for (const FrameAllocator& frameAllocator : m_frameAllocators)
+        {
+            m_allocatorPool.Release(frameAllocator.allocator, fenceValue, frameAllocator.recordedCommands);
+        }
+        m_lastFrameAllocatorCount = static_cast<uint32_t>(m_frameAllocators.size());
+        m_frameAllocators.clear();
 
-        // 다음 프레임으로 이동
-        m_currentFrameIndex = (m_currentFrameIndex + 1) % kMaxFramesInFlight;
+        // 현재 프레임의 Fence 값 기록 후 다음 프레임으로 이동
+        m_fenceValues[m_frameCount % kMaxFramesInFlight] = fenceValue;
+        m_frameCount++;
     }
 
-    ID3D12GraphicsCommandList* CommandListManager::GetCommandList(ID3D12PipelineState* pipelineState)
+    bool CommandListManager::SetFramesInFlight(uint32_t framesInFlight)
     {
-        if (!m_initialized)
+        if (framesInFlight == 0 || framesInFlight > kMaxFramesInFlight)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"CommandListManager::SetFramesInFlight - invalid count {} (1 ~ {})",
+                      framesInFlight, kMaxFramesInFlight);
+            return false;
+        }
+
+        if (!m_frameAllocators.empty())
+        {
+            LOG_ERROR(LogCategory::Renderer, L"CommandListManager::SetFramesInFlight - frame in progress");
+            return false;
+        }
+
+        if (framesInFlight != m_framesInFlight)
+        {
+            LOG_INFO(LogCategory::Renderer, L"Frames in flight: {} -> {}", m_framesInFlight, framesInFlight);
+            m_framesInFlight = framesInFlight;
+        }
+        return true;
+    }
+
+    CommandListLease CommandListManager::GetCommandList(ID3D12PipelineState* pipelineState)
+    {
+        if (!m_initialized || m_frameAllocators.empty())
+        {
+            LOG_ERROR(LogCategory::Renderer, L"CommandListManager::GetCommandList - no frame in progress");
+            return CommandListLease();
+        }
+
+        return AcquireCommandList(0, pipelineState);
+    }
+
+    void CommandListManager::ReturnCommandList(const CommandListLease& lease)
+    {
+        if (!lease.IsValid())
+        {
+            return;
+        }
+
+        if (lease.poolIndex >= m_commandListPool.size() ||
+            m_commandListPool[lease.poolIndex].Get() != lease.commandList)
+        {
+            LOG_WARNING(LogCategory::Renderer,
+                        L"ReturnCommandList - CommandList not found in pool");
+            return;
+        }
+
+        if (!m_leased[lease.poolIndex])
+        {
+            LOG_WARNING(LogCategory::Renderer,
+                        L"ReturnCommandList - CommandList {} returned twice", lease.poolIndex);
+            return;
+        }
+
+        m_leased[lease.poolIndex] = 0;
+        m_availableIndices.push_back(lease.poolIndex);
+    }
+
+    void CommandListManager::ReportRecordedCommands(const CommandListLease& lease, uint32_t commandCount)
+    {
+        if (lease.allocatorSlot < m_frameAllocators.size())
+        {
+            m_frameAllocators[lease.allocatorSlot].recordedCommands += commandCount;
+        }
+    }
+
+    ID3D12CommandAllocator* CommandListManager::GetCurrentAllocator() const
+    {
+        if (!m_initialized || m_frameAllocators.empty())
         {
-            LOG_ERROR(LogCategory::Renderer, L"CommandListManager::GetCommandList - not initialized");
             return nullptr;
         }
+        return m_frameAllocators[0].allocator;
+    }
 
-        size_t index;
+    CommandListLease CommandListManager::AcquireCommandList(uint32_t allocatorSlot,
+                                                            ID3D12PipelineState* pipelineState)
+    {
+        ID3D12CommandAllocator* allocator = m_frameAllocators[allocatorSlot].allocator;
 
         if (m_availableIndices.empty())
         {
             // 풀에 사용 가능한 CommandList가 없으면 새로 생성
-            index = CreateNewCommandList();
-            LOG_DEBUG(LogCategory::Renderer, L"Created new CommandList (pool size: {})",
-                      m_commandListPool.size());
-        }
-        else
-        {
-            // 풀에서 가져오기
-            index = m_availableIndices.front();
-            m_availableIndices.pop();
+            if (CreateNewCommandList(allocator) == UINT32_MAX)
+            {
+                return CommandListLease();
+            }
+            // 워밍업 이후 계속 생성되면 누수 신호이므로 요약만 남김
+            LOG_DEBUG_FIRST_N(LogCategory::Renderer, 8, L"Created new CommandList (pool size: {})",
+                              m_commandListPool.size());
         }
 
-        auto* commandList = m_commandListPool[index].Get();
-        auto* allocator = m_allocators[m_currentFrameIndex].Get();
+        // 풀에서 가져오기 (최근 반환된 것부터)
+        const uint32_t index = m_availableIndices.back();
+        m_availableIndices.pop_back();
+
+        CommandListLease lease;
+        lease.commandList = m_commandListPool[index].Get();
+        lease.poolIndex = index;
+        lease.allocatorSlot = allocatorSlot;
 
-        // CommandList Reset (현재 프레임의 Allocator와 연결)
-        HRESULT hr = commandList->Reset(allocator, pipelineState);
+        // CommandList Reset (이번 프레임의 Allocator와 연결)
+        HRESULT hr = lease.commandList->Reset(allocator, pipelineState);
         if (FAILED(hr))
         {
             LOG_ERROR(LogCategory::Renderer,
                       L"Failed to reset CommandList (HRESULT: {:#x})",
                       static_cast<uint32_t>(hr));
             // 실패 시 다시 풀에 반환
-            m_availableIndices.push(index);
-            return nullptr;
+            m_availableIndices.push_back(index);
+            return CommandListLease();
         }
 
-        return commandList;
+        m_leased[index] = 1;
+        return lease;
     }
 
-    void CommandListManager::ReturnCommandList(ID3D12GraphicsCommandList* commandList)
+    bool CommandListManager::BeginParallelRecording(uint32_t contextCount, ID3D12PipelineState* pipelineState)
     {
-        if (!commandList)
+        if (!m_initialized || m_frameAllocators.empty())
         {
-            return;
+            LOG_ERROR(LogCategory::Renderer, L"CommandListManager::BeginParallelRecording - no frame in progress");
+            return false;
         }
 
-        // 풀에서 해당 CommandList의 인덱스 찾기
-        for (size_t i = 0; i < m_commandListPool.size(); i++)
+        if (!m_recordingLeases.empty())
         {
-            if (m_commandListPool[i].Get() == commandList)
+            LOG_ERROR(LogCategory::Renderer,
+                      L"CommandListManager::BeginParallelRecording - previous recording not ended");
+            return false;
+        }
+
+        if (contextCount == 0 || contextCount > kMaxRecordingContexts)
+        {
+            LOG_ERROR(LogCategory::Renderer,
+                      L"CommandListManager::BeginParallelRecording - invalid context count {} (max {})",
+                      contextCount, kMaxRecordingContexts);
+            return false;
+        }
+
+        // 이번 프레임에 필요한 만큼 컨텍스트 Allocator 대여 (같은 프레임의 다음 병렬 기록은 재사용)
+        // 작업 스레드가 기록을 보고하기 전에 크기를 확정해 두어야 재할당이 없음
+        while (m_frameAllocators.size() < 1 + contextCount)
+        {
+            ID3D12CommandAllocator* allocator = m_allocatorPool.Acquire(m_completedFenceValue);
+            if (!allocator)
             {
-                m_availableIndices.push(i);
-                return;
+                return false;
             }
+            m_frameAllocators.push_back({ allocator, 0 });
         }
 
-        LOG_WARNING(LogCategory::Renderer,
-                    L"ReturnCommandList - CommandList not found in pool");
+        m_recordingLeases.reserve(contextCount);
+        for (uint32_t i = 0; i < contextCount; i++)
+        {
+            CommandListLease lease = AcquireCommandList(1 + i, pipelineState);
+            if (!lease.IsValid())
+            {
+                // 이미 Reset한 리스트는 닫아서 풀에 반환
+                for (const CommandListLease& acquired : m_recordingLeases)
+                {
+                    acquired->Close();
+                }
+                EndParallelRecording();
+                return false;
+            }
+            m_recordingLeases.push_back(lease);
+        }
+
+        return true;
     }
 
-    ID3D12CommandAllocator* CommandListManager::GetCurrentAllocator() const
+    ID3D12GraphicsCommandList* CommandListManager::GetRecordingContext(uint32_t index) const
     {
-        if (!m_initialized)
+        if (index >= m_recordingLeases.size())
         {
             return nullptr;
         }
-        return m_allocators[m_currentFrameIndex].Get();
+        return m_recordingLeases[index].commandList;
+    }
+
+    CommandListLease CommandListManager::GetRecordingLease(uint32_t index) const
+    {
+        if (index >= m_recordingLeases.size())
+        {
+            return CommandListLease();
+        }
+        return m_recordingLeases[index];
+    }
+
+    void CommandListManager::GetParallelCommandLists(std::vector<ID3D12CommandList*>& outCommandLists) const
+    {
+        for (const CommandListLease& lease : m_recordingLeases)
+        {
+            outCommandLists.push_back(lease.commandList);
+        }
+    }
+
+    void CommandListManager::EndParallelRecording()
+    {
+        for (const CommandListLease& lease : m_recordingLeases)
+        {
+            ReturnCommandList(lease);
+        }
+        m_recordingLeases.clear();
     }
 
-    size_t CommandListManager::CreateNewCommandList()
+    uint32_t CommandListManager::CreateNewCommandList(ID3D12CommandAllocator* allocator)
     {
         ComPtr<ID3D12GraphicsCommandList> commandList;
 
-        // 현재 프레임의 Allocator로 생성
         HRESULT hr = m_device->CreateCommandList(
             0,
             m_type,
-            m_allocators[m_currentFrameIndex].Get(),
+            allocator,
             nullptr,
             IID_PPV_ARGS(&commandList));
 
@@ -228,15 +400,16 @@ namespace DX12GameEngine
             LOG_ERROR(LogCategory::Renderer,
                       L"Failed to create CommandList (HRESULT: {:#x})",
                       static_cast<uint32_t>(hr));
-            return SIZE_MAX;
+            return UINT32_MAX;
         }
 
         // 생성 직후 Close (Initial 상태로)
         commandList->Close();
 
-        size_t index = m_commandListPool.size();
+        const uint32_t index = static_cast<uint32_t>(m_commandListPool.size());
         m_commandListPool.push_back(commandList);
-        m_availableIndices.push(index);
+        m_leased.push_back(0);
+        m_availableIndices.push_back(index);
 
         return index;
     }
@@ -2,37 +2,78 @@
  * @file CommandListManager.h
  * @brief Command Allocator와 Command List 풀링 관리
  *
- * 프레임 기반 Allocator 풀링과 CommandList 재사용을 관리합니다.
- * Triple Buffering(3프레임)을 기본으로 사용합니다.
+ * Fence 기반 Allocator 풀과 CommandList 재사용을 관리합니다.
+ * 동시 처리 프레임 수는 기본 3프레임이며, 실행 중에 1 ~ kMaxFramesInFlight로 바꿀 수 있습니다.
+ * 여러 스레드가 동시에 기록할 수 있도록 기록 컨텍스트마다 Allocator를 따로 빌립니다.
  */
 
 #pragma once
 
+#include "CommandAllocatorPool.h"
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <vector>
-#include <queue>
 #include <cstdint>
 
 namespace DX12GameEngine
 {
     using Microsoft::WRL::ComPtr;
 
-    /** @brief 동시 처리 가능한 최대 프레임 수 */
-    static constexpr uint32_t kMaxFramesInFlight = 3;
+    class FenceTimeline;
+
+    /** @brief 동시 처리 가능한 최대 프레임 수 (런타임 설정의 상한) */
+    static constexpr uint32_t kMaxFramesInFlight = 4;
+
+    /** @brief 기본 동시 처리 프레임 수 */
+    static constexpr uint32_t kDefaultFramesInFlight = 3;
+
+    /** @brief 한 번에 병렬로 기록할 수 있는 최대 컨텍스트 수 */
+    static constexpr uint32_t kMaxRecordingContexts = 64;
+
+    /**
+     * @brief 대여한 CommandList 핸들
+     *
+     * 풀 내 인덱스를 함께 들고 있어 O(1)로 반환됩니다.
+     * ->로 CommandList 메서드를 바로 호출할 수 있습니다.
+     */
+    struct CommandListLease
+    {
+        ID3D12GraphicsCommandList* commandList;
+        uint32_t poolIndex;         // CommandList 풀 내 인덱스
+        uint32_t allocatorSlot;     // 이번 프레임 Allocator 슬롯 (0: 메인, 1 + i: 병렬 컨텍스트 i)
+
+        CommandListLease()
+            : commandList(nullptr)
+            , poolIndex(UINT32_MAX)
+            , allocatorSlot(0)
+        {
+        }
+
+        bool IsValid() const { return commandList != nullptr; }
+        ID3D12GraphicsCommandList* Get() const { return commandList; }
+        ID3D12GraphicsCommandList* operator->() const { return commandList; }
+    };
 
     /**
      * @brief Command Allocator와 Command List 풀링 관리자
      *
-     * 프레임 기반으로 Allocator를 관리하고, CommandList를 풀링하여
-     * 효율적인 재사용을 지원합니다.
+     * Allocator는 프레임 슬롯에 고정되지 않고 CommandAllocatorPool에서 빌려,
+     * EndFrame에서 Fence 값과 함께 반환합니다. CommandList는 임대 핸들로 빌려주고 O(1)로 돌려받습니다.
      *
      * 사용 흐름:
      * 1. BeginFrame() - 현재 프레임의 Allocator 준비
-     * 2. GetCommandList() - CommandList 획득
+     * 2. GetCommandList() - CommandList 임대
      * 3. 명령 기록 후 Close()
      * 4. ReturnCommandList() - CommandList 반환
-     * 5. EndFrame() - 프레임 종료 및 Fence 값 기록
+     * 5. EndFrame() - 프레임 종료, 이번 프레임의 Allocator를 Fence 값과 함께 풀에 반환
+     *
+     * 병렬 기록 흐름 (BeginFrame과 EndFrame 사이, 메인 스레드에서 호출):
+     * 1. BeginParallelRecording(N) - 컨텍스트 N개 준비 (각자 전용 Allocator로 Reset된 CommandList)
+     * 2. 작업 스레드 i가 GetRecordingContext(i)에 기록하고 Close()
+     * 3. 모든 작업 스레드 합류 후 GetParallelCommandLists() - 컨텍스트 순서대로 수집
+     * 4. ExecuteCommandLists 한 번으로 제출 후 EndParallelRecording() - CommandList 반환
+     *
+     * 풀과 Allocator 관리는 메인 스레드 전용이며, 작업 스레드는 자기 컨텍스트에만 기록합니다.
      */
     class CommandListManager
     {
@@ -59,7 +100,7 @@ namespace DX12GameEngine
         /**
          * @brief 프레임 시작
          *
-         * 현재 프레임의 Allocator가 GPU에서 사용 완료되었는지 확인하고 Reset합니다.
+         * GetFramesInFlight() 프레임 전의 Fence를 기다리고, 완료된 Allocator를 풀에서 빌립니다.
          * 매 프레임 렌더링 시작 시 호출해야 합니다.
          *
          * @param fence 동기화용 Fence
@@ -67,67 +108,178 @@ namespace DX12GameEngine
          */
         void BeginFrame(ID3D12Fence* fence, HANDLE fenceEvent);
 
+        /**
+         * @brief BeginFrame 대기에 사용할 FenceTimeline 설정 (nullptr이면 Fence 이벤트로 직접 대기)
+         * @param timeline 공용 Fence 대기 서비스 (이 관리자보다 오래 살아 있어야 함)
+         */
+        void SetFenceTimeline(FenceTimeline* timeline) { m_fenceTimeline = timeline; }
+
         /**
          * @brief 프레임 종료
          *
-         * 현재 프레임의 Fence 값을 기록하고 다음 프레임으로 이동합니다.
+         * 이번 프레임에 빌린 Allocator를 Fence 값과 함께 풀에 반환하고 다음 프레임으로 이동합니다.
          *
          * @param fenceValue 현재 프레임의 Fence 값
          */
         void EndFrame(uint64_t fenceValue);
 
         /**
-         * @brief CommandList 획득
+         * @brief CommandList 임대
          *
          * 풀에서 사용 가능한 CommandList를 가져옵니다.
          * 없으면 새로 생성합니다.
          * 반환된 CommandList는 이미 Reset된 상태입니다.
          *
          * @param pipelineState 초기 파이프라인 상태 (선택적)
-         * @return CommandList 포인터 (실패 시 nullptr)
+         * @return 임대 핸들 (실패 시 IsValid() == false)
          */
-        ID3D12GraphicsCommandList* GetCommandList(ID3D12PipelineState* pipelineState = nullptr);
+        CommandListLease GetCommandList(ID3D12PipelineState* pipelineState = nullptr);
 
         /**
-         * @brief CommandList 반환
+         * @brief CommandList 반환 (O(1))
          *
-         * 사용 완료된 CommandList를 풀에 반환합니다.
-         * Close() 호출 후에 반환해야 합니다.
+         * Close() 후, ExecuteCommandLists에 제출한 다음 반환해야 합니다.
          *
-         * @param commandList 반환할 CommandList
+         * @param lease GetCommandList가 반환한 임대 핸들
          */
-        void ReturnCommandList(ID3D12GraphicsCommandList* commandList);
+        void ReturnCommandList(const CommandListLease& lease);
 
         /**
-         * @brief 현재 프레임의 Allocator 가져오기
-         * @return 현재 프레임의 CommandAllocator
+         * @brief 임대한 CommandList에 기록한 명령 수 보고 (Allocator 크기 추적용 추정치)
+         *
+         * 작업 스레드는 자기 컨텍스트의 임대 핸들에 대해서만 호출할 수 있습니다.
+         *
+         * @param lease 기록한 CommandList의 임대 핸들
+         * @param commandCount 기록한 명령 수 (드로우/디스패치 등)
+         */
+        void ReportRecordedCommands(const CommandListLease& lease, uint32_t commandCount);
+
+        /**
+         * @brief 현재 프레임의 메인 Allocator 가져오기
+         * @return 현재 프레임의 CommandAllocator (BeginFrame 전이면 nullptr)
          */
         ID3D12CommandAllocator* GetCurrentAllocator() const;
 
+        /**
+         * @brief 동시 처리 프레임 수 변경 (프레임 사이에 호출, 재시작 불필요)
+         *
+         * 최근 kMaxFramesInFlight 프레임의 Fence 값을 계속 기록하므로 바로 다음 BeginFrame부터 적용됩니다.
+         * 줄이면 다음 BeginFrame이 더 최근 프레임을 기다리고, 늘리면 기다림 없이 더 앞서 기록합니다.
+         *
+         * @param framesInFlight 동시 처리 프레임 수 (1 ~ kMaxFramesInFlight)
+         * @return 성공 시 true (범위 밖이거나 프레임 기록 중이면 false)
+         */
+        bool SetFramesInFlight(uint32_t framesInFlight);
+
+        /**
+         * @brief 동시 처리 프레임 수
+         */
+        uint32_t GetFramesInFlight() const { return m_framesInFlight; }
+
         /**
          * @brief 현재 프레임 인덱스 가져오기
-         * @return 현재 프레임 인덱스 (0 ~ kMaxFramesInFlight-1)
+         *
+         * 프레임 수를 바꾸면 인덱스 순환이 달라지므로, 이 인덱스로 나눈 프레임별 리소스는
+         * GPU 완료를 기다린 뒤 바꿔야 합니다.
+         *
+         * @return 현재 프레임 인덱스 (0 ~ GetFramesInFlight()-1)
          */
-        uint32_t GetCurrentFrameIndex() const { return m_currentFrameIndex; }
+        uint32_t GetCurrentFrameIndex() const { return static_cast<uint32_t>(m_frameCount % m_framesInFlight); }
+
+        /**
+         * @brief 병렬 기록 시작
+         *
+         * 컨텍스트마다 이번 프레임의 전용 Allocator로 CommandList를 Reset해 둡니다.
+         * 메인 Allocator(GetCommandList)와 겹치지 않으므로 메인 스레드도 동시에 기록할 수 있습니다.
+         * 한 프레임에 여러 번 호출할 수 있지만, 이전 병렬 기록을 EndParallelRecording으로 끝낸 뒤여야 합니다.
+         *
+         * @param contextCount 컨텍스트 수 (1 ~ kMaxRecordingContexts)
+         * @param pipelineState 초기 파이프라인 상태 (선택적)
+         * @return 성공 시 true
+         */
+        bool BeginParallelRecording(uint32_t contextCount, ID3D12PipelineState* pipelineState = nullptr);
+
+        /**
+         * @brief 기록 컨텍스트의 CommandList (작업 스레드 하나가 전용으로 사용)
+         * @param index 컨텍스트 인덱스 (0 ~ GetRecordingContextCount()-1)
+         * @return CommandList 포인터 (범위 밖이면 nullptr)
+         */
+        ID3D12GraphicsCommandList* GetRecordingContext(uint32_t index) const;
+
+        /**
+         * @brief 기록 컨텍스트의 임대 핸들 (ReportRecordedCommands용)
+         * @param index 컨텍스트 인덱스 (0 ~ GetRecordingContextCount()-1)
+         * @return 임대 핸들 (범위 밖이면 IsValid() == false)
+         */
+        CommandListLease GetRecordingLease(uint32_t index) const;
+
+        /**
+         * @brief 현재 병렬 기록의 컨텍스트 수
+         */
+        uint32_t GetRecordingContextCount() const { return static_cast<uint32_t>(m_recordingLeases.size()); }
+
+        /**
+         * @brief 기록이 끝난(Close된) CommandList를 컨텍스트 순서대로 추가
+         *
+         * 스레드 완료 순서와 무관하게 항상 같은 순서이므로 실행 결과가 결정적입니다.
+         *
+         * @param outCommandLists ExecuteCommandLists에 넘길 배열 (뒤에 추가)
+         */
+        void GetParallelCommandLists(std::vector<ID3D12CommandList*>& outCommandLists) const;
+
+        /**
+         * @brief 병렬 기록 종료 (ExecuteCommandLists 이후 호출, CommandList를 풀에 반환)
+         */
+        void EndParallelRecording();
+
+        /**
+         * @brief Allocator 풀 가져오기 (통계 확인용)
+         */
+        const CommandAllocatorPool& GetAllocatorPool() const { return m_allocatorPool; }
 
     private:
+        /**
+         * @brief 이번 프레임에 빌린 Allocator
+         */
+        struct FrameAllocator
+        {
+            ID3D12CommandAllocator* allocator;
+            uint64_t recordedCommands;      // ReportRecordedCommands 누적 (크기 추적용)
+        };
+
         /**
          * @brief 새 CommandList 생성
-         * @return 생성된 CommandList의 풀 내 인덱스
+         * @param allocator 생성에 사용할 Allocator (생성 직후 Close하므로 기록은 남지 않음)
+         * @return 생성된 CommandList의 풀 내 인덱스 (실패 시 UINT32_MAX)
          */
-        size_t CreateNewCommandList();
+        uint32_t CreateNewCommandList(ID3D12CommandAllocator* allocator);
+
+        /**
+         * @brief 풀에서 CommandList를 꺼내 Allocator 슬롯으로 Reset
+         * @return 임대 핸들 (실패 시 IsValid() == false)
+         */
+        CommandListLease AcquireCommandList(uint32_t allocatorSlot, ID3D12PipelineState* pipelineState);
 
         ID3D12Device* m_device;
         D3D12_COMMAND_LIST_TYPE m_type;
         bool m_initialized;
+        FenceTimeline* m_fenceTimeline;
+
+        // Allocator 풀과 이번 프레임에 빌린 Allocator ([0]: 메인, [1 + i]: 병렬 컨텍스트 i)
+        CommandAllocatorPool m_allocatorPool;
+        std::vector<FrameAllocator> m_frameAllocators;
+        uint32_t m_lastFrameAllocatorCount;     // 유휴 Allocator를 이만큼만 남기고 정리 (첫 프레임은 메인 1개)
+        uint64_t m_completedFenceValue;         // BeginFrame 시점에 GPU가 완료한 Fence 값
 
-        // 프레임별 Allocator (Triple Buffering)
-        ComPtr<ID3D12CommandAllocator> m_allocators[kMaxFramesInFlight];
-        uint64_t m_fenceValues[kMaxFramesInFlight];
-        uint32_t m_currentFrameIndex;
+        // 프레임 페이싱 (m_framesInFlight 프레임 전의 Fence를 기다림)
+        uint64_t m_fenceValues[kMaxFramesInFlight];     // 최근 프레임의 Fence 값 (m_frameCount % kMaxFramesInFlight 위치)
+        uint64_t m_frameCount;                          // EndFrame까지 마친 프레임 수
+        uint32_t m_framesInFlight;
 
         // CommandList 풀
         std::vector<ComPtr<ID3D12GraphicsCommandList>> m_commandListPool;
-        std::queue<size_t> m_availableIndices;  // 사용 가능한 CommandList 인덱스
+        std::vector<uint32_t> m_availableIndices;   // 사용 가능한 CommandList 인덱스 (스택)
+        std::vector<uint8_t> m_leased;               // 인덱스별 임대 여부 (이중 반환 검출)
+        std::vector<CommandListLease> m_recordingLeases;    // 현재 병렬 기록의 컨텍스트 순서
     };
 }
@@ -4,7 +4,10 @@
  */
 
 #include "CommandQueue.h"
+#include "FenceTimeline.h"
 #include <Utils/Logger.h>
+#include <algorithm>
+#include <chrono>
 
 namespace DX12GameEngine
 {
@@ -13,6 +16,8 @@ namespace DX12GameEngine
         , m_fenceEvent(nullptr)
         , m_type(D3D12_COMMAND_LIST_TYPE_DIRECT)
         , m_initialized(false)
+        , m_fenceTimeline(nullptr)
+        , m_nextSequence(0)
     {
     }
 
@@ -112,6 +117,88 @@ namespace DX12GameEngine
         m_queue->ExecuteCommandLists(count, commandLists);
     }
 
+    void CommandQueue::Enqueue(ID3D12CommandList* commandList, uint64_t sortKey)
+    {
+        Enqueue(&commandList, 1, sortKey);
+    }
+
+    void CommandQueue::Enqueue(ID3D12CommandList* const* commandLists, uint32_t count, uint64_t firstSortKey)
+    {
+        if (!commandLists || count == 0)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (!commandLists[i])
+            {
+                LOG_WARNING(LogCategory::Renderer, L"CommandQueue::Enqueue - null CommandList skipped");
+                continue;
+            }
+            m_pending.push_back({ firstSortKey + i, m_nextSequence++, commandLists[i] });
+        }
+    }
+
+    uint64_t CommandQueue::FlushSubmissions()
+    {
+        if (!m_initialized || !m_queue)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"CommandQueue::FlushSubmissions - not initialized");
+            return 0;
+        }
+
+        // 쌓인 묶음을 통째로 가져옴 (이후 Enqueue는 다음 묶음으로)
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            if (m_pending.empty())
+            {
+                return m_fenceValue;
+            }
+            m_submitBatch.swap(m_pending);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        // 스레드 완료 순서와 무관하게 정렬 키 순서로 실행
+        std::sort(m_submitBatch.begin(), m_submitBatch.end(),
+                  [](const PendingSubmission& a, const PendingSubmission& b)
+                  {
+                      return a.sortKey != b.sortKey ? a.sortKey < b.sortKey : a.sequence < b.sequence;
+                  });
+
+        m_submitLists.clear();
+        for (const PendingSubmission& submission : m_submitBatch)
+        {
+            m_submitLists.push_back(submission.commandList);
+        }
+
+        const uint32_t listCount = static_cast<uint32_t>(m_submitLists.size());
+        m_queue->ExecuteCommandLists(listCount, m_submitLists.data());
+        const uint64_t fenceValue = Signal();
+
+        const double elapsedMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+
+        m_submitBatch.clear();
+
+        m_submissionStats.submitCount++;
+        m_submissionStats.listCount += listCount;
+        m_submissionStats.lastListCount = listCount;
+        m_submissionStats.maxListCount = std::max(m_submissionStats.maxListCount, listCount);
+        m_submissionStats.totalSubmitMs += elapsedMs;
+        m_submissionStats.lastSubmitMs = elapsedMs;
+
+        return fenceValue;
+    }
+
+    uint32_t CommandQueue::GetPendingSubmissionCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        return static_cast<uint32_t>(m_pending.size());
+    }
+
     uint64_t CommandQueue::Signal()
     {
         if (!m_initialized || !m_queue || !m_fence)
@@ -137,6 +224,13 @@ namespace DX12GameEngine
             return;
         }
 
+        if (m_fenceTimeline && m_fenceTimeline->IsRunning())
+        {
+            // 기다리는 동안 완료된 콜백 처리
+            m_fenceTimeline->Wait(m_fence.Get(), fenceValue);
+            return;
+        }
+
         if (m_fence->GetCompletedValue() < fenceValue)
         {
             HRESULT hr = m_fence->SetEventOnCompletion(fenceValue, m_fenceEvent);
@@ -150,6 +244,21 @@ namespace DX12GameEngine
         }
     }
 
+    void CommandQueue::WaitForQueue(const CommandQueue& other, uint64_t fenceValue)
+    {
+        if (!m_initialized || !m_queue || !other.GetFence())
+        {
+            LOG_ERROR(LogCategory::Renderer, L"CommandQueue::WaitForQueue - not initialized");
+            return;
+        }
+
+        HRESULT hr = m_queue->Wait(other.GetFence(), fenceValue);
+        if (FAILED(hr))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to wait for queue fence (HRESULT: {:#x})", static_cast<uint32_t>(hr));
+        }
+    }
+
     void CommandQueue::Flush()
     {
         uint64_t fenceValue = Signal();
@@ -4,6 +4,7 @@
  *
  * GPU에 작업을 제출하는 커맨드 큐를 관리합니다.
  * Fence를 통한 CPU-GPU 동기화도 담당합니다.
+ * 여러 스레드가 닫힌 CommandList를 정렬 키와 함께 쌓아 두면, 한 번의 제출과 한 번의 시그널로 내보냅니다.
  */
 
 #pragma once
@@ -11,16 +12,61 @@
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <cstdint>
+#include <mutex>
+#include <vector>
 
 namespace DX12GameEngine
 {
     using Microsoft::WRL::ComPtr;
 
+    class FenceTimeline;
+
+    /**
+     * @brief 묶음 제출 통계 (FlushSubmissions 기준)
+     */
+    struct SubmissionStats
+    {
+        uint64_t submitCount;       // 비어 있지 않은 FlushSubmissions 횟수
+        uint64_t listCount;         // 제출한 CommandList 누적 수
+        uint32_t lastListCount;     // 마지막 묶음의 CommandList 수
+        uint32_t maxListCount;      // 한 묶음의 최대 CommandList 수
+        double totalSubmitMs;       // 정렬 + ExecuteCommandLists + Signal CPU 시간 누적
+        double lastSubmitMs;        // 마지막 묶음의 CPU 시간
+
+        SubmissionStats()
+            : submitCount(0)
+            , listCount(0)
+            , lastListCount(0)
+            , maxListCount(0)
+            , totalSubmitMs(0.0)
+            , lastSubmitMs(0.0)
+        {
+        }
+
+        /** @brief 제출당 평균 CommandList 수 */
+        double GetAverageListsPerSubmit() const
+        {
+            return submitCount > 0 ? static_cast<double>(listCount) / static_cast<double>(submitCount) : 0.0;
+        }
+
+        /** @brief 제출당 평균 CPU 시간 (ms) */
+        double GetAverageSubmitMs() const
+        {
+            return submitCount > 0 ? totalSubmitMs / static_cast<double>(submitCount) : 0.0;
+        }
+    };
+
     /**
      * @brief DirectX 12 커맨드 큐를 관리하는 클래스
      *
      * 단일 커맨드 큐와 관련된 Fence를 관리합니다.
      * Direct, Compute, Copy 타입을 지원합니다.
+     *
+     * 묶음 제출 흐름:
+     * 1. 생산자 스레드가 Close한 CommandList를 Enqueue(list, sortKey) (여러 스레드에서 동시 호출 가능)
+     * 2. 메인 스레드의 제출 지점에서 FlushSubmissions() - 정렬 키 순서로 한 번에 실행하고 한 번만 시그널
+     *
+     * ExecuteCommandLists / Signal / FlushSubmissions는 메인 스레드에서만 호출합니다.
      */
     class CommandQueue
     {
@@ -49,6 +95,49 @@ namespace DX12GameEngine
          */
         void ExecuteCommandLists(ID3D12CommandList* const* commandLists, uint32_t count);
 
+        /**
+         * @brief 닫힌 CommandList를 다음 묶음 제출에 추가 (스레드 안전)
+         *
+         * 정렬 키가 작은 것부터 실행되며, 같은 키는 추가된 순서를 유지합니다.
+         * CommandList는 FlushSubmissions가 끝날 때까지 반환하거나 Reset하면 안 됩니다.
+         *
+         * @param commandList Close된 커맨드 리스트
+         * @param sortKey 실행 순서 키 (예: 패스 순서 << 32 | 컨텍스트 인덱스)
+         */
+        void Enqueue(ID3D12CommandList* commandList, uint64_t sortKey);
+
+        /**
+         * @brief 여러 CommandList를 연속된 정렬 키로 추가 (스레드 안전)
+         * @param commandLists 커맨드 리스트 배열
+         * @param count 커맨드 리스트 개수
+         * @param firstSortKey 첫 리스트의 정렬 키 (i번째는 firstSortKey + i)
+         */
+        void Enqueue(ID3D12CommandList* const* commandLists, uint32_t count, uint64_t firstSortKey);
+
+        /**
+         * @brief 쌓인 CommandList를 정렬해 ExecuteCommandLists 한 번으로 제출하고 한 번 시그널
+         *
+         * 제출 중에도 다른 스레드는 다음 묶음에 Enqueue할 수 있습니다.
+         *
+         * @return 이번 묶음의 Fence 값 (쌓인 것이 없으면 시그널하지 않고 마지막 Fence 값)
+         */
+        uint64_t FlushSubmissions();
+
+        /**
+         * @brief 다음 묶음에 쌓인 CommandList 수 (스레드 안전)
+         */
+        uint32_t GetPendingSubmissionCount() const;
+
+        /**
+         * @brief 묶음 제출 통계
+         */
+        const SubmissionStats& GetSubmissionStats() const { return m_submissionStats; }
+
+        /**
+         * @brief 묶음 제출 통계 초기화
+         */
+        void ResetSubmissionStats() { m_submissionStats = SubmissionStats(); }
+
         /**
          * @brief GPU에 시그널 전송
          * @return 시그널된 Fence 값
@@ -57,15 +146,34 @@ namespace DX12GameEngine
 
         /**
          * @brief 특정 Fence 값까지 CPU 대기
+         *
+         * FenceTimeline이 설정되어 있으면 기다리는 동안 완료된 Fence 콜백을 실행합니다.
+         *
          * @param fenceValue 대기할 Fence 값
          */
         void WaitForFenceValue(uint64_t fenceValue);
 
+        /**
+         * @brief 다른 큐의 Fence 값까지 GPU에서 대기 (CPU는 블로킹하지 않음)
+         *
+         * 이후 이 큐에 제출하는 작업은 other가 fenceValue를 완료한 뒤에 실행됩니다.
+         *
+         * @param other 기다릴 큐 (예: 업로드용 복사 큐)
+         * @param fenceValue other의 Fence 값
+         */
+        void WaitForQueue(const CommandQueue& other, uint64_t fenceValue);
+
         /**
          * @brief 모든 GPU 작업 완료 대기
          */
         void Flush();
 
+        /**
+         * @brief 대기에 사용할 FenceTimeline 설정 (nullptr이면 Fence 이벤트로 직접 대기)
+         * @param timeline 공용 Fence 대기 서비스 (이 큐보다 오래 살아 있어야 함)
+         */
+        void SetFenceTimeline(FenceTimeline* timeline) { m_fenceTimeline = timeline; }
+
         /**
          * @brief 현재 Fence 값 조회
          * @return 마지막으로 시그널된 Fence 값
@@ -122,11 +230,30 @@ namespace DX12GameEngine
             ID3D12PipelineState* pipelineState = nullptr);
 
     private:
+        /**
+         * @brief 제출 대기 중인 CommandList
+         */
+        struct PendingSubmission
+        {
+            uint64_t sortKey;
+            uint64_t sequence;      // 같은 키에서 추가 순서 유지
+            ID3D12CommandList* commandList;
+        };
+
         ComPtr<ID3D12CommandQueue> m_queue;
         ComPtr<ID3D12Fence> m_fence;
         uint64_t m_fenceValue;
         HANDLE m_fenceEvent;
         D3D12_COMMAND_LIST_TYPE m_type;
         bool m_initialized;
+        FenceTimeline* m_fenceTimeline;
+
+        // 묶음 제출 (생산자는 m_pending에만 추가, 제출 지점에서 통째로 교체해 잠금 구간 최소화)
+        mutable std::mutex m_pendingMutex;
+        std::vector<PendingSubmission> m_pending;
+        uint64_t m_nextSequence;
+        std::vector<PendingSubmission> m_submitBatch;       // 제출 중인 묶음 (메인 스레드 전용, 용량 재사용)
+        std::vector<ID3D12CommandList*> m_submitLists;
+        SubmissionStats m_submissionStats;
     };
 }
@@ -0,0 +1,498 @@
+/**
+ * @file D3D12CommandTranslator.cpp
+ * @brief 렌더 명령 스트림 D3D12 번역기 구현
+ */
+
+#include "D3D12CommandTranslator.h"
+#include <Utils/Logger.h>
+#include <cstring>
+
+namespace DX12GameEngine
+{
+    namespace
+    {
+        bool IsSameIndexBuffer(const IndexBufferBinding& a, const IndexBufferBinding& b)
+        {
+            return a.gpuAddress == b.gpuAddress && a.sizeInBytes == b.sizeInBytes && a.format == b.format;
+        }
+
+        bool IsSameVertexBuffer(const VertexBufferBinding& a, const VertexBufferBinding& b)
+        {
+            return a.gpuAddress == b.gpuAddress && a.sizeInBytes == b.sizeInBytes && a.strideInBytes == b.strideInBytes;
+        }
+
+        bool IsSameViewport(const RenderViewport& a, const RenderViewport& b)
+        {
+            return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height &&
+                   a.minDepth == b.minDepth && a.maxDepth == b.maxDepth;
+        }
+
+        bool IsSameRect(const RenderRect& a, const RenderRect& b)
+        {
+            return a.left == b.left && a.top == b.top && a.right == b.right && a.bottom == b.bottom;
+        }
+
+        /**
+         * @brief [offset, offset + count) 구간의 비트마스크 (count는 1 ~ 64)
+         */
+        uint64_t GetRangeMask(uint32_t offset, uint32_t count)
+        {
+            const uint64_t bits = count >= 64 ? ~0ull : (1ull << count) - 1;
+            return bits << offset;
+        }
+    }
+
+    D3D12CommandTranslator::D3D12CommandTranslator()
+        : m_state{}
+        , m_stateFilteringEnabled(true)
+        , m_translatedCommandCount(0)
+    {
+    }
+
+    void D3D12CommandTranslator::Translate(const RenderCommandStream& stream, ID3D12GraphicsCommandList* commandList)
+    {
+        if (!commandList)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"D3D12CommandTranslator::Translate - command list is null");
+            return;
+        }
+
+        // 이전 번역 이후 CommandList가 Reset되었거나 직접 기록되었을 수 있음
+        InvalidateState();
+
+        for (const RenderCommandHeader& header : stream)
+        {
+            bool issued = true;
+
+            switch (header.type)
+            {
+            case RenderCommandType::SetPipelineState:
+                issued = ApplySetPipelineState(header.As<RenderCommand::SetPipelineState>(), commandList);
+                break;
+            case RenderCommandType::SetRootSignature:
+                issued = ApplySetRootSignature(header.As<RenderCommand::SetRootSignature>(), commandList);
+                break;
+            case RenderCommandType::SetDescriptorHeaps:
+                issued = ApplySetDescriptorHeaps(header.As<RenderCommand::SetDescriptorHeaps>(), commandList);
+                break;
+            case RenderCommandType::SetRootDescriptorTable:
+                issued = ApplySetRootDescriptorTable(header.As<RenderCommand::SetRootDescriptorTable>(), commandList);
+                break;
+            case RenderCommandType::SetRootConstants:
+                issued = ApplySetRootConstants(header.As<RenderCommand::SetRootConstants>(), commandList);
+                break;
+            case RenderCommandType::SetPrimitiveTopology:
+                issued = ApplySetPrimitiveTopology(header.As<RenderCommand::SetPrimitiveTopology>(), commandList);
+                break;
+            case RenderCommandType::SetVertexBuffers:
+                issued = ApplySetVertexBuffers(header.As<RenderCommand::SetVertexBuffers>(), commandList);
+                break;
+            case RenderCommandType::SetIndexBuffer:
+                issued = ApplySetIndexBuffer(header.As<RenderCommand::SetIndexBuffer>(), commandList);
+                break;
+            case RenderCommandType::SetViewport:
+                issued = ApplySetViewport(header.As<RenderCommand::SetViewport>(), commandList);
+                break;
+            case RenderCommandType::SetScissorRect:
+                issued = ApplySetScissorRect(header.As<RenderCommand::SetScissorRect>(), commandList);
+                break;
+            case RenderCommandType::SetRenderTargets:
+                issued = ApplySetRenderTargets(header.As<RenderCommand::SetRenderTargets>(), commandList);
+                break;
+            case RenderCommandType::ClearRenderTarget:
+            {
+                const auto& command = header.As<RenderCommand::ClearRenderTarget>();
+                commandList->ClearRenderTargetView(D3D12_CPU_DESCRIPTOR_HANDLE{ static_cast<SIZE_T>(command.renderTarget) },
+                                                   command.color, 0, nullptr);
+                break;
+            }
+            case RenderCommandType::ClearDepthStencil:
+            {
+                const auto& command = header.As<RenderCommand::ClearDepthStencil>();
+                D3D12_CLEAR_FLAGS flags = static_cast<D3D12_CLEAR_FLAGS>(0);
+                if (command.clearDepth)
+                {
+                    flags |= D3D12_CLEAR_FLAG_DEPTH;
+                }
+                if (command.clearStencil)
+                {
+                    flags |= D3D12_CLEAR_FLAG_STENCIL;
+                }
+                commandList->ClearDepthStencilView(D3D12_CPU_DESCRIPTOR_HANDLE{ static_cast<SIZE_T>(command.depthStencil) },
+                                                   flags, command.depth, command.stencil, 0, nullptr);
+                break;
+            }
+            case RenderCommandType::ResourceBarrier:
+                TranslateResourceBarrier(header.As<RenderCommand::ResourceBarrier>(), commandList);
+                break;
+            case RenderCommandType::Draw:
+            {
+                const auto& command = header.As<RenderCommand::Draw>();
+                commandList->DrawInstanced(command.vertexCount, command.instanceCount, command.startVertex,
+                                           command.startInstance);
+                break;
+            }
+            case RenderCommandType::DrawIndexed:
+            {
+                const auto& command = header.As<RenderCommand::DrawIndexed>();
+                commandList->DrawIndexedInstanced(command.indexCount, command.instanceCount, command.startIndex,
+                                                  command.baseVertex, command.startInstance);
+                break;
+            }
+            case RenderCommandType::Dispatch:
+            {
+                const auto& command = header.As<RenderCommand::Dispatch>();
+                commandList->Dispatch(command.groupCountX, command.groupCountY, command.groupCountZ);
+                break;
+            }
+            default:
+                LOG_ERROR(LogCategory::Renderer, L"D3D12CommandTranslator::Translate - unknown command type {}",
+                          static_cast<uint32_t>(header.type));
+                break;
+            }
+
+            if (!issued)
+            {
+                m_frameStats.elidedCount++;
+                m_frameStats.elidedByType[static_cast<uint32_t>(header.type)]++;
+            }
+        }
+
+        m_frameStats.commandCount += stream.GetCommandCount();
+        m_translatedCommandCount += stream.GetCommandCount();
+    }
+
+    void D3D12CommandTranslator::EndFrame()
+    {
+        m_lastFrameStats = m_frameStats;
+        m_frameStats = CommandTranslationStats();
+    }
+
+    void D3D12CommandTranslator::InvalidateState()
+    {
+        m_state.rootSignatureValid = false;
+        m_state.pipelineStateValid = false;
+        m_state.topologyValid = false;
+        m_state.descriptorHeapsValid = false;
+        m_state.indexBufferValid = false;
+        m_state.viewportValid = false;
+        m_state.scissorRectValid = false;
+        m_state.renderTargetsValid = false;
+        m_state.vertexBufferValidMask = 0;
+        InvalidateRootArguments();
+    }
+
+    void D3D12CommandTranslator::InvalidateRootArguments()
+    {
+        m_state.rootTableValidMask = 0;
+        std::memset(m_state.rootConstantValidMasks, 0, sizeof(m_state.rootConstantValidMasks));
+    }
+
+    bool D3D12CommandTranslator::ApplySetPipelineState(const RenderCommand::SetPipelineState& command,
+                                                       ID3D12GraphicsCommandList* commandList)
+    {
+        if (m_stateFilteringEnabled && m_state.pipelineStateValid && m_state.pipelineState == command.pipelineState)
+        {
+            return false;
+        }
+
+        commandList->SetPipelineState(FromRenderHandle<ID3D12PipelineState>(command.pipelineState));
+        m_state.pipelineState = command.pipelineState;
+        m_state.pipelineStateValid = true;
+        return true;
+    }
+
+    bool D3D12CommandTranslator::ApplySetRootSignature(const RenderCommand::SetRootSignature& command,
+                                                       ID3D12GraphicsCommandList* commandList)
+    {
+        // 같은 루트 시그니처를 다시 설정하면 루트 인자가 유지되므로 그대로 버려도 됨
+        if (m_stateFilteringEnabled && m_state.rootSignatureValid && m_state.rootSignature == command.rootSignature)
+        {
+            return false;
+        }
+
+        commandList->SetGraphicsRootSignature(FromRenderHandle<ID3D12RootSignature>(command.rootSignature));
+        m_state.rootSignature = command.rootSignature;
+        m_state.rootSignatureValid = true;
+        InvalidateRootArguments();
+        return true;
+    }
+
+    bool D3D12CommandTranslator::ApplySetDescriptorHeaps(const RenderCommand::SetDescriptorHeaps& command,
+                                                         ID3D12GraphicsCommandList* commandList)
+    {
+        const uint32_t count = command.count < kMaxDescriptorHeaps ? command.count : kMaxDescriptorHeaps;
+        if (m_stateFilteringEnabled && m_state.descriptorHeapsValid && m_state.descriptorHeapCount == count &&
+            std::memcmp(m_state.descriptorHeaps, command.GetHeaps(), count * sizeof(RenderHandle)) == 0)
+        {
+            return false;
+        }
+
+        ID3D12DescriptorHeap* heaps[kMaxDescriptorHeaps] = {};
+        for (uint32_t i = 0; i < count; i++)
+        {
+            heaps[i] = FromRenderHandle<ID3D12DescriptorHeap>(command.GetHeaps()[i]);
+            m_state.descriptorHeaps[i] = command.GetHeaps()[i];
+        }
+        commandList->SetDescriptorHeaps(count, heaps);
+
+        m_state.descriptorHeapCount = count;
+        m_state.descriptorHeapsValid = true;
+
+        // 힙이 바뀌면 이전 힙을 가리키던 디스크립터 테이블은 다시 설정해야 함
+        m_state.rootTableValidMask = 0;
+        return true;
+    }
+
+    bool D3D12CommandTranslator::ApplySetRootDescriptorTable(const RenderCommand::SetRootDescriptorTable& command,
+                                                             ID3D12GraphicsCommandList* commandList)
+    {
+        const uint32_t index = command.rootParameterIndex;
+        const bool tracked = index < kMaxRootParameters;
+        const uint64_t bit = tracked ? 1ull << index : 0;
+
+        if (m_stateFilteringEnabled && tracked && (m_state.rootTableValidMask & bit) != 0 &&
+            m_state.rootTables[index] == command.gpuDescriptor)
+        {
+            return false;
+        }
+
+        commandList->SetGraphicsRootDescriptorTable(index, D3D12_GPU_DESCRIPTOR_HANDLE{ command.gpuDescriptor });
+        if (tracked)
+        {
+            m_state.rootTables[index] = command.gpuDescriptor;
+            m_state.rootTableValidMask |= bit;
+        }
+        return true;
+    }
+
+    bool D3D12CommandTranslator::ApplySetRootConstants(const RenderCommand::SetRootConstants& command,
+                                                       ID3D12GraphicsCommandList* commandList)
+    {
+        const uint32_t index = command.rootParameterIndex;
+        const uint32_t offset = command.destOffset;
+        const uint32_t count = command.count;
+        const bool tracked = index < kMaxRootParameters && count > 0 && offset + count <= kMaxRootConstants;
+
+        if (tracked)
+        {
+            const uint64_t range = GetRangeMask(offset, count);
+            uint32_t* values = m_state.rootConstants[index] + offset;
+
+            if (m_stateFilteringEnabled && (m_state.rootConstantValidMasks[index] & range) == range &&
+                std::memcmp(values, command.GetValues(), count * sizeof(uint32_t)) == 0)
+            {
+                return false;
+            }
+
+            std::memcpy(values, command.GetValues(), count * sizeof(uint32_t));
+            m_state.rootConstantValidMasks[index] |= range;
+        }
+        else if (index < kMaxRootParameters)
+        {
+            m_state.rootConstantValidMasks[index] = 0;
+        }
+
+        commandList->SetGraphicsRoot32BitConstants(index, count, command.GetValues(), offset);
+        return true;
+    }
+
+    bool D3D12CommandTranslator::ApplySetPrimitiveTopology(const RenderCommand::SetPrimitiveTopology& command,
+                                                           ID3D12GraphicsCommandList* commandList)
+    {
+        if (m_stateFilteringEnabled && m_state.topologyValid && m_state.topology == command.topology)
+        {
+            return false;
+        }
+
+        commandList->IASetPrimitiveTopology(ToD3D12(command.topology));
+        m_state.topology = command.topology;
+        m_state.topologyValid = true;
+        return true;
+    }
+
+    bool D3D12CommandTranslator::ApplySetVertexBuffers(const RenderCommand::SetVertexBuffers& command,
+                                                       ID3D12GraphicsCommandList* commandList)
+    {
+        const uint32_t startSlot = command.startSlot < kMaxVertexBuffers ? command.startSlot : kMaxVertexBuffers;
+        const uint32_t count = command.count < kMaxVertexBuffers - startSlot ? command.count : kMaxVertexBuffers - startSlot;
+        if (count == 0)
+        {
+            return false;
+        }
+
+        const uint32_t range = static_cast<uint32_t>(GetRangeMask(startSlot, count));
+        if (m_stateFilteringEnabled && (m_state.vertexBufferValidMask & range) == range)
+        {
+            bool same = true;
+            for (uint32_t i = 0; i < count && same; i++)
+            {
+                same = IsSameVertexBuffer(m_state.vertexBuffers[startSlot + i], command.GetBindings()[i]);
+            }
+            if (same)
+            {
+                return false;
+            }
+        }
+
+        D3D12_VERTEX_BUFFER_VIEW views[kMaxVertexBuffers];
+        for (uint32_t i = 0; i < count; i++)
+        {
+            const VertexBufferBinding& binding = command.GetBindings()[i];
+            views[i].BufferLocation = binding.gpuAddress;
+            views[i].SizeInBytes = binding.sizeInBytes;
+            views[i].StrideInBytes = binding.strideInBytes;
+            m_state.vertexBuffers[startSlot + i] = binding;
+        }
+        commandList->IASetVertexBuffers(startSlot, count, views);
+
+        m_state.vertexBufferValidMask |= range;
+        return true;
+    }
+
+    bool D3D12CommandTranslator::ApplySetIndexBuffer(const RenderCommand::SetIndexBuffer& command,
+                                                     ID3D12GraphicsCommandList* commandList)
+    {
+        if (m_stateFilteringEnabled && m_state.indexBufferValid && IsSameIndexBuffer(m_state.indexBuffer, command.binding))
+        {
+            return false;
+        }
+
+        D3D12_INDEX_BUFFER_VIEW view = {};
+        view.BufferLocation = command.binding.gpuAddress;
+        view.SizeInBytes = command.binding.sizeInBytes;
+        view.Format = command.binding.format == IndexFormat::Uint16 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+        commandList->IASetIndexBuffer(&view);
+
+        m_state.indexBuffer = command.binding;
+        m_state.indexBufferValid = true;
+        return true;
+    }
+
+    bool D3D12CommandTranslator::ApplySetViewport(const RenderCommand::SetViewport& command,
+                                                  ID3D12GraphicsCommandList* commandList)
+    {
+        const RenderViewport& source = command.viewport;
+        if (m_stateFilteringEnabled && m_state.viewportValid && IsSameViewport(m_state.viewport, source))
+        {
+            return false;
+        }
+
+        const D3D12_VIEWPORT viewport = { source.x, source.y, source.width, source.height,
+                                          source.minDepth, source.maxDepth };
+        commandList->RSSetViewports(1, &viewport);
+
+        m_state.viewport = source;
+        m_state.viewportValid = true;
+        return true;
+    }
+
+    bool D3D12CommandTranslator::ApplySetScissorRect(const RenderCommand::SetScissorRect& command,
+                                                     ID3D12GraphicsCommandList* commandList)
+    {
+        const RenderRect& source = command.rect;
+        if (m_stateFilteringEnabled && m_state.scissorRectValid && IsSameRect(m_state.scissorRect, source))
+        {
+            return false;
+        }
+
+        const D3D12_RECT rect = { source.left, source.top, source.right, source.bottom };
+        commandList->RSSetScissorRects(1, &rect);
+
+        m_state.scissorRect = source;
+        m_state.scissorRectValid = true;
+        return true;
+    }
+
+    bool D3D12CommandTranslator::ApplySetRenderTargets(const RenderCommand::SetRenderTargets& command,
+                                                       ID3D12GraphicsCommandList* commandList)
+    {
+        if (m_stateFilteringEnabled && m_state.renderTargetsValid && m_state.renderTargetCount == command.count &&
+            m_state.depthStencil == command.depthStencil &&
+            std::memcmp(m_state.renderTargets, command.GetRenderTargets(), command.count * sizeof(uint64_t)) == 0)
+        {
+            return false;
+        }
+
+        D3D12_CPU_DESCRIPTOR_HANDLE renderTargets[kMaxRenderTargets];
+        for (uint32_t i = 0; i < command.count; i++)
+        {
+            renderTargets[i].ptr = static_cast<SIZE_T>(command.GetRenderTargets()[i]);
+            m_state.renderTargets[i] = command.GetRenderTargets()[i];
+        }
+        const D3D12_CPU_DESCRIPTOR_HANDLE depthStencil = { static_cast<SIZE_T>(command.depthStencil) };
+        commandList->OMSetRenderTargets(command.count, renderTargets, FALSE,
+                                        command.depthStencil != 0 ? &depthStencil : nullptr);
+
+        m_state.renderTargetCount = command.count;
+        m_state.depthStencil = command.depthStencil;
+        m_state.renderTargetsValid = true;
+        return true;
+    }
+
+    void D3D12CommandTranslator::TranslateResourceBarrier(const RenderCommand::ResourceBarrier& command,
+                                                          ID3D12GraphicsCommandList* commandList)
+    {
+        m_barriers.resize(command.count);
+        for (uint32_t i = 0; i < command.count; i++)
+        {
+            const RenderBarrier& source = command.GetBarriers()[i];
+            D3D12_RESOURCE_BARRIER& barrier = m_barriers[i];
+            barrier = {};
+            barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+            barrier.Transition.pResource = FromRenderHandle<ID3D12Resource>(source.resource);
+            barrier.Transition.StateBefore = ToD3D12(source.before);
+            barrier.Transition.StateAfter = ToD3D12(source.after);
+            barrier.Transition.Subresource = source.subresource;
+        }
+        commandList->ResourceBarrier(command.count, m_barriers.data());
+    }
+
+    D3D_PRIMITIVE_TOPOLOGY D3D12CommandTranslator::ToD3D12(PrimitiveTopology topology)
+    {
+        switch (topology)
+        {
+        case PrimitiveTopology::PointList:
+            return D3D_PRIMITIVE_TOPOLOGY_POINTLIST;
+        case PrimitiveTopology::LineList:
+            return D3D_PRIMITIVE_TOPOLOGY_LINELIST;
+        case PrimitiveTopology::LineStrip:
+            return D3D_PRIMITIVE_TOPOLOGY_LINESTRIP;
+        case PrimitiveTopology::TriangleStrip:
+            return D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
+        default:
+            return D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+        }
+    }
+
+    D3D12_RESOURCE_STATES D3D12CommandTranslator::ToD3D12(ResourceState state)
+    {
+        switch (state)
+        {
+        case ResourceState::Present:
+            return D3D12_RESOURCE_STATE_PRESENT;
+        case ResourceState::RenderTarget:
+            return D3D12_RESOURCE_STATE_RENDER_TARGET;
+        case ResourceState::DepthWrite:
+            return D3D12_RESOURCE_STATE_DEPTH_WRITE;
+        case ResourceState::DepthRead:
+            return D3D12_RESOURCE_STATE_DEPTH_READ;
+        case ResourceState::ShaderResource:
+            return D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+        case ResourceState::UnorderedAccess:
+            return D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+        case ResourceState::CopySource:
+            return D3D12_RESOURCE_STATE_COPY_SOURCE;
+        case ResourceState::CopyDest:
+            return D3D12_RESOURCE_STATE_COPY_DEST;
+        case ResourceState::VertexAndConstantBuffer:
+            return D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER;
+        case ResourceState::IndexBuffer:
+            return D3D12_RESOURCE_STATE_INDEX_BUFFER;
+        case ResourceState::IndirectArgument:
+            return D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT;
+        default:
+            return D3D12_RESOURCE_STATE_COMMON;
+        }
+    }
+}
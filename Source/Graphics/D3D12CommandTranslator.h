@@ -0,0 +1,210 @@
+/**
+ * @file D3D12CommandTranslator.h
+ * @brief 렌더 명령 스트림을 D3D12 CommandList로 번역
+ *
+ * RenderCommandStream을 처음부터 끝까지 재생하며 명령마다 대응하는
+ * ID3D12GraphicsCommandList 메서드를 호출합니다. 핸들은 D3D12 객체 포인터로,
+ * 디스크립터 값은 D3D12_CPU/GPU_DESCRIPTOR_HANDLE::ptr로 해석합니다.
+ *
+ * 번역기는 CommandList에 설정된 상태(루트 시그니처, PSO, 토폴로지, 버텍스 / 인덱스 버퍼,
+ * 디스크립터 힙, 루트 인자, 뷰포트, 시저, 렌더 타겟)를 섀도로 추적해, 새 상태를 설정하지 않는
+ * 명령은 API를 호출하지 않고 버립니다. 드로우마다 같은 상태를 다시 기록해도 API 호출은 바뀐 만큼만 나갑니다.
+ * - 루트 시그니처가 바뀌면 루트 인자 섀도를 비움 (D3D12에서 기존 인자가 무효화됨)
+ * - 디스크립터 힙이 바뀌면 디스크립터 테이블 섀도를 비움
+ * - Translate 시작 시 모든 섀도를 비움 (호출자가 직접 기록한 상태를 알 수 없으므로)
+ *
+ * 다른 백엔드(Vulkan 등)는 같은 스트림에 대한 번역기만 추가하면 됩니다.
+ */
+
+#pragma once
+
+#include "RenderCommandStream.h"
+#include <d3d12.h>
+#include <cstdint>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 번역 통계 (상태 중복 제거 효과)
+     */
+    struct CommandTranslationStats
+    {
+        uint32_t commandCount;                              // 번역한 명령 수
+        uint32_t elidedCount;                               // 중복이라 버린 명령 수
+        uint32_t elidedByType[kRenderCommandTypeCount];     // 종류별 버린 명령 수
+
+        CommandTranslationStats()
+            : commandCount(0)
+            , elidedCount(0)
+            , elidedByType{}
+        {
+        }
+
+        /** @brief 실제로 호출한 API 수 */
+        uint32_t GetIssuedCount() const { return commandCount - elidedCount; }
+
+        /** @brief 버린 명령 비율 (0 ~ 1) */
+        double GetElidedRatio() const
+        {
+            return commandCount > 0 ? static_cast<double>(elidedCount) / static_cast<double>(commandCount) : 0.0;
+        }
+    };
+
+    /**
+     * @brief D3D12 명령 번역기
+     *
+     * 사용 예시:
+     * @code
+     * stream.Reset();
+     * stream.SetPipelineState(ToRenderHandle(pso));
+     * stream.Draw(3, 1, 0, 0);
+     * translator.Translate(stream, commandList);
+     * commandList->Close();
+     * @endcode
+     */
+    class D3D12CommandTranslator
+    {
+    public:
+        D3D12CommandTranslator();
+
+        // 복사 및 이동 금지
+        D3D12CommandTranslator(const D3D12CommandTranslator&) = delete;
+        D3D12CommandTranslator& operator=(const D3D12CommandTranslator&) = delete;
+        D3D12CommandTranslator(D3D12CommandTranslator&&) = delete;
+        D3D12CommandTranslator& operator=(D3D12CommandTranslator&&) = delete;
+
+        /**
+         * @brief 스트림의 모든 명령을 CommandList에 기록
+         * @param stream 재생할 스트림
+         * @param commandList 기록 중인 그래픽 CommandList
+         */
+        void Translate(const RenderCommandStream& stream, ID3D12GraphicsCommandList* commandList);
+
+        /**
+         * @brief 프레임 종료 (이번 프레임 통계를 GetLastFrameStats로 옮기고 비움)
+         */
+        void EndFrame();
+
+        /**
+         * @brief 상태 중복 제거 켜기 / 끄기 (비교 측정용, 기본값 켬)
+         */
+        void SetStateFilteringEnabled(bool enabled) { m_stateFilteringEnabled = enabled; }
+        bool IsStateFilteringEnabled() const { return m_stateFilteringEnabled; }
+
+        /**
+         * @brief 지금까지 번역한 명령 수 (누적)
+         */
+        uint64_t GetTranslatedCommandCount() const { return m_translatedCommandCount; }
+
+        /**
+         * @brief 진행 중인 프레임의 번역 통계
+         */
+        const CommandTranslationStats& GetFrameStats() const { return m_frameStats; }
+
+        /**
+         * @brief 마지막으로 끝난 프레임의 번역 통계
+         */
+        const CommandTranslationStats& GetLastFrameStats() const { return m_lastFrameStats; }
+
+        /**
+         * @brief 프리미티브 토폴로지 변환
+         */
+        static D3D_PRIMITIVE_TOPOLOGY ToD3D12(PrimitiveTopology topology);
+
+        /**
+         * @brief 리소스 상태 변환
+         */
+        static D3D12_RESOURCE_STATES ToD3D12(ResourceState state);
+
+        /** @brief 섀도로 추적하는 최대 루트 파라미터 수 (루트 시그니처 최대 크기 64 DWORD) */
+        static constexpr uint32_t kMaxRootParameters = 64;
+
+        /** @brief 루트 파라미터 하나의 최대 32비트 상수 수 */
+        static constexpr uint32_t kMaxRootConstants = 64;
+
+        /** @brief 섀도로 추적하는 최대 디스크립터 힙 수 (CBV/SRV/UAV + Sampler) */
+        static constexpr uint32_t kMaxDescriptorHeaps = 2;
+
+        /** @brief 섀도로 추적하는 버텍스 버퍼 슬롯 수 */
+        static constexpr uint32_t kMaxVertexBuffers = D3D12_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT;
+
+    private:
+        /**
+         * @brief CommandList에 마지막으로 설정한 상태
+         *
+         * 각 항목은 valid 플래그(또는 비트마스크)가 켜진 동안만 의미가 있습니다.
+         */
+        struct StateShadow
+        {
+            bool rootSignatureValid;
+            bool pipelineStateValid;
+            bool topologyValid;
+            bool descriptorHeapsValid;
+            bool indexBufferValid;
+            bool viewportValid;
+            bool scissorRectValid;
+            bool renderTargetsValid;
+
+            RenderHandle rootSignature;
+            RenderHandle pipelineState;
+            PrimitiveTopology topology;
+
+            uint32_t descriptorHeapCount;
+            RenderHandle descriptorHeaps[kMaxDescriptorHeaps];
+
+            uint32_t vertexBufferValidMask;                         // 슬롯별 비트
+            VertexBufferBinding vertexBuffers[kMaxVertexBuffers];
+            IndexBufferBinding indexBuffer;
+
+            uint64_t rootTableValidMask;                            // 루트 파라미터별 비트
+            uint64_t rootTables[kMaxRootParameters];
+            uint64_t rootConstantValidMasks[kMaxRootParameters];    // 루트 파라미터별, 32비트 값 오프셋별 비트
+            uint32_t rootConstants[kMaxRootParameters][kMaxRootConstants];
+
+            RenderViewport viewport;
+            RenderRect scissorRect;
+
+            uint32_t renderTargetCount;
+            uint64_t renderTargets[kMaxRenderTargets];
+            uint64_t depthStencil;
+        };
+
+        /**
+         * @brief 모든 섀도 무효화 (CommandList 상태를 알 수 없을 때)
+         */
+        void InvalidateState();
+
+        /**
+         * @brief 루트 인자 섀도 무효화 (루트 시그니처 변경 시)
+         */
+        void InvalidateRootArguments();
+
+        // 상태 설정 명령: 섀도와 같으면 false를 반환하고 API를 호출하지 않음
+        bool ApplySetPipelineState(const RenderCommand::SetPipelineState& command, ID3D12GraphicsCommandList* commandList);
+        bool ApplySetRootSignature(const RenderCommand::SetRootSignature& command, ID3D12GraphicsCommandList* commandList);
+        bool ApplySetDescriptorHeaps(const RenderCommand::SetDescriptorHeaps& command, ID3D12GraphicsCommandList* commandList);
+        bool ApplySetRootDescriptorTable(const RenderCommand::SetRootDescriptorTable& command,
+                                         ID3D12GraphicsCommandList* commandList);
+        bool ApplySetRootConstants(const RenderCommand::SetRootConstants& command, ID3D12GraphicsCommandList* commandList);
+        bool ApplySetPrimitiveTopology(const RenderCommand::SetPrimitiveTopology& command,
+                                       ID3D12GraphicsCommandList* commandList);
+        bool ApplySetVertexBuffers(const RenderCommand::SetVertexBuffers& command, ID3D12GraphicsCommandList* commandList);
+        bool ApplySetIndexBuffer(const RenderCommand::SetIndexBuffer& command, ID3D12GraphicsCommandList* commandList);
+        bool ApplySetViewport(const RenderCommand::SetViewport& command, ID3D12GraphicsCommandList* commandList);
+        bool ApplySetScissorRect(const RenderCommand::SetScissorRect& command, ID3D12GraphicsCommandList* commandList);
+        bool ApplySetRenderTargets(const RenderCommand::SetRenderTargets& command, ID3D12GraphicsCommandList* commandList);
+
+        void TranslateResourceBarrier(const RenderCommand::ResourceBarrier& command,
+                                      ID3D12GraphicsCommandList* commandList);
+
+        StateShadow m_state;
+        bool m_stateFilteringEnabled;
+
+        std::vector<D3D12_RESOURCE_BARRIER> m_barriers;     // 배리어 변환 스크래치 (프레임 간 재사용)
+        uint64_t m_translatedCommandCount;
+
+        CommandTranslationStats m_frameStats;
+        CommandTranslationStats m_lastFrameStats;
+    };
+}
@@ -0,0 +1,95 @@
+/**
+ * @file DescriptorCopyBatch.cpp
+ * @brief CPU 디스크립터 → 셰이더 가시 힙 배치 복사 구현
+ */
+
+#include "DescriptorCopyBatch.h"
+
+namespace DX12GameEngine
+{
+    DescriptorCopyBatch::DescriptorCopyBatch()
+        : m_device(nullptr)
+        , m_type(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)
+        , m_descriptorSize(0)
+        , m_lastSourcePage(0)
+        , m_pendingCount(0)
+    {
+    }
+
+    DescriptorCopyBatch::~DescriptorCopyBatch()
+    {
+    }
+
+    void DescriptorCopyBatch::Initialize(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type)
+    {
+        m_device = device;
+        m_type = type;
+        m_descriptorSize = device ? device->GetDescriptorHandleIncrementSize(type) : 0;
+    }
+
+    void DescriptorCopyBatch::Add(D3D12_CPU_DESCRIPTOR_HANDLE destination, D3D12_CPU_DESCRIPTOR_HANDLE source,
+                                  uint32_t count, uint32_t sourcePage)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        AppendRange(m_destinationStarts, m_destinationSizes, destination, count, true);
+        AppendRange(m_sourceStarts, m_sourceSizes, source, count, sourcePage == m_lastSourcePage);
+        m_lastSourcePage = sourcePage;
+        m_pendingCount += count;
+    }
+
+    uint32_t DescriptorCopyBatch::Flush()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pendingCount == 0 || !m_device)
+        {
+            return 0;
+        }
+
+        if (m_destinationStarts.size() == 1 && m_sourceStarts.size() == 1)
+        {
+            m_device->CopyDescriptorsSimple(m_pendingCount, m_destinationStarts[0], m_sourceStarts[0], m_type);
+        }
+        else
+        {
+            m_device->CopyDescriptors(
+                static_cast<UINT>(m_destinationStarts.size()), m_destinationStarts.data(), m_destinationSizes.data(),
+                static_cast<UINT>(m_sourceStarts.size()), m_sourceStarts.data(), m_sourceSizes.data(),
+                m_type);
+        }
+
+        const uint32_t copied = m_pendingCount;
+
+        // 용량은 유지해 다음 프레임에 재할당하지 않음
+        m_destinationStarts.clear();
+        m_destinationSizes.clear();
+        m_sourceStarts.clear();
+        m_sourceSizes.clear();
+        m_pendingCount = 0;
+        return copied;
+    }
+
+    uint32_t DescriptorCopyBatch::GetPendingCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pendingCount;
+    }
+
+    void DescriptorCopyBatch::AppendRange(std::vector<D3D12_CPU_DESCRIPTOR_HANDLE>& starts, std::vector<UINT>& sizes,
+                                          D3D12_CPU_DESCRIPTOR_HANDLE start, uint32_t count, bool canMerge) const
+    {
+        if (canMerge && !starts.empty() &&
+            starts.back().ptr + static_cast<SIZE_T>(sizes.back()) * m_descriptorSize == start.ptr)
+        {
+            sizes.back() += count;
+            return;
+        }
+
+        starts.push_back(start);
+        sizes.push_back(count);
+    }
+}
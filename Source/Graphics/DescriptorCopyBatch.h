@@ -0,0 +1,90 @@
+/**
+ * @file DescriptorCopyBatch.h
+ * @brief CPU 디스크립터 → 셰이더 가시 힙 배치 복사
+ *
+ * 스테이징(셰이더 비가시) 힙에 만든 디스크립터를 셰이더 가시 힙으로 복사할 요청을 모아 두었다가
+ * Flush에서 ID3D12Device::CopyDescriptors 한 번으로 처리합니다.
+ *
+ * CopyDescriptors는 원본/대상 구간 배열을 각각 디스크립터 흐름으로 이어 붙여 복사하므로,
+ * 원본과 대상의 인접 구간을 서로 독립적으로 병합해 구간 수를 줄입니다.
+ * (예: 대상이 연속이면 원본이 흩어져 있어도 대상 구간은 하나)
+ * 원본 구간은 한 힙 안에 있어야 하므로, 원본은 같은 페이지일 때만 병합합니다.
+ */
+
+#pragma once
+
+#include <d3d12.h>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 디스크립터 복사 배치
+     */
+    class DescriptorCopyBatch
+    {
+    public:
+        DescriptorCopyBatch();
+        ~DescriptorCopyBatch();
+
+        // 복사 및 이동 금지
+        DescriptorCopyBatch(const DescriptorCopyBatch&) = delete;
+        DescriptorCopyBatch& operator=(const DescriptorCopyBatch&) = delete;
+        DescriptorCopyBatch(DescriptorCopyBatch&&) = delete;
+        DescriptorCopyBatch& operator=(DescriptorCopyBatch&&) = delete;
+
+        /**
+         * @brief 초기화
+         * @param device D3D12 디바이스
+         * @param type 복사할 디스크립터 타입 (CBV_SRV_UAV 또는 SAMPLER)
+         */
+        void Initialize(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type);
+
+        /**
+         * @brief 복사 요청 추가 (스레드 안전)
+         * @param destination 셰이더 가시 힙의 첫 대상 디스크립터
+         * @param source 셰이더 비가시 힙의 첫 원본 디스크립터
+         * @param count 연속 디스크립터 개수
+         * @param sourcePage 원본이 속한 힙(페이지) 식별자 (같은 값끼리만 원본 구간 병합)
+         */
+        void Add(D3D12_CPU_DESCRIPTOR_HANDLE destination, D3D12_CPU_DESCRIPTOR_HANDLE source,
+                 uint32_t count = 1, uint32_t sourcePage = 0);
+
+        /**
+         * @brief 모인 요청을 CopyDescriptors 한 번으로 복사
+         *
+         * 복사는 CPU에서 즉시 수행되므로, 해당 디스크립터를 참조하는 커맨드 리스트를
+         * 실행(ExecuteCommandLists)하기 전에 호출해야 합니다.
+         *
+         * @return 복사한 디스크립터 수
+         */
+        uint32_t Flush();
+
+        /**
+         * @brief 대기 중인 디스크립터 수
+         */
+        uint32_t GetPendingCount() const;
+
+    private:
+        /**
+         * @brief 병합 가능하고 인접한 구간이면 마지막 구간을 늘리고, 아니면 새 구간 추가
+         */
+        void AppendRange(std::vector<D3D12_CPU_DESCRIPTOR_HANDLE>& starts, std::vector<UINT>& sizes,
+                         D3D12_CPU_DESCRIPTOR_HANDLE start, uint32_t count, bool canMerge) const;
+
+    private:
+        ID3D12Device* m_device;
+        D3D12_DESCRIPTOR_HEAP_TYPE m_type;
+        uint32_t m_descriptorSize;
+
+        mutable std::mutex m_mutex;
+        std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> m_destinationStarts;
+        std::vector<UINT> m_destinationSizes;
+        std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> m_sourceStarts;
+        std::vector<UINT> m_sourceSizes;
+        uint32_t m_lastSourcePage;
+        uint32_t m_pendingCount;
+    };
+}
@@ -0,0 +1,213 @@
+/**
+ * @file DescriptorDedupCache.cpp
+ * @brief 내용 해시 기반 디스크립터 중복 제거 캐시 구현
+ */
+
+#include "DescriptorDedupCache.h"
+#include <Utils/Logger.h>
+#include <cstring>
+
+namespace DX12GameEngine
+{
+    static_assert(sizeof(D3D12_SAMPLER_DESC) <= 64, "D3D12_SAMPLER_DESC does not fit in dedup key");
+    static_assert(sizeof(ID3D12Resource*) + sizeof(D3D12_SHADER_RESOURCE_VIEW_DESC) <= 64,
+                  "SRV desc does not fit in dedup key");
+
+    DescriptorDedupCache::DescriptorDedupCache()
+        : m_device(nullptr)
+        , m_heap(nullptr)
+        , m_hitCount(0)
+        , m_missCount(0)
+        , m_initialized(false)
+    {
+    }
+
+    DescriptorDedupCache::~DescriptorDedupCache()
+    {
+        Shutdown();
+    }
+
+    bool DescriptorDedupCache::Initialize(ID3D12Device* device, DescriptorHeap* heap)
+    {
+        if (m_initialized)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"DescriptorDedupCache already initialized");
+            return true;
+        }
+
+        if (!device || !heap)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"DescriptorDedupCache::Initialize - invalid parameters");
+            return false;
+        }
+
+        m_device = device;
+        m_heap = heap;
+        m_hitCount = 0;
+        m_missCount = 0;
+        m_initialized = true;
+        return true;
+    }
+
+    void DescriptorDedupCache::Shutdown()
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& [key, entry] : m_entries)
+        {
+            m_heap->Free(entry.handle);
+        }
+
+        if (m_missCount > 0)
+        {
+            LOG_INFO(LogCategory::Renderer, L"DescriptorDedupCache: {} unique descriptors, {} shared requests",
+                     m_missCount, m_hitCount);
+        }
+
+        m_entries.clear();
+        m_keysByIndex.clear();
+        m_device = nullptr;
+        m_heap = nullptr;
+        m_initialized = false;
+    }
+
+    DescriptorHandle DescriptorDedupCache::AcquireSampler(const D3D12_SAMPLER_DESC& desc)
+    {
+        if (!m_initialized || m_heap->GetType() != D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"DescriptorDedupCache::AcquireSampler - not a sampler cache");
+            return DescriptorHandle();
+        }
+
+        const Key key = MakeKey(&desc, sizeof(desc), nullptr, 0);
+        return Acquire(key, [&](D3D12_CPU_DESCRIPTOR_HANDLE destination)
+        {
+            m_device->CreateSampler(&desc, destination);
+        });
+    }
+
+    DescriptorHandle DescriptorDedupCache::AcquireShaderResourceView(ID3D12Resource* resource,
+                                                                     const D3D12_SHADER_RESOURCE_VIEW_DESC* desc)
+    {
+        if (!m_initialized || m_heap->GetType() != D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"DescriptorDedupCache::AcquireShaderResourceView - not a CBV/SRV/UAV cache");
+            return DescriptorHandle();
+        }
+
+        if (!resource && !desc)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"DescriptorDedupCache::AcquireShaderResourceView - null descriptor needs a desc");
+            return DescriptorHandle();
+        }
+
+        // 기본 뷰(desc == nullptr)는 키 길이로 명시적 desc와 구분됨
+        const Key key = MakeKey(&resource, sizeof(resource), desc, desc ? sizeof(*desc) : 0);
+        return Acquire(key, [&](D3D12_CPU_DESCRIPTOR_HANDLE destination)
+        {
+            m_device->CreateShaderResourceView(resource, desc, destination);
+        });
+    }
+
+    bool DescriptorDedupCache::Release(const DescriptorHandle& handle, uint64_t fenceValue)
+    {
+        if (!m_initialized || !handle.IsValid())
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto keyIt = m_keysByIndex.find(handle.heapIndex);
+        if (keyIt == m_keysByIndex.end())
+        {
+            LOG_WARNING(LogCategory::Renderer, L"DescriptorDedupCache::Release - descriptor {} is not shared",
+                        handle.heapIndex);
+            return false;
+        }
+
+        auto entryIt = m_entries.find(keyIt->second);
+        if (--entryIt->second.refCount == 0)
+        {
+            // 이후 같은 내용을 요청하면 새 디스크립터를 만듦 (이전 것은 GPU가 다 읽은 뒤 반환)
+            m_heap->FreeDeferred(entryIt->second.handle, fenceValue);
+            m_entries.erase(entryIt);
+            m_keysByIndex.erase(keyIt);
+        }
+
+        return true;
+    }
+
+    uint32_t DescriptorDedupCache::GetUniqueCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return static_cast<uint32_t>(m_entries.size());
+    }
+
+    uint64_t DescriptorDedupCache::GetHitCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hitCount;
+    }
+
+    uint64_t DescriptorDedupCache::GetMissCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_missCount;
+    }
+
+    bool DescriptorDedupCache::Key::operator==(const Key& other) const
+    {
+        return hash == other.hash && size == other.size && std::memcmp(bytes, other.bytes, size) == 0;
+    }
+
+    DescriptorDedupCache::Key DescriptorDedupCache::MakeKey(const void* first, uint32_t firstSize,
+                                                            const void* second, uint32_t secondSize)
+    {
+        Key key = {};
+        key.size = firstSize + secondSize;
+        std::memcpy(key.bytes, first, firstSize);
+        if (secondSize > 0)
+        {
+            std::memcpy(key.bytes + firstSize, second, secondSize);
+        }
+
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ull;
+        for (uint32_t i = 0; i < key.size; i++)
+        {
+            hash = (hash ^ key.bytes[i]) * 1099511628211ull;
+        }
+        key.hash = hash;
+        return key;
+    }
+
+    template<typename CreateView>
+    DescriptorHandle DescriptorDedupCache::Acquire(const Key& key, CreateView&& createView)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_entries.find(key);
+        if (it != m_entries.end())
+        {
+            it->second.refCount++;
+            m_hitCount++;
+            return it->second.handle;
+        }
+
+        const DescriptorHandle handle = m_heap->Allocate();
+        if (!handle.IsValid())
+        {
+            return handle;
+        }
+
+        createView(handle.cpuHandle);
+        m_entries.emplace(key, Entry{ handle, 1 });
+        m_keysByIndex.emplace(handle.heapIndex, key);
+        m_missCount++;
+        return handle;
+    }
+}
@@ -0,0 +1,140 @@
+/**
+ * @file DescriptorDedupCache.h
+ * @brief 내용 해시 기반 디스크립터 중복 제거 캐시
+ *
+ * Sampler나 기본/null 뷰처럼 내용이 같은 디스크립터를 하나만 만들어 공유합니다.
+ * 같은 설명(desc)으로 요청하면 이미 만든 디스크립터를 참조 카운트와 함께 반환하므로,
+ * 작은 셰이더 가시 힙(특히 Sampler 힙)의 공간과 Create* 호출을 아낍니다.
+ *
+ * 디스크립터는 생성 후 바뀌지 않는다고 가정합니다 (불변 뷰만 등록).
+ * 마지막 참조가 해제되면 Fence 완료 후 힙에 반환합니다. 스레드 안전합니다.
+ */
+
+#pragma once
+
+#include "DescriptorHeap.h"
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 디스크립터 중복 제거 캐시 (힙 하나당 하나)
+     */
+    class DescriptorDedupCache
+    {
+    public:
+        DescriptorDedupCache();
+        ~DescriptorDedupCache();
+
+        // 복사 및 이동 금지
+        DescriptorDedupCache(const DescriptorDedupCache&) = delete;
+        DescriptorDedupCache& operator=(const DescriptorDedupCache&) = delete;
+        DescriptorDedupCache(DescriptorDedupCache&&) = delete;
+        DescriptorDedupCache& operator=(DescriptorDedupCache&&) = delete;
+
+        /**
+         * @brief 초기화
+         * @param device 디스크립터 생성에 사용할 디바이스
+         * @param heap 공유 디스크립터를 할당할 힙 (Sampler 또는 CBV/SRV/UAV)
+         * @return 성공 시 true
+         */
+        bool Initialize(ID3D12Device* device, DescriptorHeap* heap);
+
+        /**
+         * @brief 공유 디스크립터를 모두 힙에 반환 (GPU가 더 이상 참조하지 않아야 함)
+         */
+        void Shutdown();
+
+        /**
+         * @brief 같은 내용의 Sampler를 공유 (없으면 생성)
+         * @param desc Sampler 설명 (패딩까지 비교하므로 = {}로 초기화한 값을 사용)
+         * @return 디스크립터 핸들 (힙이 가득 차면 IsValid() == false)
+         */
+        DescriptorHandle AcquireSampler(const D3D12_SAMPLER_DESC& desc);
+
+        /**
+         * @brief 같은 리소스/설명의 불변 SRV를 공유 (없으면 생성)
+         * @param resource 대상 리소스 (nullptr이면 null 디스크립터, 이 경우 desc 필수)
+         * @param desc SRV 설명 (nullptr이면 리소스 기본 뷰, 패딩까지 비교하므로 = {}로 초기화한 값을 사용)
+         * @return 디스크립터 핸들 (힙이 가득 차면 IsValid() == false)
+         */
+        DescriptorHandle AcquireShaderResourceView(ID3D12Resource* resource, const D3D12_SHADER_RESOURCE_VIEW_DESC* desc);
+
+        /**
+         * @brief 참조 하나 반환 (마지막 참조면 fenceValue 완료 후 힙에 반환)
+         * @param handle Acquire*가 반환한 핸들
+         * @param fenceValue 마지막으로 이 디스크립터를 사용한 제출 이후의 Fence 값
+         * @return 캐시의 핸들이면 true
+         */
+        bool Release(const DescriptorHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief 캐시에 있는 서로 다른 디스크립터 수
+         */
+        uint32_t GetUniqueCount() const;
+
+        /**
+         * @brief 기존 디스크립터를 재사용한 요청 수
+         */
+        uint64_t GetHitCount() const;
+
+        /**
+         * @brief 새 디스크립터를 만든 요청 수
+         */
+        uint64_t GetMissCount() const;
+
+    private:
+        /**
+         * @brief 디스크립터 내용 키 (설명 구조체의 바이트)
+         */
+        struct Key
+        {
+            static constexpr uint32_t kMaxSize = 64;
+
+            uint8_t bytes[kMaxSize];
+            uint32_t size;
+            uint64_t hash;
+
+            bool operator==(const Key& other) const;
+        };
+
+        struct KeyHasher
+        {
+            size_t operator()(const Key& key) const { return static_cast<size_t>(key.hash); }
+        };
+
+        /**
+         * @brief 공유 디스크립터
+         */
+        struct Entry
+        {
+            DescriptorHandle handle;
+            uint32_t refCount;
+        };
+
+        /**
+         * @brief 두 바이트 구간을 이어 붙여 키 생성 (FNV-1a 해시)
+         */
+        static Key MakeKey(const void* first, uint32_t firstSize, const void* second, uint32_t secondSize);
+
+        /**
+         * @brief 키로 찾거나, 없으면 할당 후 createView로 디스크립터 생성 (m_mutex를 잡고 생성하므로
+         *        같은 키를 동시에 요청한 다른 스레드가 빈 디스크립터를 받지 않음)
+         */
+        template<typename CreateView>
+        DescriptorHandle Acquire(const Key& key, CreateView&& createView);
+
+    private:
+        ID3D12Device* m_device;
+        DescriptorHeap* m_heap;
+
+        mutable std::mutex m_mutex;
+        std::unordered_map<Key, Entry, KeyHasher> m_entries;
+        std::unordered_map<uint32_t, Key> m_keysByIndex;    // 힙 인덱스 → 키 (Release용)
+        uint64_t m_hitCount;
+        uint64_t m_missCount;
+        bool m_initialized;
+    };
+}
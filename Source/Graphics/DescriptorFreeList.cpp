@@ -0,0 +1,444 @@
+/**
+ * @file DescriptorFreeList.cpp
+ * @brief 계층 비트맵 프리 리스트 구현
+ */
+
+#include "DescriptorFreeList.h"
+#include <algorithm>
+#include <bit>
+
+namespace DX12GameEngine
+{
+    namespace
+    {
+        constexpr uint32_t kBitsPerWord = 64;
+        constexpr uint64_t kFullWord = ~0ull;
+
+        /**
+         * @brief 워드 안의 [bit, bit + count) 마스크
+         */
+        uint64_t MakeMask(uint32_t bit, uint32_t count)
+        {
+            return count >= kBitsPerWord ? kFullWord : ((1ull << count) - 1) << bit;
+        }
+    }
+
+    DescriptorFreeList::DescriptorFreeList()
+        : m_capacity(0)
+        , m_allocatedCount(0)
+        , m_rangeSearchWord(0)
+    {
+    }
+
+    void DescriptorFreeList::Initialize(uint32_t capacity)
+    {
+        m_capacity = capacity;
+        m_allocatedCount = 0;
+        m_rangeSearchWord = 0;
+
+        // 마지막 워드가 부분 워드면 완전히 빈 워드로 보지 않음
+        const uint32_t wordCount = (capacity + kBitsPerWord - 1) / kBitsPerWord;
+        m_freeBits.Initialize(capacity, true);
+        m_fullWords.Initialize(wordCount, true);
+
+        if (capacity % kBitsPerWord != 0)
+        {
+            m_fullWords.SetWord((wordCount - 1) / kBitsPerWord,
+                                m_fullWords.levels[0][(wordCount - 1) / kBitsPerWord] &
+                                ~(1ull << ((wordCount - 1) % kBitsPerWord)));
+        }
+    }
+
+    uint32_t DescriptorFreeList::Allocate()
+    {
+        if (m_allocatedCount >= m_capacity)
+        {
+            return kInvalidIndex;
+        }
+
+        const uint32_t index = m_freeBits.FindFirst();
+        if (index == kInvalidPosition)
+        {
+            return kInvalidIndex;
+        }
+
+        const uint32_t wordIndex = index / kBitsPerWord;
+        SetLeafWord(wordIndex, m_freeBits.levels[0][wordIndex] & ~(1ull << (index % kBitsPerWord)));
+        m_allocatedCount++;
+        return index;
+    }
+
+    uint32_t DescriptorFreeList::AllocateRange(uint32_t count)
+    {
+        if (count == 0 || count > m_capacity - m_allocatedCount)
+        {
+            return kInvalidIndex;
+        }
+
+        if (count == 1)
+        {
+            return Allocate();
+        }
+
+        uint32_t first = kInvalidIndex;
+        if (count <= kBitsPerWord)
+        {
+            // 1. 앞쪽 부분 워드의 빈틈을 먼저 채움 (짧게만 탐색)
+            first = FindRange(count, 0, kRangeProbeWords);
+
+            // 2. 완전히 빈 워드 사용 (O(log64 N))
+            if (first == kInvalidIndex)
+            {
+                const uint32_t fullWord = m_fullWords.FindFirst();
+                if (fullWord != kInvalidPosition)
+                {
+                    first = fullWord * kBitsPerWord;
+                }
+            }
+        }
+
+        // 3. 직전 위치부터 끝까지, 그다음 처음부터 탐색 (큰 구간, 또는 빈 워드가 없을 때)
+        if (first == kInvalidIndex)
+        {
+            first = FindRange(count, m_rangeSearchWord, UINT32_MAX);
+            if (first == kInvalidIndex && m_rangeSearchWord > 0)
+            {
+                first = FindRange(count, 0, UINT32_MAX);
+            }
+
+            if (first != kInvalidIndex)
+            {
+                m_rangeSearchWord = (first + count) / kBitsPerWord;
+            }
+        }
+
+        if (first == kInvalidIndex)
+        {
+            return kInvalidIndex;
+        }
+
+        AssignRange(first, count, false);
+        m_allocatedCount += count;
+        return first;
+    }
+
+    uint32_t DescriptorFreeList::AllocateBatch(uint32_t* outIndices, uint32_t count)
+    {
+        uint32_t allocated = 0;
+        while (allocated < count && m_allocatedCount + allocated < m_capacity)
+        {
+            // 첫 빈 워드에서 필요한 만큼 한 번에 가져감 (워드당 계층 갱신 한 번)
+            const uint32_t index = m_freeBits.FindFirst();
+            if (index == kInvalidPosition)
+            {
+                break;
+            }
+
+            const uint32_t wordIndex = index / kBitsPerWord;
+            uint64_t word = m_freeBits.levels[0][wordIndex];
+            while (word != 0 && allocated < count)
+            {
+                outIndices[allocated++] = wordIndex * kBitsPerWord + static_cast<uint32_t>(std::countr_zero(word));
+                word &= word - 1;
+            }
+            SetLeafWord(wordIndex, word);
+        }
+
+        m_allocatedCount += allocated;
+        return allocated;
+    }
+
+    uint32_t DescriptorFreeList::FreeBatch(const uint32_t* indices, uint32_t count)
+    {
+        uint32_t freed = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (Free(indices[i]))
+            {
+                freed++;
+            }
+        }
+        return freed;
+    }
+
+    bool DescriptorFreeList::Free(uint32_t index)
+    {
+        if (index >= m_capacity)
+        {
+            return false;
+        }
+
+        const uint32_t wordIndex = index / kBitsPerWord;
+        const uint64_t bit = 1ull << (index % kBitsPerWord);
+        const uint64_t word = m_freeBits.levels[0][wordIndex];
+        if ((word & bit) != 0)
+        {
+            return false;
+        }
+
+        SetLeafWord(wordIndex, word | bit);
+        m_allocatedCount--;
+        return true;
+    }
+
+    bool DescriptorFreeList::FreeRange(uint32_t first, uint32_t count)
+    {
+        if (count == 0 || static_cast<uint64_t>(first) + count > m_capacity ||
+            !IsRangeUniform(first, count, false))
+        {
+            return false;
+        }
+
+        AssignRange(first, count, true);
+        m_allocatedCount -= count;
+        return true;
+    }
+
+    bool DescriptorFreeList::IsAllocated(uint32_t index) const
+    {
+        return index < m_capacity &&
+               (m_freeBits.levels[0][index / kBitsPerWord] & (1ull << (index % kBitsPerWord))) == 0;
+    }
+
+    size_t DescriptorFreeList::GetMemoryUsage() const
+    {
+        return m_freeBits.GetMemoryUsage() + m_fullWords.GetMemoryUsage();
+    }
+
+    void DescriptorFreeList::SetLeafWord(uint32_t wordIndex, uint64_t value)
+    {
+        const uint64_t oldValue = m_freeBits.levels[0][wordIndex];
+        m_freeBits.SetWord(wordIndex, value);
+
+        // 워드 전체가 비었다/아니다가 바뀔 때만 요약 비트 갱신
+        if ((oldValue == kFullWord) != (value == kFullWord))
+        {
+            const uint32_t summaryWord = wordIndex / kBitsPerWord;
+            const uint64_t bit = 1ull << (wordIndex % kBitsPerWord);
+            const uint64_t summary = m_fullWords.levels[0][summaryWord];
+            m_fullWords.SetWord(summaryWord, value == kFullWord ? summary | bit : summary & ~bit);
+        }
+    }
+
+    uint32_t DescriptorFreeList::FindRange(uint32_t count, uint32_t startWord, uint32_t maxWords) const
+    {
+        const std::vector<uint64_t>& leaves = m_freeBits.levels[0];
+        const uint32_t wordCount = static_cast<uint32_t>(leaves.size());
+
+        uint32_t runStart = 0;
+        uint32_t runLength = 0;     // 이전 워드 끝에서 이어지는 연속 빈 비트 수
+
+        const uint32_t firstFree = startWord < wordCount ? m_freeBits.FindNextSet(0, startWord * kBitsPerWord)
+                                                         : kInvalidPosition;
+        uint32_t wordIndex = firstFree == kInvalidPosition ? wordCount : firstFree / kBitsPerWord;
+
+        for (uint32_t visited = 0; wordIndex < wordCount && visited < maxWords; visited++)
+        {
+            const uint64_t word = leaves[wordIndex];
+            const uint32_t base = wordIndex * kBitsPerWord;
+
+            if (word == kFullWord)
+            {
+                if (runLength == 0)
+                {
+                    runStart = base;
+                }
+                runLength += kBitsPerWord;
+            }
+            else
+            {
+                // 1. 이전 워드에서 이어지는 구간
+                const uint32_t trailing = static_cast<uint32_t>(std::countr_one(word));
+                if (runLength > 0 && runLength + trailing >= count)
+                {
+                    return runStart;
+                }
+
+                // 2. 워드 내부 구간: starts의 i번 비트 = i부터 count개가 모두 1
+                if (count <= kBitsPerWord)
+                {
+                    uint64_t starts = word;
+                    for (uint32_t length = 1; length < count && starts != 0;)
+                    {
+                        const uint32_t shift = std::min(length, count - length);
+                        starts &= starts >> shift;
+                        length += shift;
+                    }
+
+                    if (starts != 0)
+                    {
+                        return base + static_cast<uint32_t>(std::countr_zero(starts));
+                    }
+                }
+
+                // 3. 다음 워드로 이어질 구간
+                const uint32_t leading = static_cast<uint32_t>(std::countl_one(word));
+                runStart = base + kBitsPerWord - leading;
+                runLength = leading;
+            }
+
+            if (runLength >= count)
+            {
+                return runStart;
+            }
+
+            // 구간이 이어지는 중이면 다음 워드, 아니면 빈 비트가 있는 다음 워드로 건너뜀
+            if (runLength > 0)
+            {
+                wordIndex++;
+            }
+            else
+            {
+                const uint32_t next = m_freeBits.FindNextSet(0, (wordIndex + 1) * kBitsPerWord);
+                wordIndex = next == kInvalidPosition ? wordCount : next / kBitsPerWord;
+            }
+        }
+
+        return kInvalidIndex;
+    }
+
+    void DescriptorFreeList::AssignRange(uint32_t first, uint32_t count, bool free)
+    {
+        const uint32_t end = first + count;
+        for (uint32_t index = first; index < end;)
+        {
+            const uint32_t wordIndex = index / kBitsPerWord;
+            const uint32_t bit = index % kBitsPerWord;
+            const uint32_t bitCount = std::min(kBitsPerWord - bit, end - index);
+            const uint64_t mask = MakeMask(bit, bitCount);
+
+            const uint64_t word = m_freeBits.levels[0][wordIndex];
+            SetLeafWord(wordIndex, free ? word | mask : word & ~mask);
+            index += bitCount;
+        }
+    }
+
+    bool DescriptorFreeList::IsRangeUniform(uint32_t first, uint32_t count, bool free) const
+    {
+        const uint32_t end = first + count;
+        for (uint32_t index = first; index < end;)
+        {
+            const uint32_t wordIndex = index / kBitsPerWord;
+            const uint32_t bit = index % kBitsPerWord;
+            const uint32_t bitCount = std::min(kBitsPerWord - bit, end - index);
+            const uint64_t mask = MakeMask(bit, bitCount);
+
+            if ((m_freeBits.levels[0][wordIndex] & mask) != (free ? mask : 0))
+            {
+                return false;
+            }
+            index += bitCount;
+        }
+        return true;
+    }
+
+    void DescriptorFreeList::BitHierarchy::Initialize(uint32_t bitCount, bool value)
+    {
+        levels.clear();
+
+        // 최하위 레벨부터 워드 하나가 될 때까지 상위 레벨 생성
+        // 모든 하위 워드가 같은 값이므로 각 레벨은 "bits개의 value"로 채우면 됨
+        uint32_t bits = bitCount;
+        for (;;)
+        {
+            const uint32_t wordCount = std::max((bits + kBitsPerWord - 1) / kBitsPerWord, 1u);
+
+            std::vector<uint64_t> words(wordCount, value ? kFullWord : 0);
+            if (value && bits % kBitsPerWord != 0)
+            {
+                words.back() = MakeMask(0, bits % kBitsPerWord);
+            }
+            if (value && bits == 0)
+            {
+                words.back() = 0;
+            }
+            levels.push_back(std::move(words));
+
+            if (wordCount == 1)
+            {
+                break;
+            }
+            bits = wordCount;
+        }
+    }
+
+    uint32_t DescriptorFreeList::BitHierarchy::FindFirst() const
+    {
+        // 최상위 워드에서 시작해 레벨마다 첫 번째 1 비트를 따라 내려감
+        uint32_t position = 0;
+        for (size_t level = levels.size(); level-- > 0;)
+        {
+            const uint64_t word = levels[level][position];
+            if (word == 0)
+            {
+                return kInvalidPosition;
+            }
+            position = position * kBitsPerWord + static_cast<uint32_t>(std::countr_zero(word));
+        }
+        return position;
+    }
+
+    uint32_t DescriptorFreeList::BitHierarchy::FindNextSet(uint32_t level, uint32_t position) const
+    {
+        const std::vector<uint64_t>& words = levels[level];
+        const uint32_t wordIndex = position / kBitsPerWord;
+        if (wordIndex >= words.size())
+        {
+            return kInvalidPosition;
+        }
+
+        const uint64_t masked = words[wordIndex] & (kFullWord << (position % kBitsPerWord));
+        if (masked != 0)
+        {
+            return wordIndex * kBitsPerWord + static_cast<uint32_t>(std::countr_zero(masked));
+        }
+
+        // 현재 워드에 없으면 상위 레벨에서 비어 있지 않은 다음 워드를 찾음 (최상위는 워드 하나)
+        if (level + 1 >= levels.size())
+        {
+            return kInvalidPosition;
+        }
+
+        const uint32_t nextWord = FindNextSet(level + 1, wordIndex + 1);
+        if (nextWord == kInvalidPosition)
+        {
+            return kInvalidPosition;
+        }
+        return nextWord * kBitsPerWord + static_cast<uint32_t>(std::countr_zero(words[nextWord]));
+    }
+
+    void DescriptorFreeList::BitHierarchy::SetWord(uint32_t wordIndex, uint64_t value)
+    {
+        uint64_t oldValue = levels[0][wordIndex];
+        levels[0][wordIndex] = value;
+
+        // 워드가 0이 되거나 0에서 벗어날 때만 상위 비트가 바뀜
+        for (size_t level = 1; level < levels.size(); level++)
+        {
+            const bool wasEmpty = oldValue == 0;
+            const bool isEmpty = value == 0;
+            if (wasEmpty == isEmpty)
+            {
+                break;
+            }
+
+            const uint64_t bit = 1ull << (wordIndex % kBitsPerWord);
+            wordIndex /= kBitsPerWord;
+
+            uint64_t& parent = levels[level][wordIndex];
+            oldValue = parent;
+            parent = isEmpty ? parent & ~bit : parent | bit;
+            value = parent;
+        }
+    }
+
+    size_t DescriptorFreeList::BitHierarchy::GetMemoryUsage() const
+    {
+        size_t bytes = levels.capacity() * sizeof(std::vector<uint64_t>);
+        for (const std::vector<uint64_t>& words : levels)
+        {
+            bytes += words.capacity() * sizeof(uint64_t);
+        }
+        return bytes;
+    }
+}
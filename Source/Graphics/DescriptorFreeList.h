@@ -0,0 +1,174 @@
+/**
+ * @file DescriptorFreeList.h
+ * @brief 계층 비트맵 기반 디스크립터 인덱스 프리 리스트
+ *
+ * 디스크립터 인덱스마다 1비트(1 = 사용 가능)를 두고, 상위 레벨의 각 비트는
+ * 하위 레벨 64비트 워드에 사용 가능한 비트가 하나라도 있는지를 나타냅니다.
+ * find-first-set(countr_zero)으로 레벨당 워드 하나만 보고 빈 인덱스를 찾습니다.
+ *
+ * - 메모리: 디스크립터당 약 1비트 (1M개 기준 약 130KB, std::queue 방식은 4MB 이상)
+ * - 초기화: 워드 단위 채우기 (인덱스별 push 없음)
+ * - Allocate/Free: O(log64 N) (1M개 기준 4레벨)
+ * - AllocateBatch/FreeBatch: 여러 인덱스를 한 번에 할당/해제 (스레드별 캐시 보충/반환용)
+ * - AllocateRange/FreeRange: 연속 인덱스 할당/해제 (디스크립터 테이블용)
+ *   64개 이하 구간은 앞쪽 부분 워드를 짧게 탐색한 뒤, "완전히 빈 워드" 요약 비트맵으로 O(log64 N)에 찾습니다.
+ *
+ * D3D12에 의존하지 않으므로 디바이스 없이 벤치마크할 수 있습니다.
+ * 스레드 안전하지 않습니다 (소유자가 동기화).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 계층 비트맵 프리 리스트
+     */
+    class DescriptorFreeList
+    {
+    public:
+        static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+        DescriptorFreeList();
+
+        /**
+         * @brief 모든 인덱스를 사용 가능 상태로 초기화
+         * @param capacity 관리할 인덱스 수
+         */
+        void Initialize(uint32_t capacity);
+
+        /**
+         * @brief 가장 낮은 사용 가능 인덱스 할당
+         * @return 할당된 인덱스 (가득 차면 kInvalidIndex)
+         */
+        uint32_t Allocate();
+
+        /**
+         * @brief 연속된 인덱스 할당 (first-fit)
+         *
+         * 사용 중인 워드는 상위 레벨 비트로 건너뛰고, 워드 내부/경계를 넘는 연속 구간을
+         * 비트 연산으로 찾습니다. 64개 이하 구간은 앞쪽 kRangeProbeWords개 워드에서 못 찾으면
+         * 완전히 빈 워드를 사용하므로, 빈 워드가 남아 있는 한 O(log64 N)입니다.
+         * 빈 워드도 없을 때(거의 가득 차거나 심하게 조각난 힙)는 직전 구간 할당 위치부터
+         * 이어서 탐색하며(next-fit), 최악의 경우 O(N / 64)입니다.
+         *
+         * @param count 연속 인덱스 수 (1 이상)
+         * @return 첫 인덱스 (연속 공간이 없으면 kInvalidIndex)
+         */
+        uint32_t AllocateRange(uint32_t count);
+
+        /**
+         * @brief 인덱스 여러 개 할당 (연속일 필요 없음, 낮은 인덱스부터)
+         * @param outIndices 할당된 인덱스를 받을 배열 (count개 이상)
+         * @param count 요청 개수
+         * @return 실제로 할당된 개수 (남은 인덱스가 부족하면 count보다 작음)
+         */
+        uint32_t AllocateBatch(uint32_t* outIndices, uint32_t count);
+
+        /**
+         * @brief 인덱스 여러 개 해제
+         * @return 실제로 해제된 개수 (범위 밖 또는 이중 해제는 건너뜀)
+         */
+        uint32_t FreeBatch(const uint32_t* indices, uint32_t count);
+
+        /**
+         * @brief 인덱스 해제
+         * @return 사용 중이던 인덱스를 해제했으면 true (범위 밖 또는 이중 해제면 false)
+         */
+        bool Free(uint32_t index);
+
+        /**
+         * @brief 연속된 인덱스 해제
+         * @return 구간 전체가 사용 중이었으면 true (일부라도 이미 해제되어 있으면 변경 없이 false)
+         */
+        bool FreeRange(uint32_t first, uint32_t count);
+
+        /**
+         * @brief 인덱스 할당 여부
+         */
+        bool IsAllocated(uint32_t index) const;
+
+        /**
+         * @brief 관리하는 인덱스 수
+         */
+        uint32_t GetCapacity() const { return m_capacity; }
+
+        /**
+         * @brief 할당된 인덱스 수
+         */
+        uint32_t GetAllocatedCount() const { return m_allocatedCount; }
+
+        /**
+         * @brief 비트맵이 사용하는 메모리 (바이트)
+         */
+        size_t GetMemoryUsage() const;
+
+    private:
+        static constexpr uint32_t kInvalidPosition = UINT32_MAX;
+        static constexpr uint32_t kRangeProbeWords = 16;    // 64개 이하 구간 first-fit 탐색 워드 수
+
+        /**
+         * @brief 계층 비트맵 (상위 비트 = 하위 워드가 0이 아님)
+         */
+        struct BitHierarchy
+        {
+            std::vector<std::vector<uint64_t>> levels;  // [0] = 최하위, 마지막 = 워드 하나
+
+            /**
+             * @brief bitCount개의 비트를 모두 value로 초기화
+             */
+            void Initialize(uint32_t bitCount, bool value);
+
+            /**
+             * @brief 첫 번째 1 비트 위치 (최상위부터 내려감)
+             */
+            uint32_t FindFirst() const;
+
+            /**
+             * @brief level에서 position 이상인 첫 번째 1 비트 위치
+             * @return 비트 위치 (없으면 kInvalidPosition)
+             */
+            uint32_t FindNextSet(uint32_t level, uint32_t position) const;
+
+            /**
+             * @brief 최하위 워드를 바꾸고, 0이 되거나 0에서 벗어나면 상위 레벨에 전파
+             */
+            void SetWord(uint32_t wordIndex, uint64_t value);
+
+            size_t GetMemoryUsage() const;
+        };
+
+        /**
+         * @brief 최하위 워드를 바꾸고 두 계층 비트맵을 갱신
+         */
+        void SetLeafWord(uint32_t wordIndex, uint64_t value);
+
+        /**
+         * @brief startWord부터 연속 빈 구간 탐색
+         * @param maxWords 살펴볼 최대 워드 수
+         * @return 첫 인덱스 (없으면 kInvalidIndex)
+         */
+        uint32_t FindRange(uint32_t count, uint32_t startWord, uint32_t maxWords) const;
+
+        /**
+         * @brief [first, first + count) 구간의 최하위 비트를 모두 0(할당) 또는 1(해제)로 설정
+         */
+        void AssignRange(uint32_t first, uint32_t count, bool free);
+
+        /**
+         * @brief [first, first + count) 구간이 모두 같은 상태인지 검사 (free면 모두 사용 가능)
+         */
+        bool IsRangeUniform(uint32_t first, uint32_t count, bool free) const;
+
+    private:
+        BitHierarchy m_freeBits;        // 인덱스별 비트 (1 = 사용 가능)
+        BitHierarchy m_fullWords;       // m_freeBits 최하위 워드별 비트 (1 = 워드 전체가 사용 가능)
+        uint32_t m_capacity;
+        uint32_t m_allocatedCount;
+        uint32_t m_rangeSearchWord;     // 전체 탐색 시작 워드 (직전 구간 할당 위치)
+    };
+}
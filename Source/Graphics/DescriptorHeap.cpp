@@ -4,7 +4,9 @@
  */
 
 #include "DescriptorHeap.h"
+#include <Core/BuildConfig.h>
 #include <Utils/Logger.h>
+#include <algorithm>
 
 namespace DX12GameEngine
 {
@@ -21,8 +23,13 @@ namespace DX12GameEngine
             default:                                     return L"UNKNOWN";
             }
         }
+
+        constexpr bool kValidateDescriptorHandles = BUILD_DEFAULT(ValidateDescriptorHandles);
     }
 
+    std::atomic<DescriptorHeap*> DescriptorHeap::s_heapRegistry[DescriptorHeap::kMaxHeapIds] = {};
+    std::mutex DescriptorHeap::s_heapRegistryMutex;
+
     DescriptorHeap::DescriptorHeap()
         : m_type(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)
         , m_numDescriptors(0)
@@ -31,18 +38,25 @@ namespace DX12GameEngine
         , m_initialized(false)
         , m_cpuStartHandle{}
         , m_gpuStartHandle{}
-        , m_allocatedCount(0)
+        , m_heapId(CompactDescriptorHandle::kInvalidHeapId)
+        , m_cacheBatchSize(0)
+        , m_pendingFreeCount(0)
     {
     }
 
     DescriptorHeap::~DescriptorHeap()
     {
-        if (m_initialized && m_allocatedCount > 0)
+        // 힙 자체가 해제되므로 대기 중인 지연 해제는 누수가 아님
+        ProcessDeferredFrees(UINT64_MAX);
+
+        if (m_initialized && GetAllocatedCount() > 0)
         {
             LOG_WARNING(LogCategory::Renderer,
                         L"DescriptorHeap ({}) destroyed with {} descriptors still allocated",
-                        GetHeapTypeName(m_type), m_allocatedCount);
+                        GetHeapTypeName(m_type), GetAllocatedCount());
         }
+
+        UnregisterHeapId(m_heapId);
     }
 
     bool DescriptorHeap::Initialize(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type,
@@ -98,14 +112,23 @@ namespace DX12GameEngine
             m_gpuStartHandle = m_heap->GetGPUDescriptorHandleForHeapStart();
         }
 
-        // 프리 리스트 초기화 (모든 인덱스 사용 가능)
-        for (uint32_t i = 0; i < numDescriptors; i++)
+        // 프리 리스트 초기화 (모든 인덱스 사용 가능, 워드 단위 채우기)
+        m_freeList.Initialize(numDescriptors);
+
+        // 작은 힙(RTV/DSV 등)은 한 스레드 캐시가 힙을 독차지하지 않도록 캐시를 쓰지 않음
+        m_cacheBatchSize = std::min(DescriptorIndexCache::kMaxBatchSize, numDescriptors / 64);
+
+        // 세대 핸들: 인덱스별 세대 (0부터 시작)와 프로세스 전역 힙 ID
+        m_generations = std::make_unique<std::atomic<uint16_t>[]>(numDescriptors);
+        m_heapId = RegisterHeapId(this);
+        if (m_heapId == CompactDescriptorHandle::kInvalidHeapId)
         {
-            m_freeIndices.push(i);
+            LOG_WARNING(LogCategory::Renderer,
+                        L"DescriptorHeap ({}) - no free heap id, compact handles are unavailable",
+                        GetHeapTypeName(type));
         }
 
         m_initialized = true;
-        m_allocatedCount = 0;
 
         LOG_INFO(LogCategory::Renderer,
                  L"DescriptorHeap ({}) initialized: {} descriptors, shader visible: {}",
@@ -116,37 +139,80 @@ namespace DX12GameEngine
 
     DescriptorHandle DescriptorHeap::Allocate()
     {
-        DescriptorHandle handle;
+        if (!m_initialized)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"DescriptorHeap::Allocate - not initialized");
+            return DescriptorHandle();
+        }
+
+        // 프리 리스트에서 가장 낮은 빈 인덱스 획득
+        uint32_t index;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            index = m_freeList.Allocate();
+        }
+
+        if (index == DescriptorFreeList::kInvalidIndex)
+        {
+            LOG_ERROR(LogCategory::Renderer,
+                      L"DescriptorHeap ({}) is full (capacity: {})",
+                      GetHeapTypeName(m_type), m_numDescriptors);
+            return DescriptorHandle();
+        }
+
+        return MakeHandle(index);
+    }
+
+    DescriptorHandle DescriptorHeap::Allocate(DescriptorIndexCache& cache)
+    {
+        if (m_cacheBatchSize == 0)
+        {
+            return Allocate();
+        }
 
         if (!m_initialized)
         {
             LOG_ERROR(LogCategory::Renderer, L"DescriptorHeap::Allocate - not initialized");
-            return handle;
+            return DescriptorHandle();
         }
 
-        if (m_freeIndices.empty())
+        const uint32_t index = cache.Allocate(m_freeList, m_mutex, m_cacheBatchSize);
+        if (index == DescriptorFreeList::kInvalidIndex)
         {
             LOG_ERROR(LogCategory::Renderer,
                       L"DescriptorHeap ({}) is full (capacity: {})",
                       GetHeapTypeName(m_type), m_numDescriptors);
-            return handle;
+            return DescriptorHandle();
         }
 
-        // 프리 리스트에서 인덱스 획득
-        uint32_t index = m_freeIndices.front();
-        m_freeIndices.pop();
-        m_allocatedCount++;
+        return MakeHandle(index);
+    }
 
-        // 핸들 계산
-        handle.heapIndex = index;
-        handle.cpuHandle.ptr = m_cpuStartHandle.ptr + static_cast<SIZE_T>(index) * m_descriptorSize;
+    DescriptorHandle DescriptorHeap::AllocateRange(uint32_t count)
+    {
+        if (!m_initialized)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"DescriptorHeap::AllocateRange - not initialized");
+            return DescriptorHandle();
+        }
 
-        if (m_shaderVisible)
+        uint32_t first;
+        uint32_t allocatedCount;
         {
-            handle.gpuHandle.ptr = m_gpuStartHandle.ptr + static_cast<UINT64>(index) * m_descriptorSize;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            first = m_freeList.AllocateRange(count);
+            allocatedCount = m_freeList.GetAllocatedCount();
         }
 
-        return handle;
+        if (first == DescriptorFreeList::kInvalidIndex)
+        {
+            LOG_ERROR(LogCategory::Renderer,
+                      L"DescriptorHeap ({}) has no contiguous range of {} descriptors (allocated: {} / {})",
+                      GetHeapTypeName(m_type), count, allocatedCount, m_numDescriptors);
+            return DescriptorHandle();
+        }
+
+        return MakeHandle(first);
     }
 
     void DescriptorHeap::Free(const DescriptorHandle& handle)
@@ -162,9 +228,279 @@ namespace DX12GameEngine
             return;
         }
 
-        // 프리 리스트에 반환
-        m_freeIndices.push(handle.heapIndex);
-        m_allocatedCount--;
+        // 프리 리스트에 반환 (비트맵이므로 이중 해제를 검출할 수 있음)
+        bool freed;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            freed = m_freeList.Free(handle.heapIndex);
+        }
+
+        if (freed)
+        {
+            RetireGenerations(handle.heapIndex, 1);
+        }
+        else
+        {
+            LOG_WARNING(LogCategory::Renderer,
+                        L"DescriptorHeap ({}) - descriptor {} freed twice",
+                        GetHeapTypeName(m_type), handle.heapIndex);
+        }
+    }
+
+    void DescriptorHeap::Free(const DescriptorHandle& handle, DescriptorIndexCache& cache)
+    {
+        if (m_cacheBatchSize == 0)
+        {
+            Free(handle);
+            return;
+        }
+
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        if (!handle.IsValid() || handle.heapIndex >= m_numDescriptors)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"DescriptorHeap::Free - invalid handle");
+            return;
+        }
+
+        // 다른 스레드의 이중 해제는 캐시가 프리 리스트에 반환될 때 비트맵에서 걸러짐
+        if (cache.Free(handle.heapIndex, m_freeList, m_mutex, m_cacheBatchSize))
+        {
+            RetireGenerations(handle.heapIndex, 1);
+        }
+        else
+        {
+            LOG_WARNING(LogCategory::Renderer,
+                        L"DescriptorHeap ({}) - descriptor {} freed twice",
+                        GetHeapTypeName(m_type), handle.heapIndex);
+        }
+    }
+
+    void DescriptorHeap::DrainCache(DescriptorIndexCache& cache)
+    {
+        const uint32_t count = cache.GetCount();
+        const uint32_t freed = cache.Drain(m_freeList, m_mutex);
+        if (freed != count)
+        {
+            LOG_WARNING(LogCategory::Renderer,
+                        L"DescriptorHeap ({}) - {} cached descriptors were already free",
+                        GetHeapTypeName(m_type), count - freed);
+        }
+    }
+
+    void DescriptorHeap::FreeRange(const DescriptorHandle& first, uint32_t count)
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        if (!first.IsValid() || count == 0)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"DescriptorHeap::FreeRange - invalid handle");
+            return;
+        }
+
+        RetireGenerations(first.heapIndex, count);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ReleaseRange(first.heapIndex, count);
+    }
+
+    void DescriptorHeap::FreeDeferred(const DescriptorHandle& handle, uint64_t fenceValue)
+    {
+        FreeRangeDeferred(handle, 1, fenceValue);
+    }
+
+    void DescriptorHeap::FreeRangeDeferred(const DescriptorHandle& first, uint32_t count, uint64_t fenceValue)
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        if (!first.IsValid() || count == 0 || first.heapIndex >= m_numDescriptors ||
+            count > m_numDescriptors - first.heapIndex)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"DescriptorHeap::FreeRangeDeferred - invalid handle");
+            return;
+        }
+
+        // 프리 리스트 반환은 Fence 이후지만, 세대는 지금 올려 해제 후 사용을 바로 검출
+        RetireGenerations(first.heapIndex, count);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Fence 값은 보통 단조 증가하므로 마지막 버킷에 붙이거나 새 버킷을 추가.
+        // 더 작은 값이 늦게 들어오면 마지막 버킷에 넣음 (늦게 해제되는 것은 항상 안전)
+        if (m_retirementBuckets.empty() || m_retirementBuckets.back().fenceValue < fenceValue)
+        {
+            RetirementBucket bucket;
+            bucket.fenceValue = fenceValue;
+            if (!m_spareRangeLists.empty())
+            {
+                bucket.ranges = std::move(m_spareRangeLists.back());
+                m_spareRangeLists.pop_back();
+            }
+            m_retirementBuckets.push_back(std::move(bucket));
+        }
+
+        m_retirementBuckets.back().ranges.push_back({ first.heapIndex, count });
+        m_pendingFreeCount += count;
+    }
+
+    void DescriptorHeap::ProcessDeferredFrees(uint64_t completedFenceValue)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        while (!m_retirementBuckets.empty() && m_retirementBuckets.front().fenceValue <= completedFenceValue)
+        {
+            RetirementBucket& bucket = m_retirementBuckets.front();
+            for (const DeferredRange& range : bucket.ranges)
+            {
+                ReleaseRange(range.first, range.count);
+                m_pendingFreeCount -= range.count;
+            }
+
+            bucket.ranges.clear();
+            m_spareRangeLists.push_back(std::move(bucket.ranges));
+            m_retirementBuckets.pop_front();
+        }
+    }
+
+    void DescriptorHeap::ReleaseRange(uint32_t first, uint32_t count)
+    {
+        if (!m_freeList.FreeRange(first, count))
+        {
+            LOG_WARNING(LogCategory::Renderer,
+                        L"DescriptorHeap ({}) - invalid range free [{}, {})",
+                        GetHeapTypeName(m_type), first, first + count);
+        }
+    }
+
+    void DescriptorHeap::RetireGenerations(uint32_t first, uint32_t count)
+    {
+        if (first >= m_numDescriptors || count > m_numDescriptors - first)
+        {
+            return;
+        }
+
+        for (uint32_t i = first; i < first + count; i++)
+        {
+            m_generations[i].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    CompactDescriptorHandle DescriptorHeap::ToCompact(const DescriptorHandle& handle) const
+    {
+        CompactDescriptorHandle compact;
+        if (!m_initialized || !handle.IsValid() || handle.heapIndex >= m_numDescriptors)
+        {
+            return compact;
+        }
+
+        compact.index = handle.heapIndex;
+        compact.generation = m_generations[handle.heapIndex].load(std::memory_order_relaxed);
+        compact.heapId = m_heapId;
+        return compact;
+    }
+
+    DescriptorHandle DescriptorHeap::Resolve(const CompactDescriptorHandle& handle) const
+    {
+        if (!m_initialized || handle.heapId != m_heapId || !handle.IsValid() || handle.index >= m_numDescriptors)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"DescriptorHeap::Resolve - invalid handle");
+            return DescriptorHandle();
+        }
+
+        if constexpr (kValidateDescriptorHandles)
+        {
+            const uint16_t generation = m_generations[handle.index].load(std::memory_order_relaxed);
+            if (generation != handle.generation)
+            {
+                LOG_ERROR(LogCategory::Renderer,
+                          L"DescriptorHeap ({}) - use after free of descriptor {} (generation {}, current {})",
+                          GetHeapTypeName(m_type), handle.index, handle.generation, generation);
+                return DescriptorHandle();
+            }
+        }
+
+        return MakeHandle(handle.index);
+    }
+
+    bool DescriptorHeap::IsAlive(const CompactDescriptorHandle& handle) const
+    {
+        return m_initialized && handle.IsValid() && handle.heapId == m_heapId &&
+               handle.index < m_numDescriptors &&
+               m_generations[handle.index].load(std::memory_order_relaxed) == handle.generation;
+    }
+
+    DescriptorHandle DescriptorHeap::ResolveCompact(const CompactDescriptorHandle& handle)
+    {
+        const DescriptorHeap* heap = FromHeapId(handle.heapId);
+        if (!heap)
+        {
+            if (handle.IsValid())
+            {
+                LOG_WARNING(LogCategory::Renderer, L"DescriptorHeap::ResolveCompact - heap {} no longer exists",
+                            handle.heapId);
+            }
+            return DescriptorHandle();
+        }
+
+        return heap->Resolve(handle);
+    }
+
+    DescriptorHeap* DescriptorHeap::FromHeapId(uint8_t heapId)
+    {
+        if (heapId == CompactDescriptorHandle::kInvalidHeapId)
+        {
+            return nullptr;
+        }
+
+        return s_heapRegistry[heapId].load(std::memory_order_acquire);
+    }
+
+    uint8_t DescriptorHeap::RegisterHeapId(DescriptorHeap* heap)
+    {
+        std::lock_guard<std::mutex> lock(s_heapRegistryMutex);
+        for (uint32_t id = 1; id < kMaxHeapIds; id++)
+        {
+            if (s_heapRegistry[id].load(std::memory_order_relaxed) == nullptr)
+            {
+                s_heapRegistry[id].store(heap, std::memory_order_release);
+                return static_cast<uint8_t>(id);
+            }
+        }
+
+        return CompactDescriptorHandle::kInvalidHeapId;
+    }
+
+    void DescriptorHeap::UnregisterHeapId(uint8_t heapId)
+    {
+        if (heapId == CompactDescriptorHandle::kInvalidHeapId)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(s_heapRegistryMutex);
+        s_heapRegistry[heapId].store(nullptr, std::memory_order_release);
+    }
+
+    DescriptorHandle DescriptorHeap::MakeHandle(uint32_t index) const
+    {
+        DescriptorHandle handle;
+        handle.heapIndex = index;
+        handle.cpuHandle.ptr = m_cpuStartHandle.ptr + static_cast<SIZE_T>(index) * m_descriptorSize;
+
+        if (m_shaderVisible)
+        {
+            handle.gpuHandle.ptr = m_gpuStartHandle.ptr + static_cast<UINT64>(index) * m_descriptorSize;
+        }
+
+        return handle;
     }
 
     D3D12_CPU_DESCRIPTOR_HANDLE DescriptorHeap::GetCpuHandle(uint32_t index) const
@@ -3,15 +3,24 @@
  * @brief 디스크립터 힙 관리
  *
  * 디스크립터 힙 생성, 할당, 해제를 관리합니다.
- * 프리 리스트 방식으로 디스크립터를 재사용합니다.
+ * 계층 비트맵 프리 리스트로 디스크립터를 재사용하며, 연속 구간(디스크립터 테이블) 할당을 지원합니다.
+ * GPU가 아직 참조할 수 있는 디스크립터는 Fence 값과 함께 지연 해제하여 Flush 없이 반환할 수 있습니다.
+ * 프리 리스트는 뮤텍스로 보호되며, 스레드별 DescriptorIndexCache를 쓰면 배치당 한 번만 잠급니다.
+ * 인덱스별 세대를 두어, 오래 보관하는 참조는 8바이트 CompactDescriptorHandle로 저장하고
+ * 사용할 때 CPU/GPU 주소로 변환할 수 있습니다 (해제 후 사용은 세대 불일치로 검출).
  */
 
 #pragma once
 
 #include <d3d12.h>
 #include <wrl/client.h>
+#include "DescriptorFreeList.h"
+#include "DescriptorIndexCache.h"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <vector>
-#include <queue>
 #include <cstdint>
 
 namespace DX12GameEngine
@@ -40,11 +49,42 @@ namespace DX12GameEngine
         bool IsShaderVisible() const { return gpuHandle.ptr != 0; }
     };
 
+    /**
+     * @brief 8바이트 세대 디스크립터 핸들
+     *
+     * 힙 ID, 힙 내 인덱스, 세대만 저장하고 CPU/GPU 주소는 DescriptorHeap::Resolve에서 계산합니다.
+     * 드로우 패킷이나 컴포넌트 배열처럼 핸들을 많이 보관하는 곳에 사용합니다.
+     * 디스크립터의 소유권은 없으며, 해제는 원래의 DescriptorHandle로 합니다.
+     * 0으로 초기화된 값은 무효 핸들입니다.
+     */
+    struct CompactDescriptorHandle
+    {
+        static constexpr uint8_t kInvalidHeapId = 0;
+
+        uint32_t index;
+        uint16_t generation;
+        uint8_t heapId;
+        uint8_t reserved;
+
+        CompactDescriptorHandle()
+            : index(0)
+            , generation(0)
+            , heapId(kInvalidHeapId)
+            , reserved(0)
+        {
+        }
+
+        bool IsValid() const { return heapId != kInvalidHeapId; }
+    };
+
+    static_assert(sizeof(CompactDescriptorHandle) == 8, "CompactDescriptorHandle must stay 8 bytes");
+
     /**
      * @brief 단일 디스크립터 힙 관리 클래스
      *
      * 특정 타입의 디스크립터 힙을 관리합니다.
-     * 프리 리스트 방식으로 할당/해제를 처리합니다.
+     * 계층 비트맵 프리 리스트로 할당/해제를 처리합니다 (가장 낮은 빈 인덱스 우선).
+     * 할당/해제는 스레드 안전합니다.
      */
     class DescriptorHeap
     {
@@ -75,12 +115,109 @@ namespace DX12GameEngine
          */
         DescriptorHandle Allocate();
 
+        /**
+         * @brief 스레드별 캐시를 통한 디스크립터 할당 (캐시가 비었을 때만 프리 리스트를 잠금)
+         * @param cache 호출 스레드 전용 캐시
+         * @return 할당된 디스크립터 핸들 (실패 시 IsValid() == false)
+         */
+        DescriptorHandle Allocate(DescriptorIndexCache& cache);
+
+        /**
+         * @brief 연속된 디스크립터 할당 (디스크립터 테이블용)
+         * @param count 디스크립터 개수
+         * @return 첫 디스크립터 핸들 (i번째는 GetCpuHandle(handle.heapIndex + i), 실패 시 IsValid() == false)
+         */
+        DescriptorHandle AllocateRange(uint32_t count);
+
         /**
          * @brief 디스크립터 해제
          * @param handle 해제할 디스크립터 핸들
          */
         void Free(const DescriptorHandle& handle);
 
+        /**
+         * @brief 스레드별 캐시로 디스크립터 해제 (캐시가 가득 찼을 때만 프리 리스트를 잠금)
+         * @param handle 해제할 디스크립터 핸들
+         * @param cache 호출 스레드 전용 캐시
+         */
+        void Free(const DescriptorHandle& handle, DescriptorIndexCache& cache);
+
+        /**
+         * @brief 캐시에 남은 디스크립터를 모두 프리 리스트에 반환
+         */
+        void DrainCache(DescriptorIndexCache& cache);
+
+        /**
+         * @brief AllocateRange로 할당한 연속 디스크립터 해제
+         * @param first 첫 디스크립터 핸들
+         * @param count 디스크립터 개수
+         */
+        void FreeRange(const DescriptorHandle& first, uint32_t count);
+
+        /**
+         * @brief Fence 완료 후 디스크립터 해제 (GPU 대기 없음)
+         *
+         * 디스크립터는 ProcessDeferredFrees에 fenceValue 이상이 전달될 때까지 할당 상태로 남습니다.
+         *
+         * @param handle 해제할 디스크립터 핸들
+         * @param fenceValue 마지막으로 이 디스크립터를 사용한 제출 이후의 Fence 값
+         */
+        void FreeDeferred(const DescriptorHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief Fence 완료 후 연속 디스크립터 해제 (GPU 대기 없음)
+         * @param first 첫 디스크립터 핸들
+         * @param count 디스크립터 개수
+         * @param fenceValue 마지막으로 이 디스크립터를 사용한 제출 이후의 Fence 값
+         */
+        void FreeRangeDeferred(const DescriptorHandle& first, uint32_t count, uint64_t fenceValue);
+
+        /**
+         * @brief GPU가 완료한 Fence 값까지의 지연 해제를 프리 리스트에 반영
+         * @param completedFenceValue CommandQueue::GetCompletedFenceValue() 값
+         */
+        void ProcessDeferredFrees(uint64_t completedFenceValue);
+
+        /**
+         * @brief 할당된 핸들을 세대 핸들로 변환
+         * @param handle 이 힙에서 할당한 디스크립터 핸들
+         * @return 현재 세대가 기록된 핸들 (handle이 무효이거나 힙 ID가 없으면 IsValid() == false)
+         */
+        CompactDescriptorHandle ToCompact(const DescriptorHandle& handle) const;
+
+        /**
+         * @brief 세대 핸들을 CPU/GPU 주소로 변환
+         *
+         * ValidateDescriptorHandles 빌드에서는 세대를 비교해, 해제된 디스크립터를 가리키면
+         * 오류를 기록하고 무효 핸들을 반환합니다. 그 외 빌드에서는 검사 없이 주소만 계산합니다.
+         *
+         * @param handle 이 힙의 세대 핸들
+         * @return 디스크립터 핸들 (실패 시 IsValid() == false)
+         */
+        DescriptorHandle Resolve(const CompactDescriptorHandle& handle) const;
+
+        /**
+         * @brief 세대 핸들이 아직 해제되지 않았는지 (빌드 구성과 무관하게 세대 비교)
+         */
+        bool IsAlive(const CompactDescriptorHandle& handle) const;
+
+        /**
+         * @brief 세대 핸들의 힙을 찾아 변환 (DescriptorHeap::Resolve 참고)
+         * @return 디스크립터 핸들 (힙이 없거나 해제된 핸들이면 IsValid() == false)
+         */
+        static DescriptorHandle ResolveCompact(const CompactDescriptorHandle& handle);
+
+        /**
+         * @brief 힙 ID로 힙 찾기
+         * @return 힙 (해당 ID의 힙이 없으면 nullptr)
+         */
+        static DescriptorHeap* FromHeapId(uint8_t heapId);
+
+        /**
+         * @brief 프로세스 안에서 고유한 힙 ID (ID가 부족하면 CompactDescriptorHandle::kInvalidHeapId)
+         */
+        uint8_t GetHeapId() const { return m_heapId; }
+
         /**
          * @brief 특정 인덱스의 CPU 핸들 가져오기
          * @param index 힙 내 인덱스
@@ -123,7 +260,65 @@ namespace DX12GameEngine
         /**
          * @brief 할당된 디스크립터 개수
          */
-        uint32_t GetAllocatedCount() const { return m_allocatedCount; }
+        uint32_t GetAllocatedCount() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_freeList.GetAllocatedCount();
+        }
+
+        /**
+         * @brief 지연 해제 대기 중인 디스크립터 개수 (할당 개수에 포함)
+         */
+        uint32_t GetPendingFreeCount() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_pendingFreeCount;
+        }
+
+        /**
+         * @brief 스레드별 캐시의 보충/반환 단위 (0이면 힙이 작아 캐시를 쓰지 않음)
+         */
+        uint32_t GetCacheBatchSize() const { return m_cacheBatchSize; }
+
+    private:
+        /**
+         * @brief 인덱스로 핸들 생성
+         */
+        DescriptorHandle MakeHandle(uint32_t index) const;
+
+        /**
+         * @brief 프리 리스트에 연속 구간 반환 (이중 해제는 경고, m_mutex를 잡은 상태에서 호출)
+         */
+        void ReleaseRange(uint32_t first, uint32_t count);
+
+        /**
+         * @brief 구간의 세대를 올려 기존 세대 핸들을 무효화 (해제 시점에 호출)
+         */
+        void RetireGenerations(uint32_t first, uint32_t count);
+
+        /**
+         * @brief 힙 ID 등록/해제 (ID 0은 무효 핸들용으로 비워 둠)
+         */
+        static uint8_t RegisterHeapId(DescriptorHeap* heap);
+        static void UnregisterHeapId(uint8_t heapId);
+
+        /**
+         * @brief 지연 해제 구간
+         */
+        struct DeferredRange
+        {
+            uint32_t first;
+            uint32_t count;
+        };
+
+        /**
+         * @brief 같은 Fence 값에 해제되는 구간 묶음
+         */
+        struct RetirementBucket
+        {
+            uint64_t fenceValue;
+            std::vector<DeferredRange> ranges;
+        };
 
     private:
         ComPtr<ID3D12DescriptorHeap> m_heap;
@@ -136,8 +331,23 @@ namespace DX12GameEngine
         D3D12_CPU_DESCRIPTOR_HANDLE m_cpuStartHandle;
         D3D12_GPU_DESCRIPTOR_HANDLE m_gpuStartHandle;
 
-        // 프리 리스트 (사용 가능한 인덱스)
-        std::queue<uint32_t> m_freeIndices;
-        uint32_t m_allocatedCount;
+        // 세대 핸들 (인덱스별 세대, 해제할 때 증가)
+        std::unique_ptr<std::atomic<uint16_t>[]> m_generations;
+        uint8_t m_heapId;
+
+        // 힙 ID → 힙 (조회는 잠금 없이, 등록/해제만 s_heapRegistryMutex로 보호)
+        static constexpr uint32_t kMaxHeapIds = 256;
+        static std::atomic<DescriptorHeap*> s_heapRegistry[kMaxHeapIds];
+        static std::mutex s_heapRegistryMutex;
+
+        // 프리 리스트 (인덱스당 1비트), 지연 해제 버킷과 함께 m_mutex로 보호
+        mutable std::mutex m_mutex;
+        DescriptorFreeList m_freeList;
+        uint32_t m_cacheBatchSize;
+
+        // 지연 해제 (Fence 값 오름차순 버킷)
+        std::deque<RetirementBucket> m_retirementBuckets;
+        std::vector<std::vector<DeferredRange>> m_spareRangeLists;     // 비운 버킷의 벡터 (용량 재사용)
+        uint32_t m_pendingFreeCount;
     };
 }
@@ -8,8 +8,11 @@
 
 namespace DX12GameEngine
 {
+    std::atomic<uint64_t> DescriptorHeapManager::s_nextInstanceId{ 1 };
+
     DescriptorHeapManager::DescriptorHeapManager()
-        : m_initialized(false)
+        : m_instanceId(s_nextInstanceId.fetch_add(1, std::memory_order_relaxed))
+        , m_initialized(false)
     {
     }
 
@@ -17,6 +20,14 @@ namespace DX12GameEngine
     {
         if (m_initialized)
         {
+            // 힙보다 먼저 모든 스레드 캐시를 반환 (이 시점에는 다른 스레드가 할당하지 않아야 함)
+            std::lock_guard<std::mutex> lock(m_threadCacheMutex);
+            for (auto& [threadId, threadCaches] : m_threadCaches)
+            {
+                DrainThreadCaches(*threadCaches);
+            }
+            m_threadCaches.clear();
+
             LOG_INFO(LogCategory::Renderer, L"DescriptorHeapManager destroyed");
         }
     }
@@ -35,42 +46,105 @@ namespace DX12GameEngine
             return false;
         }
 
-        // RTV 힙 생성 (셰이더 비가시)
-        m_rtvHeap = std::make_unique<DescriptorHeap>();
-        if (!m_rtvHeap->Initialize(device, D3D12_DESCRIPTOR_HEAP_TYPE_RTV,
-                                    desc.numRtvDescriptors, false))
+        // RTV 힙 생성 (셰이더 비가시, 페이지 단위로 커짐)
+        m_rtvHeap = std::make_unique<PagedDescriptorHeap>();
+        if (!m_rtvHeap->Initialize(device, D3D12_DESCRIPTOR_HEAP_TYPE_RTV, desc.numRtvDescriptors))
         {
             LOG_ERROR(LogCategory::Renderer, L"Failed to create RTV heap");
             return false;
         }
 
-        // DSV 힙 생성 (셰이더 비가시)
-        m_dsvHeap = std::make_unique<DescriptorHeap>();
-        if (!m_dsvHeap->Initialize(device, D3D12_DESCRIPTOR_HEAP_TYPE_DSV,
-                                    desc.numDsvDescriptors, false))
+        // DSV 힙 생성 (셰이더 비가시, 페이지 단위로 커짐)
+        m_dsvHeap = std::make_unique<PagedDescriptorHeap>();
+        if (!m_dsvHeap->Initialize(device, D3D12_DESCRIPTOR_HEAP_TYPE_DSV, desc.numDsvDescriptors))
         {
             LOG_ERROR(LogCategory::Renderer, L"Failed to create DSV heap");
             return false;
         }
 
-        // CBV/SRV/UAV 힙 생성 (셰이더 가시)
+        // CBV/SRV/UAV 힙 생성 (셰이더 가시, 영구 할당 + 임시 링 + 바인드리스 테이블)
         m_cbvSrvUavHeap = std::make_unique<DescriptorHeap>();
         if (!m_cbvSrvUavHeap->Initialize(device, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
-                                          desc.numCbvSrvUavDescriptors, true))
+                                          desc.numCbvSrvUavDescriptors + desc.numTransientCbvSrvUavDescriptors +
+                                          desc.numBindlessResourceDescriptors, true))
         {
             LOG_ERROR(LogCategory::Renderer, L"Failed to create CBV/SRV/UAV heap");
             return false;
         }
 
-        // Sampler 힙 생성 (셰이더 가시)
+        // 임시 링 구간 예약 (영구 할당보다 먼저 해야 연속 구간이 보장됨)
+        if (desc.numTransientCbvSrvUavDescriptors > 0)
+        {
+            m_transientCbvSrvUavRing = std::make_unique<TransientDescriptorRing>();
+            if (!m_transientCbvSrvUavRing->Initialize(m_cbvSrvUavHeap.get(), desc.numTransientCbvSrvUavDescriptors))
+            {
+                LOG_ERROR(LogCategory::Renderer, L"Failed to create transient CBV/SRV/UAV ring");
+                return false;
+            }
+        }
+
+        // Sampler 힙 생성 (셰이더 가시, 영구 할당 + 바인드리스 테이블)
         m_samplerHeap = std::make_unique<DescriptorHeap>();
         if (!m_samplerHeap->Initialize(device, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER,
-                                        desc.numSamplerDescriptors, true))
+                                        desc.numSamplerDescriptors + desc.numBindlessSamplerDescriptors, true))
         {
             LOG_ERROR(LogCategory::Renderer, L"Failed to create Sampler heap");
             return false;
         }
 
+        // CPU 스테이징 힙 생성 (셰이더 비가시, 페이지 단위로 커짐)
+        m_cpuCbvSrvUavHeap = std::make_unique<PagedDescriptorHeap>();
+        if (!m_cpuCbvSrvUavHeap->Initialize(device, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+                                             desc.numCpuCbvSrvUavDescriptors))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to create CPU CBV/SRV/UAV heap");
+            return false;
+        }
+
+        m_cpuSamplerHeap = std::make_unique<PagedDescriptorHeap>();
+        if (!m_cpuSamplerHeap->Initialize(device, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER,
+                                           desc.numCpuSamplerDescriptors))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to create CPU Sampler heap");
+            return false;
+        }
+
+        m_cbvSrvUavCopyBatch.Initialize(device, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        m_samplerCopyBatch.Initialize(device, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+
+        // 바인드리스 테이블 구간 예약 (영구 할당 전이므로 연속 구간이 보장됨)
+        if (desc.numBindlessResourceDescriptors > 0)
+        {
+            m_bindlessResourceTable = std::make_unique<BindlessDescriptorTable>();
+            if (!m_bindlessResourceTable->Initialize(m_cbvSrvUavHeap.get(), &m_cbvSrvUavCopyBatch,
+                                                     desc.numBindlessResourceDescriptors))
+            {
+                LOG_ERROR(LogCategory::Renderer, L"Failed to create bindless resource table");
+                return false;
+            }
+        }
+
+        if (desc.numBindlessSamplerDescriptors > 0)
+        {
+            m_bindlessSamplerTable = std::make_unique<BindlessDescriptorTable>();
+            if (!m_bindlessSamplerTable->Initialize(m_samplerHeap.get(), &m_samplerCopyBatch,
+                                                    desc.numBindlessSamplerDescriptors))
+            {
+                LOG_ERROR(LogCategory::Renderer, L"Failed to create bindless sampler table");
+                return false;
+            }
+        }
+
+        // 중복 제거 캐시 (셰이더 가시 힙의 영구 할당 영역 사용)
+        m_samplerDedupCache = std::make_unique<DescriptorDedupCache>();
+        m_shaderResourceDedupCache = std::make_unique<DescriptorDedupCache>();
+        if (!m_samplerDedupCache->Initialize(device, m_samplerHeap.get()) ||
+            !m_shaderResourceDedupCache->Initialize(device, m_cbvSrvUavHeap.get()))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to create descriptor dedup caches");
+            return false;
+        }
+
         m_initialized = true;
 
         LOG_INFO(LogCategory::Renderer, L"DescriptorHeapManager initialized");
@@ -102,7 +176,72 @@ namespace DX12GameEngine
         {
             return DescriptorHandle();
         }
-        return m_cbvSrvUavHeap->Allocate();
+        return AllocateCached(m_cbvSrvUavHeap.get());
+    }
+
+    DescriptorHandle DescriptorHeapManager::AllocateCpuCbvSrvUav()
+    {
+        if (!m_initialized || !m_cpuCbvSrvUavHeap)
+        {
+            return DescriptorHandle();
+        }
+        return m_cpuCbvSrvUavHeap->Allocate();
+    }
+
+    DescriptorHandle DescriptorHeapManager::AllocateCpuSampler()
+    {
+        if (!m_initialized || !m_cpuSamplerHeap)
+        {
+            return DescriptorHandle();
+        }
+        return m_cpuSamplerHeap->Allocate();
+    }
+
+    DescriptorHandle DescriptorHeapManager::AllocateTransientCbvSrvUav(uint32_t count)
+    {
+        if (!m_initialized || !m_transientCbvSrvUavRing)
+        {
+            return DescriptorHandle();
+        }
+        return m_transientCbvSrvUavRing->Allocate(count);
+    }
+
+    void DescriptorHeapManager::BeginFrame(uint64_t completedFenceValue)
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        m_rtvHeap->ProcessDeferredFrees(completedFenceValue);
+        m_dsvHeap->ProcessDeferredFrees(completedFenceValue);
+        m_cbvSrvUavHeap->ProcessDeferredFrees(completedFenceValue);
+        m_samplerHeap->ProcessDeferredFrees(completedFenceValue);
+        m_cpuCbvSrvUavHeap->ProcessDeferredFrees(completedFenceValue);
+        m_cpuSamplerHeap->ProcessDeferredFrees(completedFenceValue);
+
+        if (m_transientCbvSrvUavRing)
+        {
+            m_transientCbvSrvUavRing->BeginFrame(completedFenceValue);
+        }
+
+        if (m_bindlessResourceTable)
+        {
+            m_bindlessResourceTable->ProcessRetiredSlots(completedFenceValue);
+        }
+
+        if (m_bindlessSamplerTable)
+        {
+            m_bindlessSamplerTable->ProcessRetiredSlots(completedFenceValue);
+        }
+    }
+
+    void DescriptorHeapManager::EndFrame(uint64_t fenceValue)
+    {
+        if (m_initialized && m_transientCbvSrvUavRing)
+        {
+            m_transientCbvSrvUavRing->EndFrame(fenceValue);
+        }
     }
 
     DescriptorHandle DescriptorHeapManager::AllocateSampler()
@@ -111,7 +250,42 @@ namespace DX12GameEngine
         {
             return DescriptorHandle();
         }
-        return m_samplerHeap->Allocate();
+        return AllocateCached(m_samplerHeap.get());
+    }
+
+    DescriptorHandle DescriptorHeapManager::AcquireSharedSampler(const D3D12_SAMPLER_DESC& desc)
+    {
+        if (!m_initialized || !m_samplerDedupCache)
+        {
+            return DescriptorHandle();
+        }
+        return m_samplerDedupCache->AcquireSampler(desc);
+    }
+
+    DescriptorHandle DescriptorHeapManager::AcquireSharedShaderResourceView(ID3D12Resource* resource,
+                                                                            const D3D12_SHADER_RESOURCE_VIEW_DESC* desc)
+    {
+        if (!m_initialized || !m_shaderResourceDedupCache)
+        {
+            return DescriptorHandle();
+        }
+        return m_shaderResourceDedupCache->AcquireShaderResourceView(resource, desc);
+    }
+
+    void DescriptorHeapManager::ReleaseSharedSampler(const DescriptorHandle& handle, uint64_t fenceValue)
+    {
+        if (m_initialized && m_samplerDedupCache)
+        {
+            m_samplerDedupCache->Release(handle, fenceValue);
+        }
+    }
+
+    void DescriptorHeapManager::ReleaseSharedShaderResourceView(const DescriptorHandle& handle, uint64_t fenceValue)
+    {
+        if (m_initialized && m_shaderResourceDedupCache)
+        {
+            m_shaderResourceDedupCache->Release(handle, fenceValue);
+        }
     }
 
     void DescriptorHeapManager::FreeRtv(const DescriptorHandle& handle)
@@ -134,7 +308,7 @@ namespace DX12GameEngine
     {
         if (m_initialized && m_cbvSrvUavHeap)
         {
-            m_cbvSrvUavHeap->Free(handle);
+            FreeCached(m_cbvSrvUavHeap.get(), handle);
         }
     }
 
@@ -142,7 +316,191 @@ namespace DX12GameEngine
     {
         if (m_initialized && m_samplerHeap)
         {
-            m_samplerHeap->Free(handle);
+            FreeCached(m_samplerHeap.get(), handle);
+        }
+    }
+
+    void DescriptorHeapManager::FreeCpuCbvSrvUav(const DescriptorHandle& handle)
+    {
+        if (m_initialized && m_cpuCbvSrvUavHeap)
+        {
+            m_cpuCbvSrvUavHeap->Free(handle);
+        }
+    }
+
+    void DescriptorHeapManager::FreeCpuSampler(const DescriptorHandle& handle)
+    {
+        if (m_initialized && m_cpuSamplerHeap)
+        {
+            m_cpuSamplerHeap->Free(handle);
+        }
+    }
+
+    void DescriptorHeapManager::CopyCbvSrvUavToShaderVisible(const DescriptorHandle& destination,
+                                                             const DescriptorHandle& source, uint32_t count)
+    {
+        if (!m_initialized || !destination.IsValid() || !source.IsValid())
+        {
+            return;
+        }
+
+        // 원본 페이지 번호를 넘겨 다른 페이지(다른 힙)의 구간끼리는 병합하지 않게 함
+        m_cbvSrvUavCopyBatch.Add(destination.cpuHandle, source.cpuHandle, count,
+                                 source.heapIndex / m_cpuCbvSrvUavHeap->GetDescriptorsPerPage());
+    }
+
+    void DescriptorHeapManager::CopySamplerToShaderVisible(const DescriptorHandle& destination,
+                                                           const DescriptorHandle& source, uint32_t count)
+    {
+        if (!m_initialized || !destination.IsValid() || !source.IsValid())
+        {
+            return;
+        }
+
+        m_samplerCopyBatch.Add(destination.cpuHandle, source.cpuHandle, count,
+                               source.heapIndex / m_cpuSamplerHeap->GetDescriptorsPerPage());
+    }
+
+    void DescriptorHeapManager::FlushDescriptorCopies()
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        m_cbvSrvUavCopyBatch.Flush();
+        m_samplerCopyBatch.Flush();
+    }
+
+    BindlessHandle DescriptorHeapManager::RegisterBindlessResource(const DescriptorHandle& source)
+    {
+        if (!m_initialized || !m_bindlessResourceTable)
+        {
+            return BindlessHandle();
+        }
+        return m_bindlessResourceTable->Register(source,
+                                                 source.heapIndex / m_cpuCbvSrvUavHeap->GetDescriptorsPerPage());
+    }
+
+    BindlessHandle DescriptorHeapManager::RegisterBindlessSampler(const DescriptorHandle& source)
+    {
+        if (!m_initialized || !m_bindlessSamplerTable)
+        {
+            return BindlessHandle();
+        }
+        return m_bindlessSamplerTable->Register(source,
+                                                source.heapIndex / m_cpuSamplerHeap->GetDescriptorsPerPage());
+    }
+
+    void DescriptorHeapManager::ReleaseBindlessResource(const BindlessHandle& handle, uint64_t fenceValue)
+    {
+        if (m_initialized && m_bindlessResourceTable)
+        {
+            m_bindlessResourceTable->Release(handle, fenceValue);
+        }
+    }
+
+    void DescriptorHeapManager::ReleaseBindlessSampler(const BindlessHandle& handle, uint64_t fenceValue)
+    {
+        if (m_initialized && m_bindlessSamplerTable)
+        {
+            m_bindlessSamplerTable->Release(handle, fenceValue);
+        }
+    }
+
+    void DescriptorHeapManager::FreeRtvDeferred(const DescriptorHandle& handle, uint64_t fenceValue)
+    {
+        if (m_initialized && m_rtvHeap)
+        {
+            m_rtvHeap->FreeDeferred(handle, fenceValue);
+        }
+    }
+
+    void DescriptorHeapManager::FreeDsvDeferred(const DescriptorHandle& handle, uint64_t fenceValue)
+    {
+        if (m_initialized && m_dsvHeap)
+        {
+            m_dsvHeap->FreeDeferred(handle, fenceValue);
+        }
+    }
+
+    void DescriptorHeapManager::FreeCbvSrvUavDeferred(const DescriptorHandle& handle, uint64_t fenceValue)
+    {
+        if (m_initialized && m_cbvSrvUavHeap)
+        {
+            m_cbvSrvUavHeap->FreeDeferred(handle, fenceValue);
+        }
+    }
+
+    void DescriptorHeapManager::FreeSamplerDeferred(const DescriptorHandle& handle, uint64_t fenceValue)
+    {
+        if (m_initialized && m_samplerHeap)
+        {
+            m_samplerHeap->FreeDeferred(handle, fenceValue);
+        }
+    }
+
+    void DescriptorHeapManager::FlushThreadCache()
+    {
+        if (m_initialized)
+        {
+            DrainThreadCaches(GetThreadCaches());
+        }
+    }
+
+    DescriptorHeapManager::ThreadCaches& DescriptorHeapManager::GetThreadCaches()
+    {
+        // 빠른 경로: 마지막으로 사용한 관리자와 같으면 잠금 없이 반환
+        struct CacheSlot
+        {
+            uint64_t ownerId;
+            ThreadCaches* caches;
+        };
+        thread_local CacheSlot t_slot = { 0, nullptr };
+
+        if (t_slot.ownerId != m_instanceId)
+        {
+            std::lock_guard<std::mutex> lock(m_threadCacheMutex);
+            std::unique_ptr<ThreadCaches>& threadCaches = m_threadCaches[std::this_thread::get_id()];
+            if (!threadCaches)
+            {
+                threadCaches = std::make_unique<ThreadCaches>();
+            }
+            t_slot = { m_instanceId, threadCaches.get() };
+        }
+
+        return *t_slot.caches;
+    }
+
+    DescriptorHandle DescriptorHeapManager::AllocateCached(DescriptorHeap* heap)
+    {
+        if (heap->GetCacheBatchSize() == 0)
+        {
+            return heap->Allocate();
+        }
+        return heap->Allocate(GetThreadCaches().caches[heap->GetType()]);
+    }
+
+    void DescriptorHeapManager::FreeCached(DescriptorHeap* heap, const DescriptorHandle& handle)
+    {
+        if (heap->GetCacheBatchSize() == 0)
+        {
+            heap->Free(handle);
+            return;
+        }
+        heap->Free(handle, GetThreadCaches().caches[heap->GetType()]);
+    }
+
+    void DescriptorHeapManager::DrainThreadCaches(ThreadCaches& threadCaches)
+    {
+        // RTV/DSV는 페이지 힙이 직접 잠그므로 캐시 대상이 아님
+        DescriptorHeap* heaps[] = { m_cbvSrvUavHeap.get(), m_samplerHeap.get() };
+        for (DescriptorHeap* heap : heaps)
+        {
+            if (heap)
+            {
+                heap->DrainCache(threadCaches.caches[heap->GetType()]);
+            }
         }
     }
 }
@@ -3,12 +3,27 @@
  * @brief 모든 디스크립터 힙 통합 관리
  *
  * RTV, DSV, CBV_SRV_UAV, Sampler 힙을 한 곳에서 관리합니다.
+ * RTV/DSV와 CPU 스테이징 CBV/SRV/UAV/Sampler 힙은 페이지 단위로 커지며,
+ * 스테이징 디스크립터는 배치로 모아 셰이더 가시 힙에 복사합니다.
+ * 셰이더 가시 CBV/SRV/UAV 힙의 일부는 프레임 단위 임시 디스크립터 링으로 예약합니다.
+ * 셰이더 가시 CBV/SRV/UAV 및 Sampler 힙의 일부는 바인드리스 테이블로 예약합니다.
+ * 내용이 같은 Sampler와 불변 SRV는 중복 제거 캐시로 하나의 디스크립터를 공유합니다.
+ * 단일 디스크립터 할당/해제는 스레드별 인덱스 캐시를 거치므로 로더 스레드에서 잠금 없이 호출할 수 있습니다.
  */
 
 #pragma once
 
 #include "DescriptorHeap.h"
+#include "BindlessDescriptorTable.h"
+#include "DescriptorCopyBatch.h"
+#include "DescriptorDedupCache.h"
+#include "PagedDescriptorHeap.h"
+#include "TransientDescriptorRing.h"
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace DX12GameEngine
 {
@@ -17,16 +32,26 @@ namespace DX12GameEngine
      */
     struct DescriptorHeapManagerDesc
     {
-        uint32_t numRtvDescriptors;         // RTV 힙 크기
-        uint32_t numDsvDescriptors;         // DSV 힙 크기
-        uint32_t numCbvSrvUavDescriptors;   // CBV/SRV/UAV 힙 크기 (셰이더 가시)
+        uint32_t numRtvDescriptors;         // RTV 힙 페이지 크기 (가득 차면 페이지 추가)
+        uint32_t numDsvDescriptors;         // DSV 힙 페이지 크기 (가득 차면 페이지 추가)
+        uint32_t numCbvSrvUavDescriptors;   // CBV/SRV/UAV 힙 크기 (셰이더 가시, 영구 할당용)
+        uint32_t numTransientCbvSrvUavDescriptors;  // CBV/SRV/UAV 힙에 추가로 예약하는 프레임 단위 링 크기 (0이면 사용 안 함)
         uint32_t numSamplerDescriptors;     // Sampler 힙 크기 (셰이더 가시)
+        uint32_t numCpuCbvSrvUavDescriptors;    // CPU 스테이징 CBV/SRV/UAV 힙 페이지 크기
+        uint32_t numCpuSamplerDescriptors;      // CPU 스테이징 Sampler 힙 페이지 크기
+        uint32_t numBindlessResourceDescriptors;    // CBV/SRV/UAV 힙에 추가로 예약하는 바인드리스 테이블 크기 (0이면 사용 안 함)
+        uint32_t numBindlessSamplerDescriptors;     // Sampler 힙에 추가로 예약하는 바인드리스 테이블 크기 (0이면 사용 안 함)
 
         DescriptorHeapManagerDesc()
             : numRtvDescriptors(64)
             , numDsvDescriptors(16)
             , numCbvSrvUavDescriptors(1024)
+            , numTransientCbvSrvUavDescriptors(4096)
             , numSamplerDescriptors(64)
+            , numCpuCbvSrvUavDescriptors(1024)
+            , numCpuSamplerDescriptors(256)
+            , numBindlessResourceDescriptors(4096)
+            , numBindlessSamplerDescriptors(256)
         {
         }
     };
@@ -35,6 +60,8 @@ namespace DX12GameEngine
      * @brief 모든 디스크립터 힙을 통합 관리하는 클래스
      *
      * 타입별로 디스크립터 힙을 생성하고 관리합니다.
+     * Allocate/Free 계열은 스레드 안전하며, 스레드마다 힙 타입별 인덱스 캐시를 두어
+     * 공유 힙은 배치 단위로만 잠급니다.
      */
     class DescriptorHeapManager
     {
@@ -71,11 +98,71 @@ namespace DX12GameEngine
          */
         DescriptorHandle AllocateCbvSrvUav();
 
+        /**
+         * @brief CPU 스테이징 CBV/SRV/UAV 디스크립터 할당 (셰이더 비가시, 용량 제한 없음)
+         *
+         * 뷰를 여기에 만들어 두고 CopyCbvSrvUavToShaderVisible로 셰이더 가시 힙에 복사합니다.
+         */
+        DescriptorHandle AllocateCpuCbvSrvUav();
+
+        /**
+         * @brief CPU 스테이징 Sampler 디스크립터 할당 (셰이더 비가시, 용량 제한 없음)
+         */
+        DescriptorHandle AllocateCpuSampler();
+
+        /**
+         * @brief 현재 프레임용 연속 CBV/SRV/UAV 디스크립터 할당 (스레드 안전)
+         *
+         * 개별 해제하지 않습니다. 프레임의 Fence가 완료되면 링에서 한꺼번에 회수됩니다.
+         *
+         * @param count 디스크립터 개수
+         * @return 첫 디스크립터 핸들 (실패 시 IsValid() == false)
+         */
+        DescriptorHandle AllocateTransientCbvSrvUav(uint32_t count);
+
+        /**
+         * @brief 프레임 시작 - 완료된 Fence까지의 지연 해제와 임시 디스크립터 회수
+         * @param completedFenceValue GPU가 완료한 Fence 값
+         */
+        void BeginFrame(uint64_t completedFenceValue);
+
+        /**
+         * @brief 프레임 종료 - 이번 프레임의 임시 디스크립터를 Fence 값과 함께 기록
+         * @param fenceValue 이번 프레임의 Fence 값
+         */
+        void EndFrame(uint64_t fenceValue);
+
         /**
          * @brief Sampler 디스크립터 할당
          */
         DescriptorHandle AllocateSampler();
 
+        /**
+         * @brief 같은 설명의 Sampler를 공유 (셰이더 가시 Sampler 힙, 없으면 생성)
+         * @param desc Sampler 설명 (= {}로 초기화한 값)
+         * @return 공유 디스크립터 (ReleaseSharedSampler로 반환, 실패 시 IsValid() == false)
+         */
+        DescriptorHandle AcquireSharedSampler(const D3D12_SAMPLER_DESC& desc);
+
+        /**
+         * @brief 같은 리소스/설명의 불변 SRV를 공유 (셰이더 가시 CBV/SRV/UAV 힙, 없으면 생성)
+         * @param resource 대상 리소스 (nullptr이면 null 디스크립터)
+         * @param desc SRV 설명 (= {}로 초기화한 값, nullptr이면 리소스 기본 뷰)
+         * @return 공유 디스크립터 (ReleaseSharedShaderResourceView로 반환, 실패 시 IsValid() == false)
+         */
+        DescriptorHandle AcquireSharedShaderResourceView(ID3D12Resource* resource,
+                                                         const D3D12_SHADER_RESOURCE_VIEW_DESC* desc);
+
+        /**
+         * @brief 공유 Sampler 참조 반환 (마지막 참조면 fenceValue 완료 후 해제)
+         */
+        void ReleaseSharedSampler(const DescriptorHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief 공유 SRV 참조 반환 (마지막 참조면 fenceValue 완료 후 해제)
+         */
+        void ReleaseSharedShaderResourceView(const DescriptorHandle& handle, uint64_t fenceValue);
+
         /**
          * @brief RTV 디스크립터 해제
          */
@@ -97,14 +184,99 @@ namespace DX12GameEngine
         void FreeSampler(const DescriptorHandle& handle);
 
         /**
-         * @brief RTV 힙 가져오기
+         * @brief CPU 스테이징 CBV/SRV/UAV 디스크립터 해제
+         *
+         * 복사는 즉시 수행되므로 FlushDescriptorCopies 이후에는 바로 해제해도 됩니다.
+         */
+        void FreeCpuCbvSrvUav(const DescriptorHandle& handle);
+
+        /**
+         * @brief CPU 스테이징 Sampler 디스크립터 해제
+         */
+        void FreeCpuSampler(const DescriptorHandle& handle);
+
+        /**
+         * @brief 스테이징 CBV/SRV/UAV 디스크립터를 셰이더 가시 힙으로 복사 예약 (스레드 안전)
+         * @param destination 셰이더 가시 힙의 첫 대상 (AllocateCbvSrvUav / AllocateTransientCbvSrvUav 결과)
+         * @param source AllocateCpuCbvSrvUav로 할당한 첫 원본
+         * @param count 연속 디스크립터 개수 (원본은 같은 페이지 안에 있어야 함)
+         */
+        void CopyCbvSrvUavToShaderVisible(const DescriptorHandle& destination, const DescriptorHandle& source,
+                                          uint32_t count = 1);
+
+        /**
+         * @brief 스테이징 Sampler 디스크립터를 셰이더 가시 힙으로 복사 예약 (스레드 안전)
+         */
+        void CopySamplerToShaderVisible(const DescriptorHandle& destination, const DescriptorHandle& source,
+                                        uint32_t count = 1);
+
+        /**
+         * @brief 예약된 복사를 타입별 CopyDescriptors 호출 한 번으로 수행
+         *
+         * 복사된 디스크립터를 참조하는 커맨드 리스트를 실행하기 전에 호출해야 합니다.
+         */
+        void FlushDescriptorCopies();
+
+        /**
+         * @brief 스테이징 SRV/UAV/CBV 디스크립터를 바인드리스 테이블에 등록
+         * @param source AllocateCpuCbvSrvUav로 할당해 뷰를 만든 디스크립터 (등록 후 해제해도 됨, FlushDescriptorCopies 이후)
+         * @return 바인드리스 핸들 (GetShaderIndex()를 셰이더에 전달, 실패 시 IsValid() == false)
          */
-        DescriptorHeap* GetRtvHeap() { return m_rtvHeap.get(); }
+        BindlessHandle RegisterBindlessResource(const DescriptorHandle& source);
 
         /**
-         * @brief DSV 힙 가져오기
+         * @brief 스테이징 Sampler 디스크립터를 바인드리스 테이블에 등록
          */
-        DescriptorHeap* GetDsvHeap() { return m_dsvHeap.get(); }
+        BindlessHandle RegisterBindlessSampler(const DescriptorHandle& source);
+
+        /**
+         * @brief 바인드리스 리소스 등록 해제 (슬롯은 fenceValue 완료 후 재사용)
+         */
+        void ReleaseBindlessResource(const BindlessHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief 바인드리스 Sampler 등록 해제 (슬롯은 fenceValue 완료 후 재사용)
+         */
+        void ReleaseBindlessSampler(const BindlessHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief RTV 디스크립터 지연 해제 (fenceValue 완료 후 BeginFrame에서 반환)
+         */
+        void FreeRtvDeferred(const DescriptorHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief DSV 디스크립터 지연 해제 (fenceValue 완료 후 BeginFrame에서 반환)
+         */
+        void FreeDsvDeferred(const DescriptorHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief CBV/SRV/UAV 디스크립터 지연 해제 (fenceValue 완료 후 BeginFrame에서 반환)
+         */
+        void FreeCbvSrvUavDeferred(const DescriptorHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief Sampler 디스크립터 지연 해제 (fenceValue 완료 후 BeginFrame에서 반환)
+         */
+        void FreeSamplerDeferred(const DescriptorHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief 호출 스레드의 인덱스 캐시를 힙에 반환
+         *
+         * 디스크립터를 할당/해제한 작업 스레드가 종료되기 전에 호출하면
+         * 캐시된 인덱스를 다른 스레드가 바로 사용할 수 있습니다.
+         * 호출하지 않아도 관리자 소멸 시 모두 반환됩니다.
+         */
+        void FlushThreadCache();
+
+        /**
+         * @brief RTV 힙 가져오기 (페이지 단위로 커짐)
+         */
+        PagedDescriptorHeap* GetRtvHeap() { return m_rtvHeap.get(); }
+
+        /**
+         * @brief DSV 힙 가져오기 (페이지 단위로 커짐)
+         */
+        PagedDescriptorHeap* GetDsvHeap() { return m_dsvHeap.get(); }
 
         /**
          * @brief CBV/SRV/UAV 힙 가져오기 (셰이더 가시)
@@ -116,11 +288,96 @@ namespace DX12GameEngine
          */
         DescriptorHeap* GetSamplerHeap() { return m_samplerHeap.get(); }
 
+        /**
+         * @brief CBV/SRV/UAV 임시 디스크립터 링 가져오기
+         */
+        TransientDescriptorRing* GetTransientCbvSrvUavRing() { return m_transientCbvSrvUavRing.get(); }
+
+        /**
+         * @brief 바인드리스 리소스(CBV/SRV/UAV) 테이블 가져오기
+         */
+        BindlessDescriptorTable* GetBindlessResourceTable() { return m_bindlessResourceTable.get(); }
+
+        /**
+         * @brief 바인드리스 Sampler 테이블 가져오기
+         */
+        BindlessDescriptorTable* GetBindlessSamplerTable() { return m_bindlessSamplerTable.get(); }
+
+        /**
+         * @brief Sampler 중복 제거 캐시 가져오기
+         */
+        DescriptorDedupCache* GetSamplerDedupCache() { return m_samplerDedupCache.get(); }
+
+        /**
+         * @brief 불변 SRV 중복 제거 캐시 가져오기
+         */
+        DescriptorDedupCache* GetShaderResourceDedupCache() { return m_shaderResourceDedupCache.get(); }
+
+        /**
+         * @brief CPU 스테이징 CBV/SRV/UAV 힙 가져오기
+         */
+        PagedDescriptorHeap* GetCpuCbvSrvUavHeap() { return m_cpuCbvSrvUavHeap.get(); }
+
+        /**
+         * @brief CPU 스테이징 Sampler 힙 가져오기
+         */
+        PagedDescriptorHeap* GetCpuSamplerHeap() { return m_cpuSamplerHeap.get(); }
+
     private:
-        std::unique_ptr<DescriptorHeap> m_rtvHeap;
-        std::unique_ptr<DescriptorHeap> m_dsvHeap;
+        /**
+         * @brief 한 스레드의 힙 타입별 인덱스 캐시
+         */
+        struct ThreadCaches
+        {
+            DescriptorIndexCache caches[D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES];
+        };
+
+        /**
+         * @brief 호출 스레드의 캐시 (처음 호출 시 등록)
+         */
+        ThreadCaches& GetThreadCaches();
+
+        /**
+         * @brief 스레드 캐시를 거쳐 할당
+         */
+        DescriptorHandle AllocateCached(DescriptorHeap* heap);
+
+        /**
+         * @brief 스레드 캐시를 거쳐 해제
+         */
+        void FreeCached(DescriptorHeap* heap, const DescriptorHandle& handle);
+
+        /**
+         * @brief 캐시 묶음을 힙 타입별로 반환
+         */
+        void DrainThreadCaches(ThreadCaches& threadCaches);
+
+    private:
+        std::unique_ptr<PagedDescriptorHeap> m_rtvHeap;
+        std::unique_ptr<PagedDescriptorHeap> m_dsvHeap;
         std::unique_ptr<DescriptorHeap> m_cbvSrvUavHeap;
         std::unique_ptr<DescriptorHeap> m_samplerHeap;
+        std::unique_ptr<TransientDescriptorRing> m_transientCbvSrvUavRing;
+
+        // CPU 스테이징 힙과 셰이더 가시 힙으로의 복사 배치
+        std::unique_ptr<PagedDescriptorHeap> m_cpuCbvSrvUavHeap;
+        std::unique_ptr<PagedDescriptorHeap> m_cpuSamplerHeap;
+        DescriptorCopyBatch m_cbvSrvUavCopyBatch;
+        DescriptorCopyBatch m_samplerCopyBatch;
+
+        // 바인드리스 테이블 (셰이더 가시 힙의 예약 구간)
+        std::unique_ptr<BindlessDescriptorTable> m_bindlessResourceTable;
+        std::unique_ptr<BindlessDescriptorTable> m_bindlessSamplerTable;
+
+        // 내용이 같은 디스크립터 공유 (힙보다 먼저 소멸)
+        std::unique_ptr<DescriptorDedupCache> m_samplerDedupCache;
+        std::unique_ptr<DescriptorDedupCache> m_shaderResourceDedupCache;
+
+        // 스레드별 캐시 (소멸 시 모두 반환)
+        std::mutex m_threadCacheMutex;
+        std::unordered_map<std::thread::id, std::unique_ptr<ThreadCaches>> m_threadCaches;
+        uint64_t m_instanceId;                          // thread_local 캐시 포인터의 소유자 식별 (재사용 안 함)
+        static std::atomic<uint64_t> s_nextInstanceId;
 
         bool m_initialized;
     };
@@ -0,0 +1,75 @@
+/**
+ * @file DescriptorIndexCache.cpp
+ * @brief 스레드별 디스크립터 인덱스 캐시 구현
+ */
+
+#include "DescriptorIndexCache.h"
+#include <algorithm>
+#include <cstring>
+
+namespace DX12GameEngine
+{
+    DescriptorIndexCache::DescriptorIndexCache()
+        : m_indices{}
+        , m_count(0)
+    {
+    }
+
+    uint32_t DescriptorIndexCache::Allocate(DescriptorFreeList& pool, std::mutex& poolMutex, uint32_t batchSize)
+    {
+        if (m_count == 0)
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            m_count = pool.AllocateBatch(m_indices, std::clamp(batchSize, 1u, kMaxBatchSize));
+            if (m_count == 0)
+            {
+                return DescriptorFreeList::kInvalidIndex;
+            }
+
+            // 낮은 인덱스부터 꺼내도록 뒤집음 (LIFO)
+            std::reverse(m_indices, m_indices + m_count);
+        }
+
+        return m_indices[--m_count];
+    }
+
+    bool DescriptorIndexCache::Free(uint32_t index, DescriptorFreeList& pool, std::mutex& poolMutex, uint32_t batchSize)
+    {
+        // 같은 스레드에서 두 번 해제하면 같은 인덱스가 두 번 할당되므로 캐시 안에서 검사
+        if (std::find(m_indices, m_indices + m_count, index) != m_indices + m_count)
+        {
+            return false;
+        }
+
+        batchSize = std::clamp(batchSize, 1u, kMaxBatchSize);
+        if (m_count >= batchSize * 2)
+        {
+            // 가장 오래된 batchSize개 반환 (최근 해제한 인덱스는 캐시에 남김)
+            {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                pool.FreeBatch(m_indices, batchSize);
+            }
+            m_count -= batchSize;
+            std::memmove(m_indices, m_indices + batchSize, m_count * sizeof(uint32_t));
+        }
+
+        m_indices[m_count++] = index;
+        return true;
+    }
+
+    uint32_t DescriptorIndexCache::Drain(DescriptorFreeList& pool, std::mutex& poolMutex)
+    {
+        if (m_count == 0)
+        {
+            return 0;
+        }
+
+        uint32_t freed = 0;
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            freed = pool.FreeBatch(m_indices, m_count);
+        }
+        m_count = 0;
+        return freed;
+    }
+}
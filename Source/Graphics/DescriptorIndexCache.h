@@ -0,0 +1,65 @@
+/**
+ * @file DescriptorIndexCache.h
+ * @brief 스레드별 디스크립터 인덱스 캐시
+ *
+ * 공유 프리 리스트(중앙 풀)에서 인덱스를 배치 단위로 미리 받아 두고,
+ * 스레드가 잠금 없이 할당/해제하도록 합니다. 중앙 풀의 뮤텍스는
+ * 배치를 보충하거나 반환할 때만 잡습니다 (디스크립터당이 아니라 배치당 한 번).
+ *
+ * 캐시 자체는 한 스레드만 사용해야 합니다. D3D12에 의존하지 않으므로 디바이스 없이 벤치마크할 수 있습니다.
+ */
+
+#pragma once
+
+#include "DescriptorFreeList.h"
+#include <mutex>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 스레드별 인덱스 캐시 (LIFO, 최근 해제한 인덱스를 먼저 재사용)
+     */
+    class DescriptorIndexCache
+    {
+    public:
+        static constexpr uint32_t kMaxBatchSize = 32;
+
+        DescriptorIndexCache();
+
+        // 복사 및 이동 금지
+        DescriptorIndexCache(const DescriptorIndexCache&) = delete;
+        DescriptorIndexCache& operator=(const DescriptorIndexCache&) = delete;
+        DescriptorIndexCache(DescriptorIndexCache&&) = delete;
+        DescriptorIndexCache& operator=(DescriptorIndexCache&&) = delete;
+
+        /**
+         * @brief 인덱스 할당 (비어 있으면 중앙 풀에서 batchSize개 보충)
+         * @param pool 중앙 프리 리스트
+         * @param poolMutex pool을 보호하는 뮤텍스
+         * @param batchSize 보충/반환 단위 (1 ~ kMaxBatchSize)
+         * @return 할당된 인덱스 (중앙 풀도 비었으면 DescriptorFreeList::kInvalidIndex)
+         */
+        uint32_t Allocate(DescriptorFreeList& pool, std::mutex& poolMutex, uint32_t batchSize);
+
+        /**
+         * @brief 인덱스 해제 (캐시가 가득 차면 오래된 batchSize개를 중앙 풀에 반환)
+         * @return 캐시에 이미 있는 인덱스(같은 스레드의 이중 해제)면 false
+         */
+        bool Free(uint32_t index, DescriptorFreeList& pool, std::mutex& poolMutex, uint32_t batchSize);
+
+        /**
+         * @brief 캐시에 남은 인덱스를 모두 중앙 풀에 반환
+         * @return 중앙 풀에 실제로 반환된 개수
+         */
+        uint32_t Drain(DescriptorFreeList& pool, std::mutex& poolMutex);
+
+        /**
+         * @brief 캐시에 보관 중인 인덱스 수
+         */
+        uint32_t GetCount() const { return m_count; }
+
+    private:
+        uint32_t m_indices[kMaxBatchSize * 2];
+        uint32_t m_count;
+    };
+}
@@ -11,6 +11,7 @@ namespace DX12GameEngine
 {
     Device::Device()
         : m_featureLevel(D3D_FEATURE_LEVEL_11_0)
+        , m_resourceBindingTier(D3D12_RESOURCE_BINDING_TIER_1)
         , m_initialized(false)
     {
     }
@@ -68,6 +69,9 @@ namespace DX12GameEngine
             return false;
         }
 
+        // 6. 리소스 바인딩 티어 확인
+        CheckResourceBindingTier();
+
         m_initialized = true;
 
         // 성공 메시지
@@ -86,6 +90,8 @@ namespace DX12GameEngine
         default: ss << L"Unknown\n"; break;
         }
 
+        ss << L"  - Resource Binding Tier: " << static_cast<int>(m_resourceBindingTier) << L"\n";
+
         OutputDebugStringW(ss.str().c_str());
 
         return true;
@@ -238,4 +244,18 @@ namespace DX12GameEngine
         m_featureLevel = D3D_FEATURE_LEVEL_11_0;
         return true;
     }
+
+    void Device::CheckResourceBindingTier()
+    {
+        D3D12_FEATURE_DATA_D3D12_OPTIONS options = {};
+
+        HRESULT hr = m_device->CheckFeatureSupport(
+            D3D12_FEATURE_D3D12_OPTIONS,
+            &options,
+            sizeof(options)
+        );
+
+        // 실패하면 가장 제한적인 티어로 간주
+        m_resourceBindingTier = SUCCEEDED(hr) ? options.ResourceBindingTier : D3D12_RESOURCE_BINDING_TIER_1;
+    }
 }
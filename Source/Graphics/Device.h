@@ -63,6 +63,12 @@ namespace DX12GameEngine
          */
         D3D_FEATURE_LEVEL GetFeatureLevel() const { return m_featureLevel; }
 
+        /**
+         * @brief 리소스 바인딩 티어 가져오기 (디스크립터 테이블 크기 제한)
+         * @return D3D12_RESOURCE_BINDING_TIER
+         */
+        D3D12_RESOURCE_BINDING_TIER GetResourceBindingTier() const { return m_resourceBindingTier; }
+
     private:
         /**
          * @brief Debug Layer 활성화
@@ -94,6 +100,11 @@ namespace DX12GameEngine
          */
         bool CheckFeatureLevel();
 
+        /**
+         * @brief 리소스 바인딩 티어 확인 (실패 시 Tier 1로 간주)
+         */
+        void CheckResourceBindingTier();
+
     private:
         // DXGI 객체
         ComPtr<IDXGIFactory4> m_factory;
@@ -105,6 +116,7 @@ namespace DX12GameEngine
         // 디바이스 정보
         std::wstring m_adapterDescription;
         D3D_FEATURE_LEVEL m_featureLevel;
+        D3D12_RESOURCE_BINDING_TIER m_resourceBindingTier;
 
         // 초기화 플래그
         bool m_initialized;
@@ -0,0 +1,333 @@
+/**
+ * @file FenceTimeline.cpp
+ * @brief Fence 완료 콜백과 공용 대기 스레드 구현
+ */
+
+#include "FenceTimeline.h"
+#include <Utils/Logger.h>
+#include <algorithm>
+
+namespace DX12GameEngine
+{
+    bool FenceAwaiter::await_suspend(std::coroutine_handle<> handle)
+    {
+        if (m_timeline.OnCompleted(m_fence, m_value, [handle]() { handle.resume(); }, m_thread))
+        {
+            return true;
+        }
+
+        // 등록할 수 없으면 직접 기다린 뒤 중단 없이 계속
+        m_timeline.Wait(m_fence, m_value);
+        return false;
+    }
+
+    FenceTimeline::FenceTimeline()
+        : m_nextSequence(0)
+        , m_pendingCount(0)
+        , m_wakeEvent(nullptr)
+        , m_stopRequested(false)
+        , m_running(false)
+    {
+    }
+
+    FenceTimeline::~FenceTimeline()
+    {
+        Shutdown();
+    }
+
+    bool FenceTimeline::Initialize()
+    {
+        if (m_running)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"FenceTimeline already initialized");
+            return true;
+        }
+
+        m_wakeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        if (!m_wakeEvent)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to create FenceTimeline wake event");
+            return false;
+        }
+
+        m_stopRequested = false;
+        m_running.store(true, std::memory_order_release);
+        m_waiterThread = std::thread(&FenceTimeline::WaiterThreadMain, this);
+
+        LOG_INFO(LogCategory::Renderer, L"FenceTimeline initialized");
+        return true;
+    }
+
+    void FenceTimeline::Shutdown()
+    {
+        if (!m_running)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopRequested = true;
+        }
+        SetEvent(m_wakeEvent);
+        m_waiterThread.join();
+        m_running.store(false, std::memory_order_release);
+
+        // 이미 완료된 콜백은 실행하고, 완료되지 않은 콜백만 버림
+        std::vector<Callback> waiterCallbacks;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            CollectCompletedLocked(waiterCallbacks);
+        }
+        for (Callback& callback : waiterCallbacks)
+        {
+            callback();
+        }
+        DispatchCompleted();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pendingCount > 0)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"FenceTimeline shut down with {} incomplete callbacks dropped",
+                        m_pendingCount);
+        }
+
+        for (FenceWaitList& list : m_fences)
+        {
+            CloseHandle(list.event);
+        }
+        m_fences.clear();
+        m_mainReady.clear();
+        m_pendingCount = 0;
+
+        CloseHandle(m_wakeEvent);
+        m_wakeEvent = nullptr;
+
+        LOG_INFO(LogCategory::Renderer, L"FenceTimeline shut down");
+    }
+
+    bool FenceTimeline::OnCompleted(ID3D12Fence* fence, uint64_t value, Callback callback,
+                                    FenceCallbackThread thread)
+    {
+        if (!fence || !callback)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"FenceTimeline::OnCompleted - fence or callback is null");
+            return false;
+        }
+
+        bool wake = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_running.load(std::memory_order_relaxed) || m_stopRequested)
+            {
+                LOG_WARNING(LogCategory::Renderer, L"FenceTimeline::OnCompleted - not running");
+                return false;
+            }
+
+            auto it = std::find_if(m_fences.begin(), m_fences.end(),
+                                   [fence](const FenceWaitList& list) { return list.fence.Get() == fence; });
+            if (it == m_fences.end())
+            {
+                if (m_fences.size() >= kMaxFences)
+                {
+                    LOG_ERROR(LogCategory::Renderer, L"FenceTimeline::OnCompleted - too many fences (max {})",
+                              kMaxFences);
+                    return false;
+                }
+
+                HANDLE event = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+                if (!event)
+                {
+                    LOG_ERROR(LogCategory::Renderer, L"Failed to create FenceTimeline fence event");
+                    return false;
+                }
+
+                FenceWaitList list;
+                list.fence = fence;
+                list.event = event;
+                m_fences.push_back(std::move(list));
+                it = m_fences.end() - 1;
+            }
+
+            // 대기 스레드가 기다리는 값보다 이른 값일 때만 깨움
+            wake = it->pending.empty() || value < it->pending.front().value;
+
+            it->pending.push_back({ value, m_nextSequence++, thread, std::move(callback) });
+            std::push_heap(it->pending.begin(), it->pending.end());
+            m_pendingCount++;
+        }
+
+        if (wake)
+        {
+            SetEvent(m_wakeEvent);
+        }
+        return true;
+    }
+
+    uint32_t FenceTimeline::DispatchCompleted()
+    {
+        // 콜백이 다시 등록/대기할 수 있도록 잠금 밖에서 실행
+        std::vector<Callback> ready;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_mainReady.empty())
+            {
+                return 0;
+            }
+            ready.swap(m_mainReady);
+        }
+
+        for (Callback& callback : ready)
+        {
+            callback();
+        }
+        return static_cast<uint32_t>(ready.size());
+    }
+
+    void FenceTimeline::Wait(ID3D12Fence* fence, uint64_t value)
+    {
+        if (!fence || fence->GetCompletedValue() >= value)
+        {
+            return;
+        }
+
+        // 완료 시 메인 스레드를 깨우는 콜백 (조건 검사 중에 통지를 놓치지 않도록 잠근 뒤 통지)
+        const bool registered = OnCompleted(fence, value, [this]()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_mainCondition.notify_all();
+        }, FenceCallbackThread::Waiter);
+
+        if (!registered)
+        {
+            // 이벤트 없이 완료까지 블로킹
+            HRESULT hr = fence->SetEventOnCompletion(value, nullptr);
+            if (FAILED(hr))
+            {
+                LOG_ERROR(LogCategory::Renderer, L"Failed to wait for fence (HRESULT: {:#x})",
+                          static_cast<uint32_t>(hr));
+            }
+            return;
+        }
+
+        // 기다리는 동안 완료되는 Main 콜백을 실행 (정말 할 일이 없을 때만 잠듦)
+        for (;;)
+        {
+            DispatchCompleted();
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_mainCondition.wait(lock, [&]()
+            {
+                return !m_mainReady.empty() || fence->GetCompletedValue() >= value;
+            });
+
+            if (fence->GetCompletedValue() >= value)
+            {
+                break;
+            }
+        }
+    }
+
+    uint32_t FenceTimeline::GetPendingCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pendingCount;
+    }
+
+    void FenceTimeline::WaiterThreadMain()
+    {
+        std::vector<Callback> callbacks;
+        std::vector<HANDLE> handles;
+
+        for (;;)
+        {
+            callbacks.clear();
+            handles.clear();
+            bool mainReady = false;
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_stopRequested)
+                {
+                    break;
+                }
+
+                mainReady = CollectCompletedLocked(callbacks);
+
+                // 완료된 것이 없으면 Fence마다 가장 이른 값에 이벤트를 걸고 함께 대기
+                if (callbacks.empty() && !mainReady)
+                {
+                    for (FenceWaitList& list : m_fences)
+                    {
+                        if (list.pending.empty())
+                        {
+                            continue;
+                        }
+
+                        HRESULT hr = list.fence->SetEventOnCompletion(list.pending.front().value, list.event);
+                        if (FAILED(hr))
+                        {
+                            LOG_ERROR_EVERY_MS(LogCategory::Renderer, 1000,
+                                               L"Failed to set fence event (HRESULT: {:#x})",
+                                               static_cast<uint32_t>(hr));
+                            continue;
+                        }
+                        handles.push_back(list.event);
+                    }
+                }
+            }
+
+            if (mainReady)
+            {
+                m_mainCondition.notify_all();
+            }
+
+            if (!callbacks.empty() || mainReady)
+            {
+                for (Callback& callback : callbacks)
+                {
+                    callback();
+                }
+                continue;
+            }
+
+            handles.push_back(m_wakeEvent);
+            WaitForMultipleObjects(static_cast<DWORD>(handles.size()), handles.data(), FALSE, INFINITE);
+        }
+    }
+
+    bool FenceTimeline::CollectCompletedLocked(std::vector<Callback>& outCallbacks)
+    {
+        bool mainReady = false;
+
+        for (FenceWaitList& list : m_fences)
+        {
+            if (list.pending.empty())
+            {
+                continue;
+            }
+
+            const uint64_t completedValue = list.fence->GetCompletedValue();
+            while (!list.pending.empty() && list.pending.front().value <= completedValue)
+            {
+                std::pop_heap(list.pending.begin(), list.pending.end());
+                PendingCallback& completed = list.pending.back();
+
+                if (completed.thread == FenceCallbackThread::Waiter)
+                {
+                    outCallbacks.push_back(std::move(completed.callback));
+                }
+                else
+                {
+                    m_mainReady.push_back(std::move(completed.callback));
+                    mainReady = true;
+                }
+
+                list.pending.pop_back();
+                m_pendingCount--;
+            }
+        }
+
+        return mainReady;
+    }
+}
@@ -0,0 +1,218 @@
+/**
+ * @file FenceTimeline.h
+ * @brief Fence 완료 콜백과 공용 대기 스레드
+ *
+ * "Fence가 값 V에 도달하면 이 작업을 실행" 형태의 콜백을 등록받아,
+ * 백그라운드 대기 스레드 하나가 모든 큐의 Fence를 함께 기다리고 완료된 콜백을 내보냅니다.
+ * 리소스 해제, Allocator 재활용, Readback 마무리처럼 GPU 완료 뒤에 할 일을 블로킹 없이 예약할 수 있습니다.
+ *
+ * 콜백은 실행 스레드를 고를 수 있습니다.
+ * - FenceCallbackThread::Main: 메인 스레드가 DispatchCompleted()나 Wait() 안에서 실행 (스레드 안전하지 않은 객체용)
+ * - FenceCallbackThread::Waiter: 대기 스레드에서 바로 실행 (짧고 스레드 안전한 작업만)
+ *
+ * C++20 코루틴에서는 co_await timeline.WaitAsync(fence, value)로 Fence 완료를 기다릴 수 있습니다.
+ */
+
+#pragma once
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <atomic>
+#include <coroutine>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief Fence 완료 콜백을 실행할 스레드
+     */
+    enum class FenceCallbackThread : uint8_t
+    {
+        Main,       // DispatchCompleted() / Wait()를 호출한 메인 스레드
+        Waiter      // 백그라운드 대기 스레드
+    };
+
+    class FenceTimeline;
+
+    /**
+     * @brief Fence 값 완료를 기다리는 C++20 awaitable
+     *
+     * 이미 완료되었으면 중단 없이 계속하고, 아니면 완료 콜백에서 코루틴을 재개합니다.
+     */
+    class FenceAwaiter
+    {
+    public:
+        FenceAwaiter(FenceTimeline& timeline, ID3D12Fence* fence, uint64_t value, FenceCallbackThread thread)
+            : m_timeline(timeline)
+            , m_fence(fence)
+            , m_value(value)
+            , m_thread(thread)
+        {
+        }
+
+        bool await_ready() const { return !m_fence || m_fence->GetCompletedValue() >= m_value; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        void await_resume() const {}
+
+    private:
+        FenceTimeline& m_timeline;
+        ID3D12Fence* m_fence;
+        uint64_t m_value;
+        FenceCallbackThread m_thread;
+    };
+
+    /**
+     * @brief Fence 완료 콜백 서비스
+     *
+     * 사용 흐름:
+     * 1. Initialize() - 대기 스레드 시작
+     * 2. OnCompleted(fence, value, callback) - 아무 스레드에서나 콜백 등록
+     * 3. 메인 루프에서 DispatchCompleted() - 완료된 Main 콜백 실행
+     * 4. 정말 할 일이 없을 때만 Wait(fence, value) - 기다리는 동안에도 Main 콜백을 실행
+     *
+     * 같은 Fence에서 값이 같은 콜백은 등록 순서대로 실행됩니다.
+     * 한 번에 기다릴 수 있는 Fence는 kMaxFences개입니다 (WaitForMultipleObjects 제한).
+     */
+    class FenceTimeline
+    {
+    public:
+        using Callback = std::function<void()>;
+
+        /** @brief 동시에 추적할 수 있는 최대 Fence 수 (깨우기 이벤트 1개 제외) */
+        static constexpr uint32_t kMaxFences = MAXIMUM_WAIT_OBJECTS - 1;
+
+        FenceTimeline();
+        ~FenceTimeline();
+
+        // 복사 및 이동 금지
+        FenceTimeline(const FenceTimeline&) = delete;
+        FenceTimeline& operator=(const FenceTimeline&) = delete;
+        FenceTimeline(FenceTimeline&&) = delete;
+        FenceTimeline& operator=(FenceTimeline&&) = delete;
+
+        /**
+         * @brief 초기화 (대기 스레드 시작)
+         * @return 성공 시 true
+         */
+        bool Initialize();
+
+        /**
+         * @brief 종료 (대기 스레드 정지, 이미 완료된 콜백은 실행하고 나머지는 버림)
+         */
+        void Shutdown();
+
+        /**
+         * @brief Fence 완료 콜백 등록 (스레드 안전)
+         *
+         * 이미 완료된 값이어도 바로 실행하지 않고 지정한 스레드에서 실행합니다.
+         *
+         * @param fence 기다릴 Fence (콜백이 끝날 때까지 참조를 유지)
+         * @param value 기다릴 Fence 값
+         * @param callback 완료 후 실행할 작업
+         * @param thread 실행 스레드
+         * @return 등록 성공 시 true (초기화 전이거나 Fence 수 초과 시 false)
+         */
+        bool OnCompleted(ID3D12Fence* fence, uint64_t value, Callback callback,
+                         FenceCallbackThread thread = FenceCallbackThread::Main);
+
+        /**
+         * @brief co_await용 awaitable 생성
+         * @param fence 기다릴 Fence
+         * @param value 기다릴 Fence 값
+         * @param thread 코루틴을 재개할 스레드
+         */
+        FenceAwaiter WaitAsync(ID3D12Fence* fence, uint64_t value,
+                               FenceCallbackThread thread = FenceCallbackThread::Main)
+        {
+            return FenceAwaiter(*this, fence, value, thread);
+        }
+
+        /**
+         * @brief 완료된 Main 콜백 실행 (메인 스레드에서 호출, 블로킹 없음)
+         *
+         * 콜백 안에서 OnCompleted / DispatchCompleted / Wait를 다시 호출해도 됩니다.
+         *
+         * @return 실행한 콜백 수
+         */
+        uint32_t DispatchCompleted();
+
+        /**
+         * @brief Fence 값 완료까지 대기 (메인 스레드에서 호출)
+         *
+         * 기다리는 동안 완료되는 Main 콜백을 계속 실행합니다.
+         * 초기화 전이거나 등록할 수 없으면 콜백 실행 없이 완료까지 블로킹합니다.
+         *
+         * @param fence 기다릴 Fence
+         * @param value 기다릴 Fence 값
+         */
+        void Wait(ID3D12Fence* fence, uint64_t value);
+
+        /**
+         * @brief 아직 완료되지 않은 콜백 수 (스레드 안전)
+         */
+        uint32_t GetPendingCount() const;
+
+        /**
+         * @brief 초기화 여부
+         */
+        bool IsRunning() const { return m_running.load(std::memory_order_acquire); }
+
+    private:
+        /**
+         * @brief 완료를 기다리는 콜백
+         */
+        struct PendingCallback
+        {
+            uint64_t value;
+            uint64_t sequence;      // 같은 값에서 등록 순서 유지
+            FenceCallbackThread thread;
+            Callback callback;
+
+            // std::push_heap은 최대 힙이므로 값이 작은 것이 front가 되도록 반대로 비교
+            bool operator<(const PendingCallback& other) const
+            {
+                return value != other.value ? value > other.value : sequence > other.sequence;
+            }
+        };
+
+        /**
+         * @brief Fence별 대기 목록
+         */
+        struct FenceWaitList
+        {
+            ComPtr<ID3D12Fence> fence;
+            HANDLE event;
+            std::vector<PendingCallback> pending;      // 최소 힙 (값, 등록 순서)
+        };
+
+        /**
+         * @brief 대기 스레드 메인 루프
+         */
+        void WaiterThreadMain();
+
+        /**
+         * @brief 완료된 콜백을 꺼내 Waiter 콜백은 outCallbacks로, Main 콜백은 m_mainReady로 이동 (m_mutex 잠근 상태)
+         * @return Main 콜백을 하나라도 옮겼으면 true
+         */
+        bool CollectCompletedLocked(std::vector<Callback>& outCallbacks);
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_mainCondition;    // Main 콜백 도착 또는 Fence 완료 통지
+        std::vector<FenceWaitList> m_fences;
+        std::vector<Callback> m_mainReady;          // 메인 스레드에서 실행할 완료 콜백
+        uint64_t m_nextSequence;
+        uint32_t m_pendingCount;
+
+        std::thread m_waiterThread;
+        HANDLE m_wakeEvent;                         // 새 콜백 등록 / 종료 시 대기 스레드 깨우기
+        bool m_stopRequested;                       // m_mutex로 보호
+        std::atomic<bool> m_running;
+    };
+}
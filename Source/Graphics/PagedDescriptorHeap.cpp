@@ -0,0 +1,222 @@
+/**
+ * @file PagedDescriptorHeap.cpp
+ * @brief 페이지 단위로 커지는 CPU 디스크립터 힙 구현
+ */
+
+#include "PagedDescriptorHeap.h"
+#include <Utils/Logger.h>
+
+namespace DX12GameEngine
+{
+    PagedDescriptorHeap::PagedDescriptorHeap()
+        : m_device(nullptr)
+        , m_type(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)
+        , m_descriptorsPerPage(0)
+        , m_allocationPage(0)
+        , m_initialized(false)
+    {
+    }
+
+    PagedDescriptorHeap::~PagedDescriptorHeap()
+    {
+    }
+
+    bool PagedDescriptorHeap::Initialize(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type,
+                                         uint32_t descriptorsPerPage)
+    {
+        if (m_initialized)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"PagedDescriptorHeap already initialized");
+            return true;
+        }
+
+        if (!device || descriptorsPerPage == 0)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"PagedDescriptorHeap::Initialize - invalid parameters");
+            return false;
+        }
+
+        m_device = device;
+        m_type = type;
+        m_descriptorsPerPage = descriptorsPerPage;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!AddPage())
+        {
+            return false;
+        }
+
+        m_initialized = true;
+        return true;
+    }
+
+    DescriptorHandle PagedDescriptorHeap::Allocate()
+    {
+        if (!m_initialized)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"PagedDescriptorHeap::Allocate - not initialized");
+            return DescriptorHandle();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // 직전 페이지부터 빈 자리가 있는 페이지를 찾고, 없으면 페이지 추가
+        const uint32_t pageCount = static_cast<uint32_t>(m_pages.size());
+        uint32_t pageIndex = pageCount;
+        for (uint32_t i = 0; i < pageCount; i++)
+        {
+            const uint32_t candidate = (m_allocationPage + i) % pageCount;
+            if (m_pages[candidate]->GetAllocatedCount() < m_descriptorsPerPage)
+            {
+                pageIndex = candidate;
+                break;
+            }
+        }
+
+        if (pageIndex == pageCount && !AddPage())
+        {
+            return DescriptorHandle();
+        }
+
+        DescriptorHandle handle = m_pages[pageIndex]->Allocate();
+        if (handle.IsValid())
+        {
+            handle.heapIndex += pageIndex * m_descriptorsPerPage;
+            m_allocationPage = pageIndex;
+        }
+        return handle;
+    }
+
+    void PagedDescriptorHeap::Free(const DescriptorHandle& handle)
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        DescriptorHandle localHandle;
+        DescriptorHeap* page = FindPage(handle, localHandle);
+        if (!page)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"PagedDescriptorHeap::Free - invalid handle");
+            return;
+        }
+
+        page->Free(localHandle);
+
+        // 방금 빈 자리가 생긴 페이지부터 다시 채움
+        m_allocationPage = handle.heapIndex / m_descriptorsPerPage;
+    }
+
+    void PagedDescriptorHeap::FreeDeferred(const DescriptorHandle& handle, uint64_t fenceValue)
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        DescriptorHandle localHandle;
+        DescriptorHeap* page = FindPage(handle, localHandle);
+        if (!page)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"PagedDescriptorHeap::FreeDeferred - invalid handle");
+            return;
+        }
+
+        page->FreeDeferred(localHandle, fenceValue);
+    }
+
+    CompactDescriptorHandle PagedDescriptorHeap::ToCompact(const DescriptorHandle& handle) const
+    {
+        if (!m_initialized)
+        {
+            return CompactDescriptorHandle();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        DescriptorHandle localHandle;
+        const DescriptorHeap* page = FindPage(handle, localHandle);
+        return page ? page->ToCompact(localHandle) : CompactDescriptorHandle();
+    }
+
+    void PagedDescriptorHeap::ProcessDeferredFrees(uint64_t completedFenceValue)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& page : m_pages)
+        {
+            page->ProcessDeferredFrees(completedFenceValue);
+        }
+    }
+
+    uint32_t PagedDescriptorHeap::GetPageCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return static_cast<uint32_t>(m_pages.size());
+    }
+
+    uint32_t PagedDescriptorHeap::GetCapacity() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return static_cast<uint32_t>(m_pages.size()) * m_descriptorsPerPage;
+    }
+
+    uint32_t PagedDescriptorHeap::GetAllocatedCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        uint32_t count = 0;
+        for (const auto& page : m_pages)
+        {
+            count += page->GetAllocatedCount();
+        }
+        return count;
+    }
+
+    bool PagedDescriptorHeap::AddPage()
+    {
+        if (static_cast<uint64_t>(m_pages.size() + 1) * m_descriptorsPerPage >= UINT32_MAX)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"PagedDescriptorHeap - descriptor index space exhausted");
+            return false;
+        }
+
+        auto page = std::make_unique<DescriptorHeap>();
+        if (!page->Initialize(m_device, m_type, m_descriptorsPerPage, false))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"PagedDescriptorHeap - failed to create page {}", m_pages.size());
+            return false;
+        }
+
+        m_pages.push_back(std::move(page));
+        m_allocationPage = static_cast<uint32_t>(m_pages.size() - 1);
+
+        if (m_pages.size() > 1)
+        {
+            LOG_INFO(LogCategory::Renderer, L"PagedDescriptorHeap grew to {} pages ({} descriptors)",
+                     m_pages.size(), m_pages.size() * m_descriptorsPerPage);
+        }
+        return true;
+    }
+
+    DescriptorHeap* PagedDescriptorHeap::FindPage(const DescriptorHandle& handle, DescriptorHandle& localHandle) const
+    {
+        if (!handle.IsValid())
+        {
+            return nullptr;
+        }
+
+        const uint32_t pageIndex = handle.heapIndex / m_descriptorsPerPage;
+        if (pageIndex >= m_pages.size())
+        {
+            return nullptr;
+        }
+
+        localHandle = handle;
+        localHandle.heapIndex = handle.heapIndex % m_descriptorsPerPage;
+        return m_pages[pageIndex].get();
+    }
+}
@@ -0,0 +1,123 @@
+/**
+ * @file PagedDescriptorHeap.h
+ * @brief 페이지 단위로 커지는 CPU 디스크립터 힙
+ *
+ * 셰이더 비가시 힙을 고정 크기 페이지(DescriptorHeap)로 나눠, 가득 차면 페이지를 추가합니다.
+ * 용량은 메모리로만 제한됩니다. RTV/DSV와, 셰이더 가시 힙으로 복사하기 전의
+ * CBV/SRV/UAV/Sampler 스테이징 디스크립터에 사용합니다.
+ *
+ * 핸들의 heapIndex는 페이지를 이어 붙인 전역 인덱스(페이지 번호 * 페이지 크기 + 페이지 내 인덱스)입니다.
+ * 페이지는 줄어들지 않습니다. 할당/해제는 스레드 안전합니다.
+ */
+
+#pragma once
+
+#include "DescriptorHeap.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 페이지 단위로 커지는 셰이더 비가시 디스크립터 힙
+     */
+    class PagedDescriptorHeap
+    {
+    public:
+        PagedDescriptorHeap();
+        ~PagedDescriptorHeap();
+
+        // 복사 및 이동 금지
+        PagedDescriptorHeap(const PagedDescriptorHeap&) = delete;
+        PagedDescriptorHeap& operator=(const PagedDescriptorHeap&) = delete;
+        PagedDescriptorHeap(PagedDescriptorHeap&&) = delete;
+        PagedDescriptorHeap& operator=(PagedDescriptorHeap&&) = delete;
+
+        /**
+         * @brief 초기화 (첫 페이지 생성)
+         * @param device D3D12 디바이스 (페이지 추가에 사용하므로 힙보다 오래 살아야 함)
+         * @param type 힙 타입
+         * @param descriptorsPerPage 페이지당 디스크립터 개수
+         * @return 성공 시 true
+         */
+        bool Initialize(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, uint32_t descriptorsPerPage);
+
+        /**
+         * @brief 디스크립터 할당 (모든 페이지가 가득 차면 페이지 추가)
+         * @return 할당된 디스크립터 핸들 (페이지 생성 실패 시 IsValid() == false)
+         */
+        DescriptorHandle Allocate();
+
+        /**
+         * @brief 디스크립터 해제
+         */
+        void Free(const DescriptorHandle& handle);
+
+        /**
+         * @brief Fence 완료 후 디스크립터 해제 (DescriptorHeap::FreeDeferred 참고)
+         */
+        void FreeDeferred(const DescriptorHandle& handle, uint64_t fenceValue);
+
+        /**
+         * @brief 모든 페이지의 지연 해제 처리
+         */
+        void ProcessDeferredFrees(uint64_t completedFenceValue);
+
+        /**
+         * @brief 할당된 핸들을 세대 핸들로 변환 (힙 ID는 핸들이 속한 페이지)
+         *
+         * DescriptorHeap::ResolveCompact로 얻은 핸들의 heapIndex는 페이지 내 인덱스이므로,
+         * 해제에는 Allocate가 반환한 원래 핸들을 사용해야 합니다.
+         */
+        CompactDescriptorHandle ToCompact(const DescriptorHandle& handle) const;
+
+        /**
+         * @brief 힙 타입 가져오기
+         */
+        D3D12_DESCRIPTOR_HEAP_TYPE GetType() const { return m_type; }
+
+        /**
+         * @brief 페이지당 디스크립터 개수
+         */
+        uint32_t GetDescriptorsPerPage() const { return m_descriptorsPerPage; }
+
+        /**
+         * @brief 페이지 개수
+         */
+        uint32_t GetPageCount() const;
+
+        /**
+         * @brief 현재 총 디스크립터 개수 (페이지 수 * 페이지 크기)
+         */
+        uint32_t GetCapacity() const;
+
+        /**
+         * @brief 할당된 디스크립터 개수
+         */
+        uint32_t GetAllocatedCount() const;
+
+    private:
+        /**
+         * @brief 페이지 추가 (m_mutex를 잡은 상태에서 호출)
+         * @return 성공 시 true
+         */
+        bool AddPage();
+
+        /**
+         * @brief 전역 인덱스를 페이지와 페이지 내 핸들로 변환 (m_mutex를 잡은 상태에서 호출)
+         * @return 페이지 (범위 밖이면 nullptr)
+         */
+        DescriptorHeap* FindPage(const DescriptorHandle& handle, DescriptorHandle& localHandle) const;
+
+    private:
+        ID3D12Device* m_device;
+        D3D12_DESCRIPTOR_HEAP_TYPE m_type;
+        uint32_t m_descriptorsPerPage;
+
+        mutable std::mutex m_mutex;
+        std::vector<std::unique_ptr<DescriptorHeap>> m_pages;
+        uint32_t m_allocationPage;      // 다음 할당을 시도할 페이지 (직전 할당/해제 위치)
+        bool m_initialized;
+    };
+}
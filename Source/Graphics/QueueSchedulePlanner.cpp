@@ -0,0 +1,238 @@
+/**
+ * @file QueueSchedulePlanner.cpp
+ * @brief 큐 간 의존성 스케줄 계획기 구현
+ */
+
+#include "QueueSchedulePlanner.h"
+#include <Utils/Logger.h>
+#include <algorithm>
+
+namespace DX12GameEngine
+{
+    const char* GetQueueTypeName(QueueType type)
+    {
+        switch (type)
+        {
+        case QueueType::Graphics:
+            return "Graphics";
+        case QueueType::Compute:
+            return "Compute";
+        case QueueType::Copy:
+            return "Copy";
+        default:
+            return "Unknown";
+        }
+    }
+
+    QueueSchedulePlanner::QueueSchedulePlanner()
+        : m_signalCounts{}
+        , m_waitCount(0)
+        , m_elidedWaitCount(0)
+    {
+    }
+
+    void QueueSchedulePlanner::Reset()
+    {
+        m_jobs.clear();
+        m_dependencies.clear();
+        m_plan.clear();
+        m_jobClocks.clear();
+        for (uint32_t queue = 0; queue < kQueueTypeCount; queue++)
+        {
+            m_signalClocks[queue].clear();
+            m_signalTimes[queue].clear();
+            m_signalCounts[queue] = 0;
+        }
+        m_waitCount = 0;
+        m_elidedWaitCount = 0;
+        m_overlapStats = QueueOverlapStats();
+    }
+
+    uint32_t QueueSchedulePlanner::AddJob(QueueType queue, const char* name, float estimatedMs)
+    {
+        if (queue >= QueueType::Count)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"QueueSchedulePlanner::AddJob - invalid queue type");
+            return kInvalidJob;
+        }
+
+        Job job = {};
+        job.name = name ? name : "";
+        job.queue = queue;
+        job.estimatedMs = std::max(estimatedMs, 0.0f);
+        m_jobs.push_back(job);
+        return static_cast<uint32_t>(m_jobs.size() - 1);
+    }
+
+    bool QueueSchedulePlanner::AddDependency(uint32_t job, uint32_t dependsOn)
+    {
+        if (job >= m_jobs.size() || dependsOn >= m_jobs.size())
+        {
+            LOG_ERROR(LogCategory::Renderer, L"QueueSchedulePlanner::AddDependency - job index out of range ({} -> {})",
+                      job, dependsOn);
+            return false;
+        }
+
+        // 먼저 선언한 작업에만 의존할 수 있으므로 선언 순서가 곧 유효한 제출 순서 (순환 불가)
+        if (dependsOn >= job)
+        {
+            LOG_ERROR(LogCategory::Renderer,
+                      L"QueueSchedulePlanner::AddDependency - job {} cannot depend on itself or later job {}",
+                      job, dependsOn);
+            return false;
+        }
+
+        m_dependencies.push_back({ job, dependsOn });
+        return true;
+    }
+
+    bool QueueSchedulePlanner::Build()
+    {
+        const uint32_t jobCount = static_cast<uint32_t>(m_jobs.size());
+
+        m_plan.assign(jobCount, PlannedJob());
+        m_jobClocks.assign(static_cast<size_t>(jobCount) * kQueueTypeCount, 0);
+        for (uint32_t queue = 0; queue < kQueueTypeCount; queue++)
+        {
+            m_signalClocks[queue].clear();
+            m_signalTimes[queue].clear();
+            m_signalCounts[queue] = 0;
+        }
+        m_waitCount = 0;
+        m_elidedWaitCount = 0;
+        m_overlapStats = QueueOverlapStats();
+
+        for (Job& job : m_jobs)
+        {
+            job.needsSignal = false;
+            std::fill(std::begin(job.requiredSignals), std::end(job.requiredSignals), 0u);
+        }
+
+        // 1. 다른 큐 작업이 의존하는 작업은 실행 뒤에 Signal
+        for (const Dependency& dependency : m_dependencies)
+        {
+            if (m_jobs[dependency.job].queue != m_jobs[dependency.dependsOn].queue)
+            {
+                m_jobs[dependency.dependsOn].needsSignal = true;
+            }
+        }
+
+        for (uint32_t i = 0; i < jobCount; i++)
+        {
+            const uint32_t queue = static_cast<uint32_t>(m_jobs[i].queue);
+            m_plan[i].queue = m_jobs[i].queue;
+            m_plan[i].signalIndex = m_jobs[i].needsSignal ? ++m_signalCounts[queue] : 0;
+        }
+
+        // 2. 작업별로 큐마다 기다려야 하는 가장 늦은 Signal (같은 큐 의존성은 실행 순서로 보장)
+        for (const Dependency& dependency : m_dependencies)
+        {
+            Job& job = m_jobs[dependency.job];
+            const uint32_t dependsOnQueue = static_cast<uint32_t>(m_jobs[dependency.dependsOn].queue);
+            if (job.queue != m_jobs[dependency.dependsOn].queue)
+            {
+                job.requiredSignals[dependsOnQueue] = std::max(job.requiredSignals[dependsOnQueue],
+                                                               m_plan[dependency.dependsOn].signalIndex);
+            }
+        }
+
+        // 3. 선언 순서로 Wait 배치 + 예상 시간 시뮬레이션
+        // clocks[q][p]: 큐 q의 현재 위치에서 완료가 보장된 큐 p의 Signal 순번
+        uint32_t clocks[kQueueTypeCount][kQueueTypeCount] = {};
+        double queueTimes[kQueueTypeCount] = {};
+
+        for (uint32_t i = 0; i < jobCount; i++)
+        {
+            const Job& job = m_jobs[i];
+            PlannedJob& planned = m_plan[i];
+            const uint32_t queue = static_cast<uint32_t>(job.queue);
+            double startMs = queueTimes[queue];
+
+            for (uint32_t other = 0; other < kQueueTypeCount; other++)
+            {
+                const uint32_t required = job.requiredSignals[other];
+                if (other == queue || required == 0)
+                {
+                    continue;
+                }
+
+                // 이미 기다렸거나, 함께 기다릴 다른 큐의 Signal이 이 Signal을 이미 포함하면 생략
+                bool covered = clocks[queue][other] >= required;
+                for (uint32_t via = 0; via < kQueueTypeCount && !covered; via++)
+                {
+                    const uint32_t viaRequired = job.requiredSignals[via];
+                    if (via == queue || via == other || viaRequired == 0)
+                    {
+                        continue;
+                    }
+                    covered = m_signalClocks[via][static_cast<size_t>(viaRequired - 1) * kQueueTypeCount + other] >= required;
+                }
+
+                if (covered)
+                {
+                    m_elidedWaitCount++;
+                    continue;
+                }
+
+                planned.waits[planned.waitCount++] = { static_cast<QueueType>(other), required };
+                m_waitCount++;
+                startMs = std::max(startMs, m_signalTimes[other][required - 1]);
+            }
+
+            // Signal 시점에 그 큐가 알고 있던 완료 지점까지 함께 이어받음
+            for (uint32_t w = 0; w < planned.waitCount; w++)
+            {
+                const ScheduledWait& wait = planned.waits[w];
+                const uint32_t other = static_cast<uint32_t>(wait.queue);
+                const uint32_t* signalClock =
+                    &m_signalClocks[other][static_cast<size_t>(wait.signalIndex - 1) * kQueueTypeCount];
+                for (uint32_t known = 0; known < kQueueTypeCount; known++)
+                {
+                    clocks[queue][known] = std::max(clocks[queue][known], signalClock[known]);
+                }
+            }
+
+            std::copy(std::begin(clocks[queue]), std::end(clocks[queue]),
+                      m_jobClocks.begin() + static_cast<size_t>(i) * kQueueTypeCount);
+
+            planned.startMs = startMs;
+            planned.endMs = startMs + job.estimatedMs;
+            queueTimes[queue] = planned.endMs;
+            m_overlapStats.busyMs[queue] += job.estimatedMs;
+            m_overlapStats.serialMs += job.estimatedMs;
+
+            if (planned.signalIndex != 0)
+            {
+                clocks[queue][queue] = planned.signalIndex;
+                m_signalClocks[queue].insert(m_signalClocks[queue].end(),
+                                             std::begin(clocks[queue]), std::end(clocks[queue]));
+                m_signalTimes[queue].push_back(planned.endMs);
+            }
+        }
+
+        for (uint32_t queue = 0; queue < kQueueTypeCount; queue++)
+        {
+            m_overlapStats.makespanMs = std::max(m_overlapStats.makespanMs, queueTimes[queue]);
+        }
+
+        // 4. 검증: 모든 다른 큐 의존성이 작업 시작 시점의 클록에 포함되어야 함
+        for (const Dependency& dependency : m_dependencies)
+        {
+            const uint32_t dependsOnQueue = static_cast<uint32_t>(m_jobs[dependency.dependsOn].queue);
+            if (m_jobs[dependency.job].queue == m_jobs[dependency.dependsOn].queue)
+            {
+                continue;
+            }
+
+            const uint32_t known = m_jobClocks[static_cast<size_t>(dependency.job) * kQueueTypeCount + dependsOnQueue];
+            if (known < m_plan[dependency.dependsOn].signalIndex)
+            {
+                LOG_ERROR(LogCategory::Renderer, L"QueueSchedulePlanner - job {} is not ordered after job {}",
+                          dependency.job, dependency.dependsOn);
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
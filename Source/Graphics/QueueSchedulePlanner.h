@@ -0,0 +1,204 @@
+/**
+ * @file QueueSchedulePlanner.h
+ * @brief 큐 간 의존성 스케줄 계획기 (CPU 전용)
+ *
+ * 한 프레임의 GPU 작업을 큐(Graphics / Compute / Copy)와 의존성으로 선언받아,
+ * 큐가 다른 의존성마다 필요한 GPU 측 Signal / Wait 쌍을 계산합니다.
+ *
+ * - 같은 큐의 작업은 선언 순서대로 실행되므로 따로 기다리지 않습니다.
+ * - 다른 큐 작업에 의존하면 그 작업 뒤에 Signal, 이 작업 앞에 Wait를 넣습니다.
+ * - 큐마다 이미 보장된 완료 지점을 벡터 클록으로 추적해, 직접 또는 간접으로 이미 기다린 Wait는 생략합니다.
+ *
+ * 작업별 예상 GPU 시간을 주면 계획대로 실행했을 때의 프레임 길이와 큐 겹침을 계산합니다.
+ * D3D12 객체를 쓰지 않으므로 디바이스 없이 순서 검증과 겹침 분석에 사용할 수 있습니다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 작업을 실행할 큐 종류
+     */
+    enum class QueueType : uint8_t
+    {
+        Graphics,
+        Compute,
+        Copy,
+        Count
+    };
+
+    /** @brief 큐 종류 수 */
+    static constexpr uint32_t kQueueTypeCount = static_cast<uint32_t>(QueueType::Count);
+
+    /**
+     * @brief 큐 종류 이름 (로그/출력용)
+     */
+    const char* GetQueueTypeName(QueueType type);
+
+    /**
+     * @brief 다른 큐의 Signal을 기다리는 GPU 측 Wait
+     */
+    struct ScheduledWait
+    {
+        QueueType queue;        // 기다릴 큐
+        uint32_t signalIndex;   // 그 큐의 이번 계획 내 Signal 순번 (1부터)
+    };
+
+    /**
+     * @brief 작업 하나의 실행 계획 (선언 순서 = 제출 순서)
+     */
+    struct PlannedJob
+    {
+        QueueType queue;
+        uint32_t waitCount;
+        ScheduledWait waits[kQueueTypeCount - 1];  // 실행 전에 넣을 Wait (다른 큐마다 최대 하나)
+        uint32_t signalIndex;   // 실행 후 Signal 순번 (0이면 Signal 없음)
+        double startMs;         // 예상 시작 시각 (프레임 시작 기준)
+        double endMs;           // 예상 종료 시각
+    };
+
+    /**
+     * @brief 계획대로 실행했을 때의 큐 겹침 분석
+     */
+    struct QueueOverlapStats
+    {
+        double serialMs;                    // 모든 작업을 한 큐에서 차례로 실행할 때의 시간
+        double makespanMs;                  // 큐를 나눠 실행할 때의 프레임 GPU 시간
+        double busyMs[kQueueTypeCount];     // 큐별 실행 시간 합
+
+        QueueOverlapStats()
+            : serialMs(0.0)
+            , makespanMs(0.0)
+            , busyMs{}
+        {
+        }
+
+        /** @brief 큐 병렬 실행으로 줄어든 시간 (ms) */
+        double GetOverlapMs() const { return serialMs - makespanMs; }
+
+        /** @brief 줄어든 비율 (0 ~ 1) */
+        double GetOverlapRatio() const { return serialMs > 0.0 ? GetOverlapMs() / serialMs : 0.0; }
+    };
+
+    /**
+     * @brief 큐 간 의존성 스케줄 계획기
+     *
+     * 사용 흐름:
+     * 1. AddJob으로 작업 선언 (제출 순서대로)
+     * 2. AddDependency(job, dependsOn) - dependsOn은 먼저 선언한 작업이어야 함 (순환 불가)
+     * 3. Build() - Signal / Wait 계획과 겹침 분석
+     * 4. Reset() - 다음 프레임
+     */
+    class QueueSchedulePlanner
+    {
+    public:
+        /** @brief 잘못된 작업 인덱스 */
+        static constexpr uint32_t kInvalidJob = UINT32_MAX;
+
+        QueueSchedulePlanner();
+
+        /**
+         * @brief 모든 작업과 계획 제거 (용량은 유지)
+         */
+        void Reset();
+
+        /**
+         * @brief 작업 선언
+         * @param queue 실행할 큐
+         * @param name 작업 이름 (출력용, 계획을 쓰는 동안 살아 있어야 함)
+         * @param estimatedMs 예상 GPU 시간 (겹침 분석용, 0이면 분석에서 길이 없음)
+         * @return 작업 인덱스 (선언 순서, 실패 시 kInvalidJob)
+         */
+        uint32_t AddJob(QueueType queue, const char* name, float estimatedMs = 0.0f);
+
+        /**
+         * @brief 의존성 선언 (job은 dependsOn의 GPU 완료 뒤에 시작)
+         * @return 먼저 선언한 작업에 대한 의존성이면 true (자기 자신, 뒤에 선언한 작업, 범위 밖이면 false)
+         */
+        bool AddDependency(uint32_t job, uint32_t dependsOn);
+
+        /**
+         * @brief Signal / Wait 계획과 겹침 분석 계산
+         *
+         * 계획을 만든 뒤 모든 의존성이 (같은 큐 순서나 Wait로) 보장되는지 다시 검증합니다.
+         *
+         * @return 모든 의존성이 보장되면 true
+         */
+        bool Build();
+
+        /**
+         * @brief 작업 수
+         */
+        uint32_t GetJobCount() const { return static_cast<uint32_t>(m_jobs.size()); }
+
+        /**
+         * @brief 작업 이름
+         */
+        const char* GetJobName(uint32_t job) const { return m_jobs[job].name; }
+
+        /**
+         * @brief Build 결과 (작업 인덱스 순서)
+         */
+        const std::vector<PlannedJob>& GetPlan() const { return m_plan; }
+
+        /**
+         * @brief 큐별 Signal 수
+         */
+        uint32_t GetSignalCount(QueueType queue) const { return m_signalCounts[static_cast<uint32_t>(queue)]; }
+
+        /**
+         * @brief 계획한 Wait 수
+         */
+        uint32_t GetWaitCount() const { return m_waitCount; }
+
+        /**
+         * @brief 직접 또는 간접으로 이미 기다려서 생략한 Wait 수
+         */
+        uint32_t GetElidedWaitCount() const { return m_elidedWaitCount; }
+
+        /**
+         * @brief 겹침 분석 결과
+         */
+        const QueueOverlapStats& GetOverlapStats() const { return m_overlapStats; }
+
+    private:
+        /**
+         * @brief 선언된 작업
+         */
+        struct Job
+        {
+            const char* name;
+            QueueType queue;
+            float estimatedMs;
+            bool needsSignal;                           // 다른 큐 작업이 의존함
+            uint32_t requiredSignals[kQueueTypeCount];  // 큐별로 기다려야 하는 최대 Signal 순번
+        };
+
+        /**
+         * @brief 선언된 의존성
+         */
+        struct Dependency
+        {
+            uint32_t job;
+            uint32_t dependsOn;
+        };
+
+        std::vector<Job> m_jobs;
+        std::vector<Dependency> m_dependencies;
+        std::vector<PlannedJob> m_plan;
+
+        // 큐별 Signal 시점의 클록(그 시점에 완료가 보장된 큐별 Signal 순번)과 예상 시각
+        std::vector<uint32_t> m_signalClocks[kQueueTypeCount];     // Signal 순번마다 kQueueTypeCount개씩
+        std::vector<double> m_signalTimes[kQueueTypeCount];
+        std::vector<uint32_t> m_jobClocks;      // 작업 시작 시점의 클록 (작업마다 kQueueTypeCount개씩, 검증용)
+
+        uint32_t m_signalCounts[kQueueTypeCount];
+        uint32_t m_waitCount;
+        uint32_t m_elidedWaitCount;
+        QueueOverlapStats m_overlapStats;
+    };
+}
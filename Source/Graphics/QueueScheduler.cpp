@@ -0,0 +1,178 @@
+/**
+ * @file QueueScheduler.cpp
+ * @brief Graphics / Compute / Copy 멀티 큐 스케줄러 구현
+ */
+
+#include "QueueScheduler.h"
+#include <Utils/Logger.h>
+
+namespace DX12GameEngine
+{
+    namespace
+    {
+        D3D12_COMMAND_LIST_TYPE ToCommandListType(QueueType queue)
+        {
+            switch (queue)
+            {
+            case QueueType::Compute:
+                return D3D12_COMMAND_LIST_TYPE_COMPUTE;
+            case QueueType::Copy:
+                return D3D12_COMMAND_LIST_TYPE_COPY;
+            default:
+                return D3D12_COMMAND_LIST_TYPE_DIRECT;
+            }
+        }
+    }
+
+    QueueScheduler::QueueScheduler()
+        : m_initialized(false)
+        , m_submitted(false)
+    {
+    }
+
+    QueueScheduler::~QueueScheduler()
+    {
+        // 각 CommandQueue 소멸자가 GPU 완료를 기다림
+    }
+
+    bool QueueScheduler::Initialize(ID3D12Device* device, FenceTimeline* timeline)
+    {
+        if (m_initialized)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"QueueScheduler already initialized");
+            return true;
+        }
+
+        for (uint32_t queue = 0; queue < kQueueTypeCount; queue++)
+        {
+            const QueueType type = static_cast<QueueType>(queue);
+            if (!m_queues[queue].Initialize(device, ToCommandListType(type)))
+            {
+                LOG_ERROR(LogCategory::Renderer, L"Failed to initialize scheduler queue (type {})", queue);
+                return false;
+            }
+            m_queues[queue].SetFenceTimeline(timeline);
+        }
+
+        m_initialized = true;
+        LOG_INFO(LogCategory::Renderer, L"QueueScheduler initialized (Graphics / Compute / Copy)");
+        return true;
+    }
+
+    uint32_t QueueScheduler::AddJob(QueueType queue, const char* name, ID3D12CommandList* commandList, float estimatedMs)
+    {
+        BeginFrameIfSubmitted();
+
+        if (!commandList)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"QueueScheduler::AddJob - command list is null");
+            return QueueSchedulePlanner::kInvalidJob;
+        }
+
+        if (queue < QueueType::Count && commandList->GetType() != ToCommandListType(queue))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"QueueScheduler::AddJob - command list type does not match queue (type {})",
+                      static_cast<uint32_t>(queue));
+            return QueueSchedulePlanner::kInvalidJob;
+        }
+
+        const uint32_t job = m_planner.AddJob(queue, name, estimatedMs);
+        if (job != QueueSchedulePlanner::kInvalidJob)
+        {
+            m_commandLists.push_back(commandList);
+        }
+        return job;
+    }
+
+    bool QueueScheduler::AddDependency(uint32_t job, uint32_t dependsOn)
+    {
+        BeginFrameIfSubmitted();
+        return m_planner.AddDependency(job, dependsOn);
+    }
+
+    bool QueueScheduler::Submit()
+    {
+        if (!m_initialized)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"QueueScheduler::Submit - not initialized");
+            return false;
+        }
+
+        m_submitted = true;
+        if (!m_planner.Build())
+        {
+            LOG_ERROR(LogCategory::Renderer, L"QueueScheduler::Submit - invalid schedule, nothing submitted");
+            return false;
+        }
+
+        for (uint32_t queue = 0; queue < kQueueTypeCount; queue++)
+        {
+            m_signalValues[queue].clear();
+        }
+
+        const std::vector<PlannedJob>& plan = m_planner.GetPlan();
+        for (uint32_t job = 0; job < static_cast<uint32_t>(plan.size()); job++)
+        {
+            const PlannedJob& planned = plan[job];
+            const uint32_t queue = static_cast<uint32_t>(planned.queue);
+            CommandQueue& commandQueue = m_queues[queue];
+
+            if (planned.waitCount > 0)
+            {
+                // Wait 앞의 작업이 Wait에 묶이지 않도록 먼저 제출
+                commandQueue.FlushSubmissions();
+
+                for (uint32_t i = 0; i < planned.waitCount; i++)
+                {
+                    const ScheduledWait& wait = planned.waits[i];
+                    const uint32_t waitQueue = static_cast<uint32_t>(wait.queue);
+                    commandQueue.WaitForQueue(m_queues[waitQueue], m_signalValues[waitQueue][wait.signalIndex - 1]);
+                }
+            }
+
+            commandQueue.Enqueue(m_commandLists[job], job);
+
+            if (planned.signalIndex != 0)
+            {
+                // Signal 순번은 큐 안에서 선언 순서로 증가하므로 push 순서와 일치
+                m_signalValues[queue].push_back(commandQueue.FlushSubmissions());
+            }
+        }
+
+        // Signal이 필요 없던 나머지 작업 제출
+        for (CommandQueue& commandQueue : m_queues)
+        {
+            if (commandQueue.GetPendingSubmissionCount() > 0)
+            {
+                commandQueue.FlushSubmissions();
+            }
+        }
+
+        return true;
+    }
+
+    void QueueScheduler::Flush()
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        for (CommandQueue& commandQueue : m_queues)
+        {
+            commandQueue.Flush();
+        }
+    }
+
+    void QueueScheduler::BeginFrameIfSubmitted()
+    {
+        if (!m_submitted)
+        {
+            return;
+        }
+
+        m_planner.Reset();
+        m_commandLists.clear();
+        m_submitted = false;
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * @file QueueScheduler.h
+ * @brief Graphics / Compute / Copy 멀티 큐 스케줄러
+ *
+ * 큐 종류마다 CommandQueue를 하나씩 소유하고, 한 프레임의 작업을 큐와 의존성으로 받아
+ * QueueSchedulePlanner가 계산한 GPU 측 Signal / Wait 쌍으로 제출합니다.
+ * 같은 큐에서 Signal이 필요 없는 연속 작업은 한 번의 ExecuteCommandLists로 묶입니다.
+ *
+ * Copy 큐는 프레임 그래프 안의 복사 작업용입니다.
+ * 로딩 스레드의 스트리밍 업로드는 UploadManager가 자기 복사 큐로 처리합니다.
+ *
+ * 모든 메서드는 메인 스레드에서만 호출합니다.
+ */
+
+#pragma once
+
+#include "CommandQueue.h"
+#include "QueueSchedulePlanner.h"
+#include <d3d12.h>
+#include <cstdint>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    class FenceTimeline;
+
+    /**
+     * @brief 멀티 큐 스케줄러
+     *
+     * 사용 흐름:
+     * 1. AddJob(queue, name, commandList) - 제출 순서대로 (Close된 CommandList)
+     * 2. AddDependency(job, dependsOn) - 큐가 다르면 GPU Wait로 변환
+     * 3. Submit() - 계획에 따라 제출, 큐별 마지막 Fence 값은 GetLastFenceValue
+     *
+     * Submit 뒤에도 다음 AddJob 전까지 GetPlanner()로 이번 계획과 겹침 분석을 볼 수 있습니다.
+     */
+    class QueueScheduler
+    {
+    public:
+        QueueScheduler();
+        ~QueueScheduler();
+
+        // 복사 및 이동 금지
+        QueueScheduler(const QueueScheduler&) = delete;
+        QueueScheduler& operator=(const QueueScheduler&) = delete;
+        QueueScheduler(QueueScheduler&&) = delete;
+        QueueScheduler& operator=(QueueScheduler&&) = delete;
+
+        /**
+         * @brief 초기화 (큐 종류마다 CommandQueue 생성)
+         * @param device D3D12 디바이스
+         * @param timeline 큐의 CPU 대기에 사용할 FenceTimeline (nullptr이면 Fence 이벤트로 직접 대기)
+         * @return 성공 시 true
+         */
+        bool Initialize(ID3D12Device* device, FenceTimeline* timeline = nullptr);
+
+        /**
+         * @brief 작업 추가
+         * @param queue 실행할 큐
+         * @param name 작업 이름 (로그/분석용, Submit 뒤 계획을 보는 동안 살아 있어야 함)
+         * @param commandList Close된 커맨드 리스트 (큐 종류와 타입이 맞아야 함, Submit까지 유지)
+         * @param estimatedMs 예상 GPU 시간 (겹침 분석용)
+         * @return 작업 인덱스 (실패 시 QueueSchedulePlanner::kInvalidJob)
+         */
+        uint32_t AddJob(QueueType queue, const char* name, ID3D12CommandList* commandList, float estimatedMs = 0.0f);
+
+        /**
+         * @brief 의존성 추가 (job은 dependsOn의 GPU 완료 뒤에 시작)
+         * @return 성공 시 true (dependsOn은 먼저 추가한 작업이어야 함)
+         */
+        bool AddDependency(uint32_t job, uint32_t dependsOn);
+
+        /**
+         * @brief 추가한 작업을 계획에 따라 제출
+         * @return 성공 시 true (계획 검증 실패 시 아무것도 제출하지 않고 false)
+         */
+        bool Submit();
+
+        /**
+         * @brief 큐 가져오기
+         */
+        CommandQueue& GetQueue(QueueType queue) { return m_queues[static_cast<uint32_t>(queue)]; }
+
+        /**
+         * @brief 마지막 Submit에서 해당 큐가 마지막으로 시그널한 Fence 값
+         */
+        uint64_t GetLastFenceValue(QueueType queue) const { return m_queues[static_cast<uint32_t>(queue)].GetCurrentFenceValue(); }
+
+        /**
+         * @brief 계획기 (마지막 계획과 겹침 분석)
+         */
+        const QueueSchedulePlanner& GetPlanner() const { return m_planner; }
+
+        /**
+         * @brief 모든 큐의 GPU 작업 완료 대기
+         */
+        void Flush();
+
+    private:
+        /**
+         * @brief 이전 Submit의 작업을 비우고 새 프레임 시작 (다음 AddJob에서 호출)
+         */
+        void BeginFrameIfSubmitted();
+
+        bool m_initialized;
+        bool m_submitted;       // 마지막 Submit 뒤에 작업이 추가되지 않음
+
+        CommandQueue m_queues[kQueueTypeCount];
+        QueueSchedulePlanner m_planner;
+        std::vector<ID3D12CommandList*> m_commandLists;     // 작업 인덱스 순서
+        std::vector<uint64_t> m_signalValues[kQueueTypeCount];  // 큐별 Signal 순번 -> Fence 값
+    };
+}
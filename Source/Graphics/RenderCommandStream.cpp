@@ -0,0 +1,260 @@
+/**
+ * @file RenderCommandStream.cpp
+ * @brief 플랫폼 중립 렌더 명령 스트림 구현
+ */
+
+#include "RenderCommandStream.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace DX12GameEngine
+{
+    namespace
+    {
+        // 모든 명령은 8바이트 단위로 이어 붙이므로 가변 데이터가 바로 뒤에 정렬된 채로 옴
+        template<typename T>
+        constexpr bool IsPackedCommand()
+        {
+            return std::is_trivially_copyable_v<T> && sizeof(T) % sizeof(uint64_t) == 0 &&
+                   alignof(T) <= alignof(uint64_t);
+        }
+
+        static_assert(sizeof(RenderCommandHeader) == 8);
+        static_assert(IsPackedCommand<RenderCommand::SetPipelineState>());
+        static_assert(IsPackedCommand<RenderCommand::SetRootSignature>());
+        static_assert(IsPackedCommand<RenderCommand::SetDescriptorHeaps>());
+        static_assert(IsPackedCommand<RenderCommand::SetRootDescriptorTable>());
+        static_assert(IsPackedCommand<RenderCommand::SetRootConstants>());
+        static_assert(IsPackedCommand<RenderCommand::SetPrimitiveTopology>());
+        static_assert(IsPackedCommand<RenderCommand::SetVertexBuffers>());
+        static_assert(IsPackedCommand<RenderCommand::SetIndexBuffer>());
+        static_assert(IsPackedCommand<RenderCommand::SetViewport>());
+        static_assert(IsPackedCommand<RenderCommand::SetScissorRect>());
+        static_assert(IsPackedCommand<RenderCommand::SetRenderTargets>());
+        static_assert(IsPackedCommand<RenderCommand::ClearRenderTarget>());
+        static_assert(IsPackedCommand<RenderCommand::ClearDepthStencil>());
+        static_assert(IsPackedCommand<RenderCommand::ResourceBarrier>());
+        static_assert(IsPackedCommand<RenderCommand::Draw>());
+        static_assert(IsPackedCommand<RenderCommand::DrawIndexed>());
+        static_assert(IsPackedCommand<RenderCommand::Dispatch>());
+        static_assert(sizeof(VertexBufferBinding) % sizeof(uint64_t) == 0);
+        static_assert(sizeof(RenderBarrier) % sizeof(uint64_t) == 0);
+
+        /** @brief 처음 확장할 때의 최소 크기 (64KB) */
+        constexpr size_t kInitialWords = 64 * 1024 / sizeof(uint64_t);
+
+        const char* const kRenderCommandTypeNames[] =
+        {
+            "SetPipelineState",
+            "SetRootSignature",
+            "SetDescriptorHeaps",
+            "SetRootDescriptorTable",
+            "SetRootConstants",
+            "SetPrimitiveTopology",
+            "SetVertexBuffers",
+            "SetIndexBuffer",
+            "SetViewport",
+            "SetScissorRect",
+            "SetRenderTargets",
+            "ClearRenderTarget",
+            "ClearDepthStencil",
+            "ResourceBarrier",
+            "Draw",
+            "DrawIndexed",
+            "Dispatch"
+        };
+        static_assert(sizeof(kRenderCommandTypeNames) / sizeof(kRenderCommandTypeNames[0]) == kRenderCommandTypeCount);
+    }
+
+    const char* GetRenderCommandTypeName(RenderCommandType type)
+    {
+        const uint32_t index = static_cast<uint32_t>(type);
+        return index < kRenderCommandTypeCount ? kRenderCommandTypeNames[index] : "Unknown";
+    }
+
+    RenderCommandStream::RenderCommandStream()
+        : m_usedWords(0)
+        , m_commandCount(0)
+    {
+    }
+
+    void RenderCommandStream::Reset()
+    {
+        m_usedWords = 0;
+        m_commandCount = 0;
+    }
+
+    void RenderCommandStream::Reserve(size_t sizeInBytes)
+    {
+        const size_t words = (sizeInBytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+        if (words > m_words.size())
+        {
+            m_words.resize(words);
+        }
+    }
+
+    void RenderCommandStream::Grow(size_t words)
+    {
+        m_words.resize(std::max({ m_words.size() * 2, m_usedWords + words, kInitialWords }));
+    }
+
+    void RenderCommandStream::Append(const RenderCommandStream& other)
+    {
+        if (other.m_usedWords == 0)
+        {
+            return;
+        }
+
+        if (m_usedWords + other.m_usedWords > m_words.size())
+        {
+            Grow(other.m_usedWords);
+        }
+
+        std::memcpy(m_words.data() + m_usedWords, other.m_words.data(), other.m_usedWords * sizeof(uint64_t));
+        m_usedWords += other.m_usedWords;
+        m_commandCount += other.m_commandCount;
+    }
+
+    void RenderCommandStream::SetPipelineState(RenderHandle pipelineState)
+    {
+        Push<RenderCommand::SetPipelineState>()->pipelineState = pipelineState;
+    }
+
+    void RenderCommandStream::SetGraphicsRootSignature(RenderHandle rootSignature)
+    {
+        Push<RenderCommand::SetRootSignature>()->rootSignature = rootSignature;
+    }
+
+    void RenderCommandStream::SetDescriptorHeaps(uint32_t count, const RenderHandle* heaps)
+    {
+        auto* command = Push<RenderCommand::SetDescriptorHeaps>(count * sizeof(RenderHandle));
+        command->count = count;
+        command->reserved = 0;
+        std::memcpy(command + 1, heaps, count * sizeof(RenderHandle));
+    }
+
+    void RenderCommandStream::SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor)
+    {
+        auto* command = Push<RenderCommand::SetRootDescriptorTable>();
+        command->rootParameterIndex = rootParameterIndex;
+        command->reserved = 0;
+        command->gpuDescriptor = gpuDescriptor;
+    }
+
+    void RenderCommandStream::SetGraphicsRoot32BitConstants(uint32_t rootParameterIndex, uint32_t count,
+                                                            const void* values, uint32_t destOffset)
+    {
+        auto* command = Push<RenderCommand::SetRootConstants>(count * sizeof(uint32_t));
+        command->rootParameterIndex = rootParameterIndex;
+        command->count = static_cast<uint16_t>(count);
+        command->destOffset = static_cast<uint16_t>(destOffset);
+        std::memcpy(command + 1, values, count * sizeof(uint32_t));
+    }
+
+    void RenderCommandStream::SetPrimitiveTopology(PrimitiveTopology topology)
+    {
+        auto* command = Push<RenderCommand::SetPrimitiveTopology>();
+        command->topology = topology;
+        std::memset(command->reserved, 0, sizeof(command->reserved));
+    }
+
+    void RenderCommandStream::SetVertexBuffers(uint32_t startSlot, uint32_t count, const VertexBufferBinding* bindings)
+    {
+        auto* command = Push<RenderCommand::SetVertexBuffers>(count * sizeof(VertexBufferBinding));
+        command->startSlot = startSlot;
+        command->count = count;
+        std::memcpy(command + 1, bindings, count * sizeof(VertexBufferBinding));
+    }
+
+    void RenderCommandStream::SetIndexBuffer(const IndexBufferBinding& binding)
+    {
+        Push<RenderCommand::SetIndexBuffer>()->binding = binding;
+    }
+
+    void RenderCommandStream::SetViewport(const RenderViewport& viewport)
+    {
+        Push<RenderCommand::SetViewport>()->viewport = viewport;
+    }
+
+    void RenderCommandStream::SetScissorRect(const RenderRect& rect)
+    {
+        Push<RenderCommand::SetScissorRect>()->rect = rect;
+    }
+
+    void RenderCommandStream::SetRenderTargets(uint32_t count, const uint64_t* renderTargets, uint64_t depthStencil)
+    {
+        count = std::min(count, kMaxRenderTargets);
+
+        auto* command = Push<RenderCommand::SetRenderTargets>(count * sizeof(uint64_t));
+        command->count = count;
+        command->reserved = 0;
+        command->depthStencil = depthStencil;
+        std::memcpy(command + 1, renderTargets, count * sizeof(uint64_t));
+    }
+
+    void RenderCommandStream::ClearRenderTarget(uint64_t renderTarget, const float color[4])
+    {
+        auto* command = Push<RenderCommand::ClearRenderTarget>();
+        command->renderTarget = renderTarget;
+        std::memcpy(command->color, color, sizeof(command->color));
+    }
+
+    void RenderCommandStream::ClearDepthStencil(uint64_t depthStencil, bool clearDepth, bool clearStencil,
+                                                float depth, uint8_t stencil)
+    {
+        auto* command = Push<RenderCommand::ClearDepthStencil>();
+        command->depthStencil = depthStencil;
+        command->depth = depth;
+        command->stencil = stencil;
+        command->clearDepth = clearDepth;
+        command->clearStencil = clearStencil;
+        command->reserved = 0;
+    }
+
+    void RenderCommandStream::ResourceBarrier(uint32_t count, const RenderBarrier* barriers)
+    {
+        auto* command = Push<RenderCommand::ResourceBarrier>(count * sizeof(RenderBarrier));
+        command->count = count;
+        command->reserved = 0;
+        std::memcpy(command + 1, barriers, count * sizeof(RenderBarrier));
+    }
+
+    void RenderCommandStream::Transition(RenderHandle resource, ResourceState before, ResourceState after,
+                                         uint32_t subresource)
+    {
+        const RenderBarrier barrier = { resource, subresource, before, after };
+        ResourceBarrier(1, &barrier);
+    }
+
+    void RenderCommandStream::Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex,
+                                   uint32_t startInstance)
+    {
+        auto* command = Push<RenderCommand::Draw>();
+        command->vertexCount = vertexCount;
+        command->instanceCount = instanceCount;
+        command->startVertex = startVertex;
+        command->startInstance = startInstance;
+    }
+
+    void RenderCommandStream::DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t startIndex,
+                                          int32_t baseVertex, uint32_t startInstance)
+    {
+        auto* command = Push<RenderCommand::DrawIndexed>();
+        command->indexCount = indexCount;
+        command->instanceCount = instanceCount;
+        command->startIndex = startIndex;
+        command->baseVertex = baseVertex;
+        command->startInstance = startInstance;
+        command->reserved = 0;
+    }
+
+    void RenderCommandStream::Dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+    {
+        auto* command = Push<RenderCommand::Dispatch>();
+        command->groupCountX = groupCountX;
+        command->groupCountY = groupCountY;
+        command->groupCountZ = groupCountZ;
+        command->reserved = 0;
+    }
+}
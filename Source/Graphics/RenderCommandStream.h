@@ -0,0 +1,532 @@
+/**
+ * @file RenderCommandStream.h
+ * @brief 플랫폼 중립 렌더 명령 스트림 (IR)
+ *
+ * 파이프라인 설정, 버텍스 버퍼 바인딩, 드로우, 배리어 같은 렌더 명령을
+ * 고정 레이아웃 POD로 선형 메모리에 이어 붙여 기록합니다.
+ *
+ * - 기록은 구조체를 버퍼 끝에 쓰는 것이 전부라 캐시 친화적이고 API 호출 비용이 없습니다.
+ * - 스트림은 D3D12 헤더에 의존하지 않으므로 GPU 없이 (Linux 포함) 기록, 검사, 테스트할 수 있습니다.
+ * - 실제 GPU 명령은 번역기(D3D12CommandTranslator)가 스트림을 재생하며 CommandList에 기록합니다.
+ *
+ * 스트림 하나는 한 스레드만 기록합니다. 여러 스레드는 각자 스트림을 만들고 Append로 합칩니다.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 백엔드 객체 핸들 (파이프라인, 루트 시그니처, 리소스, 디스크립터 힙)
+     *
+     * 스트림은 값을 해석하지 않습니다. D3D12 번역기는 객체 포인터로 해석합니다.
+     */
+    using RenderHandle = uint64_t;
+
+    /** @brief 빈 핸들 */
+    static constexpr RenderHandle kNullRenderHandle = 0;
+
+    /** @brief 모든 서브리소스 (배리어용) */
+    static constexpr uint32_t kAllSubresources = 0xFFFFFFFF;
+
+    /** @brief 한 번에 바인딩할 수 있는 최대 렌더 타겟 수 */
+    static constexpr uint32_t kMaxRenderTargets = 8;
+
+    /**
+     * @brief 백엔드 객체 포인터를 핸들로 변환
+     */
+    template<typename T>
+    RenderHandle ToRenderHandle(T* object)
+    {
+        return static_cast<RenderHandle>(reinterpret_cast<uintptr_t>(object));
+    }
+
+    /**
+     * @brief 핸들을 백엔드 객체 포인터로 변환
+     */
+    template<typename T>
+    T* FromRenderHandle(RenderHandle handle)
+    {
+        return reinterpret_cast<T*>(static_cast<uintptr_t>(handle));
+    }
+
+    /**
+     * @brief 명령 종류
+     */
+    enum class RenderCommandType : uint8_t
+    {
+        SetPipelineState,
+        SetRootSignature,
+        SetDescriptorHeaps,
+        SetRootDescriptorTable,
+        SetRootConstants,
+        SetPrimitiveTopology,
+        SetVertexBuffers,
+        SetIndexBuffer,
+        SetViewport,
+        SetScissorRect,
+        SetRenderTargets,
+        ClearRenderTarget,
+        ClearDepthStencil,
+        ResourceBarrier,
+        Draw,
+        DrawIndexed,
+        Dispatch,
+        Count
+    };
+
+    /** @brief 명령 종류 수 */
+    static constexpr uint32_t kRenderCommandTypeCount = static_cast<uint32_t>(RenderCommandType::Count);
+
+    /**
+     * @brief 명령 종류 이름 (로그/출력용)
+     */
+    const char* GetRenderCommandTypeName(RenderCommandType type);
+
+    /**
+     * @brief 프리미티브 토폴로지
+     */
+    enum class PrimitiveTopology : uint8_t
+    {
+        PointList,
+        LineList,
+        LineStrip,
+        TriangleList,
+        TriangleStrip
+    };
+
+    /**
+     * @brief 인덱스 포맷
+     */
+    enum class IndexFormat : uint8_t
+    {
+        Uint16,
+        Uint32
+    };
+
+    /**
+     * @brief 리소스 상태 (배리어용)
+     */
+    enum class ResourceState : uint8_t
+    {
+        Common,
+        Present,
+        RenderTarget,
+        DepthWrite,
+        DepthRead,
+        ShaderResource,
+        UnorderedAccess,
+        CopySource,
+        CopyDest,
+        VertexAndConstantBuffer,
+        IndexBuffer,
+        IndirectArgument
+    };
+
+    /**
+     * @brief 버텍스 버퍼 바인딩
+     */
+    struct VertexBufferBinding
+    {
+        uint64_t gpuAddress;
+        uint32_t sizeInBytes;
+        uint32_t strideInBytes;
+    };
+
+    /**
+     * @brief 인덱스 버퍼 바인딩
+     */
+    struct IndexBufferBinding
+    {
+        uint64_t gpuAddress;
+        uint32_t sizeInBytes;
+        IndexFormat format;
+    };
+
+    /**
+     * @brief 뷰포트
+     */
+    struct RenderViewport
+    {
+        float x;
+        float y;
+        float width;
+        float height;
+        float minDepth;
+        float maxDepth;
+    };
+
+    /**
+     * @brief 시저 사각형
+     */
+    struct RenderRect
+    {
+        int32_t left;
+        int32_t top;
+        int32_t right;
+        int32_t bottom;
+    };
+
+    /**
+     * @brief 리소스 상태 전환 배리어
+     */
+    struct RenderBarrier
+    {
+        RenderHandle resource;
+        uint32_t subresource;
+        ResourceState before;
+        ResourceState after;
+    };
+
+    /**
+     * @brief 모든 명령의 공통 헤더 (8바이트)
+     */
+    struct RenderCommandHeader
+    {
+        RenderCommandType type;
+        uint8_t reserved[3];
+        uint32_t size;          // 헤더와 뒤따르는 가변 데이터를 포함한 바이트 수 (8의 배수)
+
+        /**
+         * @brief 명령 본문으로 변환 (type이 T::kType과 같을 때만)
+         */
+        template<typename T>
+        const T& As() const { return *reinterpret_cast<const T*>(this); }
+    };
+
+    /**
+     * @brief 명령 레이아웃
+     *
+     * 모든 명령은 RenderCommandHeader로 시작하고 크기는 8바이트 배수입니다.
+     * 가변 길이 명령은 구조체 바로 뒤에 배열이 이어집니다.
+     */
+    namespace RenderCommand
+    {
+        struct SetPipelineState
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetPipelineState;
+            RenderCommandHeader header;
+            RenderHandle pipelineState;
+        };
+
+        struct SetRootSignature
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetRootSignature;
+            RenderCommandHeader header;
+            RenderHandle rootSignature;
+        };
+
+        /** @brief 뒤에 RenderHandle heaps[count] */
+        struct SetDescriptorHeaps
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetDescriptorHeaps;
+            RenderCommandHeader header;
+            uint32_t count;
+            uint32_t reserved;
+
+            const RenderHandle* GetHeaps() const { return reinterpret_cast<const RenderHandle*>(this + 1); }
+        };
+
+        struct SetRootDescriptorTable
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetRootDescriptorTable;
+            RenderCommandHeader header;
+            uint32_t rootParameterIndex;
+            uint32_t reserved;
+            uint64_t gpuDescriptor;     // 테이블 시작 GPU 디스크립터 핸들
+        };
+
+        /** @brief 뒤에 uint32_t values[count] (8바이트 경계까지 패딩) */
+        struct SetRootConstants
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetRootConstants;
+            RenderCommandHeader header;
+            uint32_t rootParameterIndex;
+            uint16_t count;
+            uint16_t destOffset;        // 32비트 값 단위 오프셋
+
+            const uint32_t* GetValues() const { return reinterpret_cast<const uint32_t*>(this + 1); }
+        };
+
+        struct SetPrimitiveTopology
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetPrimitiveTopology;
+            RenderCommandHeader header;
+            PrimitiveTopology topology;
+            uint8_t reserved[7];
+        };
+
+        /** @brief 뒤에 VertexBufferBinding bindings[count] */
+        struct SetVertexBuffers
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetVertexBuffers;
+            RenderCommandHeader header;
+            uint32_t startSlot;
+            uint32_t count;
+
+            const VertexBufferBinding* GetBindings() const { return reinterpret_cast<const VertexBufferBinding*>(this + 1); }
+        };
+
+        struct SetIndexBuffer
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetIndexBuffer;
+            RenderCommandHeader header;
+            IndexBufferBinding binding;
+        };
+
+        struct SetViewport
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetViewport;
+            RenderCommandHeader header;
+            RenderViewport viewport;
+        };
+
+        struct SetScissorRect
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetScissorRect;
+            RenderCommandHeader header;
+            RenderRect rect;
+        };
+
+        /** @brief 뒤에 uint64_t renderTargets[count] (CPU 디스크립터 핸들) */
+        struct SetRenderTargets
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::SetRenderTargets;
+            RenderCommandHeader header;
+            uint32_t count;
+            uint32_t reserved;
+            uint64_t depthStencil;      // CPU 디스크립터 핸들 (0이면 없음)
+
+            const uint64_t* GetRenderTargets() const { return reinterpret_cast<const uint64_t*>(this + 1); }
+        };
+
+        struct ClearRenderTarget
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::ClearRenderTarget;
+            RenderCommandHeader header;
+            uint64_t renderTarget;      // CPU 디스크립터 핸들
+            float color[4];
+        };
+
+        struct ClearDepthStencil
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::ClearDepthStencil;
+            RenderCommandHeader header;
+            uint64_t depthStencil;      // CPU 디스크립터 핸들
+            float depth;
+            uint8_t stencil;
+            bool clearDepth;
+            bool clearStencil;
+            uint8_t reserved;
+        };
+
+        /** @brief 뒤에 RenderBarrier barriers[count] */
+        struct ResourceBarrier
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::ResourceBarrier;
+            RenderCommandHeader header;
+            uint32_t count;
+            uint32_t reserved;
+
+            const RenderBarrier* GetBarriers() const { return reinterpret_cast<const RenderBarrier*>(this + 1); }
+        };
+
+        struct Draw
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::Draw;
+            RenderCommandHeader header;
+            uint32_t vertexCount;
+            uint32_t instanceCount;
+            uint32_t startVertex;
+            uint32_t startInstance;
+        };
+
+        struct DrawIndexed
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::DrawIndexed;
+            RenderCommandHeader header;
+            uint32_t indexCount;
+            uint32_t instanceCount;
+            uint32_t startIndex;
+            int32_t baseVertex;
+            uint32_t startInstance;
+            uint32_t reserved;
+        };
+
+        struct Dispatch
+        {
+            static constexpr RenderCommandType kType = RenderCommandType::Dispatch;
+            RenderCommandHeader header;
+            uint32_t groupCountX;
+            uint32_t groupCountY;
+            uint32_t groupCountZ;
+            uint32_t reserved;
+        };
+    }
+
+    /**
+     * @brief 렌더 명령 스트림
+     *
+     * 사용 흐름:
+     * 1. Reset() - 프레임 시작 (메모리는 유지)
+     * 2. Set* / Draw* / Transition 등으로 기록
+     * 3. 번역기로 CommandList에 재생하거나, for (const RenderCommandHeader& command : stream)으로 검사
+     */
+    class RenderCommandStream
+    {
+    public:
+        /**
+         * @brief 명령을 순서대로 훑는 반복자
+         */
+        class Iterator
+        {
+        public:
+            explicit Iterator(const uint64_t* position) : m_position(position) {}
+
+            const RenderCommandHeader& operator*() const { return *reinterpret_cast<const RenderCommandHeader*>(m_position); }
+            const RenderCommandHeader* operator->() const { return reinterpret_cast<const RenderCommandHeader*>(m_position); }
+
+            Iterator& operator++()
+            {
+                m_position += (*this)->size / sizeof(uint64_t);
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const { return m_position == other.m_position; }
+            bool operator!=(const Iterator& other) const { return m_position != other.m_position; }
+
+        private:
+            const uint64_t* m_position;
+        };
+
+        RenderCommandStream();
+
+        // 복사 및 이동 금지
+        RenderCommandStream(const RenderCommandStream&) = delete;
+        RenderCommandStream& operator=(const RenderCommandStream&) = delete;
+        RenderCommandStream(RenderCommandStream&&) = delete;
+        RenderCommandStream& operator=(RenderCommandStream&&) = delete;
+
+        /**
+         * @brief 모든 명령 제거 (메모리는 유지해 다음 프레임에 재사용)
+         */
+        void Reset();
+
+        /**
+         * @brief 메모리 미리 확보
+         * @param sizeInBytes 확보할 바이트 수
+         */
+        void Reserve(size_t sizeInBytes);
+
+        /**
+         * @brief 다른 스트림의 명령을 뒤에 이어 붙임 (스레드별 스트림 합치기, memcpy 한 번)
+         */
+        void Append(const RenderCommandStream& other);
+
+        void SetPipelineState(RenderHandle pipelineState);
+        void SetGraphicsRootSignature(RenderHandle rootSignature);
+        void SetDescriptorHeaps(uint32_t count, const RenderHandle* heaps);
+        void SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor);
+
+        /**
+         * @brief 루트 상수 설정
+         * @param rootParameterIndex 루트 파라미터 인덱스
+         * @param count 32비트 값 개수
+         * @param values 값 배열
+         * @param destOffset 32비트 값 단위 시작 오프셋
+         */
+        void SetGraphicsRoot32BitConstants(uint32_t rootParameterIndex, uint32_t count, const void* values,
+                                           uint32_t destOffset = 0);
+
+        void SetPrimitiveTopology(PrimitiveTopology topology);
+        void SetVertexBuffers(uint32_t startSlot, uint32_t count, const VertexBufferBinding* bindings);
+        void SetIndexBuffer(const IndexBufferBinding& binding);
+        void SetViewport(const RenderViewport& viewport);
+        void SetScissorRect(const RenderRect& rect);
+
+        /**
+         * @brief 렌더 타겟 설정
+         * @param count 렌더 타겟 수 (0 ~ kMaxRenderTargets)
+         * @param renderTargets RTV CPU 디스크립터 핸들 배열
+         * @param depthStencil DSV CPU 디스크립터 핸들 (0이면 없음)
+         */
+        void SetRenderTargets(uint32_t count, const uint64_t* renderTargets, uint64_t depthStencil = 0);
+
+        void ClearRenderTarget(uint64_t renderTarget, const float color[4]);
+        void ClearDepthStencil(uint64_t depthStencil, bool clearDepth, bool clearStencil, float depth, uint8_t stencil);
+        void ResourceBarrier(uint32_t count, const RenderBarrier* barriers);
+
+        /**
+         * @brief 상태 전환 배리어 하나 기록
+         */
+        void Transition(RenderHandle resource, ResourceState before, ResourceState after,
+                        uint32_t subresource = kAllSubresources);
+
+        void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex, uint32_t startInstance);
+        void DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t startIndex, int32_t baseVertex,
+                         uint32_t startInstance);
+        void Dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
+
+        Iterator begin() const { return Iterator(m_words.data()); }
+        Iterator end() const { return Iterator(m_words.data() + m_usedWords); }
+
+        /**
+         * @brief 기록된 명령 수
+         */
+        uint32_t GetCommandCount() const { return m_commandCount; }
+
+        /**
+         * @brief 기록된 바이트 수
+         */
+        size_t GetSizeInBytes() const { return m_usedWords * sizeof(uint64_t); }
+
+        /**
+         * @brief 비어 있는지 확인
+         */
+        bool IsEmpty() const { return m_commandCount == 0; }
+
+    private:
+        /**
+         * @brief 명령 하나의 공간을 예약하고 헤더를 채움
+         * @param extraBytes 구조체 뒤 가변 데이터 바이트 수
+         * @return 명령 구조체 (값 초기화됨, 헤더 외 필드는 호출자가 채움)
+         */
+        template<typename T>
+        T* Push(size_t extraBytes = 0)
+        {
+            const size_t words = (sizeof(T) + extraBytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+            if (m_usedWords + words > m_words.size())
+            {
+                Grow(words);
+            }
+
+            // 재사용하는 버퍼에 이전 프레임 바이트가 남지 않도록 reserved 필드와 가변 데이터 뒤 패딩을 0으로 채움
+            uint64_t* position = m_words.data() + m_usedWords;
+            if (extraBytes > 0)
+            {
+                position[words - 1] = 0;
+            }
+
+            T* command = new (position) T{};
+            command->header.type = T::kType;
+            command->header.size = static_cast<uint32_t>(words * sizeof(uint64_t));
+            m_usedWords += words;
+            m_commandCount++;
+            return command;
+        }
+
+        /**
+         * @brief 최소 words만큼 더 쓸 수 있도록 버퍼 확장 (두 배씩)
+         */
+        void Grow(size_t words);
+
+        std::vector<uint64_t> m_words;  // 8바이트 정렬된 선형 버퍼 (size()가 용량, 앞 m_usedWords만 사용)
+        size_t m_usedWords;
+        uint32_t m_commandCount;
+    };
+}
@@ -6,20 +6,99 @@
 #include "Renderer.h"
 #include "Device.h"
 #include "CommandQueue.h"
+#include "QueueScheduler.h"
+#include "FenceTimeline.h"
+#include "UploadManager.h"
 #include "CommandListManager.h"
 #include "SwapChain.h"
 #include "DescriptorHeapManager.h"
 #include <Utils/Logger.h>
 #include <Core/BuildConfig.h>
+#include <algorithm>
 
 namespace DX12GameEngine
 {
+    namespace
+    {
+        /**
+         * @brief 동시 처리 프레임 수에 맞는 백 버퍼 개수 (Flip 모델은 최소 2개)
+         */
+        uint32_t GetBackBufferCountFor(uint32_t framesInFlight)
+        {
+            return std::clamp(framesInFlight, 2u, kMaxBackBufferCount);
+        }
+
+        /**
+         * @brief 리소스 바인딩 티어에서 셰이더 단계가 접근할 수 있는 디스크립터 수 (UINT_MAX면 힙 전체)
+         */
+        uint32_t GetBindingTierLimit(D3D12_DESCRIPTOR_RANGE_TYPE type, D3D12_RESOURCE_BINDING_TIER tier,
+                                     D3D_FEATURE_LEVEL featureLevel)
+        {
+            switch (type)
+            {
+            case D3D12_DESCRIPTOR_RANGE_TYPE_SRV:
+                return tier >= D3D12_RESOURCE_BINDING_TIER_2 ? UINT_MAX : D3D12_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT;
+            case D3D12_DESCRIPTOR_RANGE_TYPE_UAV:
+                if (tier >= D3D12_RESOURCE_BINDING_TIER_3)
+                {
+                    return UINT_MAX;
+                }
+                return tier == D3D12_RESOURCE_BINDING_TIER_2 || featureLevel >= D3D_FEATURE_LEVEL_11_1
+                    ? D3D12_UAV_SLOT_COUNT : D3D12_PS_CS_UAV_REGISTER_COUNT;
+            case D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER:
+                return tier >= D3D12_RESOURCE_BINDING_TIER_2 ? UINT_MAX : D3D12_COMMONSHADER_SAMPLER_SLOT_COUNT;
+            default:
+                return UINT_MAX;
+            }
+        }
+
+        /**
+         * @brief 바인드리스 테이블 용량에 맞춘 디스크립터 범위 크기 (티어 한도를 넘으면 줄이고 경고)
+         */
+        uint32_t GetBindlessRangeSize(const wchar_t* name, D3D12_DESCRIPTOR_RANGE_TYPE type, uint32_t capacity,
+                                      D3D12_RESOURCE_BINDING_TIER tier, D3D_FEATURE_LEVEL featureLevel)
+        {
+            const uint32_t limit = GetBindingTierLimit(type, tier, featureLevel);
+            if (capacity <= limit)
+            {
+                return capacity;
+            }
+
+            LOG_WARNING(LogCategory::Renderer,
+                        L"Resource binding tier {} limits the bindless {} table to {} of {} descriptors "
+                        L"(shader indices at or above {} are not accessible)",
+                        static_cast<int>(tier), name, limit, capacity, limit);
+            return limit;
+        }
+
+        /**
+         * @brief 지연 모드의 Present 대기열 깊이 (LowLatency는 한 프레임만 쌓음)
+         */
+        uint32_t GetMaxFrameLatencyFor(FrameLatencyMode mode, uint32_t framesInFlight)
+        {
+            return mode == FrameLatencyMode::LowLatency ? 1 : framesInFlight;
+        }
+
+        /**
+         * @brief 설정값을 동시 처리 프레임 수로 변환 (0이면 모드 기본값)
+         */
+        uint32_t ResolveFramesInFlight(FrameLatencyMode mode, uint32_t framesInFlight)
+        {
+            if (framesInFlight == 0)
+            {
+                return GetDefaultFramesInFlight(mode);
+            }
+            return std::min(framesInFlight, kMaxFramesInFlight);
+        }
+    }
+
     Renderer::Renderer()
-        : m_vertexBufferView{}
-        , m_commandList(nullptr)
+        : m_commandQueue(nullptr)
+        , m_vertexBufferView{}
         , m_initialized(false)
         , m_width(0)
         , m_height(0)
+        , m_latencyMode(FrameLatencyMode::Throughput)
     {
     }
 
@@ -50,11 +129,28 @@ namespace DX12GameEngine
             return false;
         }
 
-        // CommandQueue 초기화 (Direct Queue)
-        m_commandQueue = std::make_unique<CommandQueue>();
-        if (!m_commandQueue->Initialize(m_device->GetDevice(), D3D12_COMMAND_LIST_TYPE_DIRECT))
+        // FenceTimeline 초기화 (모든 큐의 Fence 대기와 완료 콜백 처리)
+        m_fenceTimeline = std::make_unique<FenceTimeline>();
+        if (!m_fenceTimeline->Initialize())
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to initialize FenceTimeline");
+            return false;
+        }
+
+        // QueueScheduler 초기화 (Graphics / Compute / Copy Queue, 큐 간 의존성은 GPU Wait로 제출)
+        m_queueScheduler = std::make_unique<QueueScheduler>();
+        if (!m_queueScheduler->Initialize(m_device->GetDevice(), m_fenceTimeline.get()))
         {
-            LOG_ERROR(LogCategory::Renderer, L"Failed to initialize CommandQueue");
+            LOG_ERROR(LogCategory::Renderer, L"Failed to initialize QueueScheduler");
+            return false;
+        }
+        m_commandQueue = &m_queueScheduler->GetQueue(QueueType::Graphics);
+
+        // UploadManager 초기화 (전용 Copy Queue와 스테이징 링)
+        m_uploadManager = std::make_unique<UploadManager>();
+        if (!m_uploadManager->Initialize(m_device->GetDevice()))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to initialize UploadManager");
             return false;
         }
 
@@ -70,6 +166,12 @@ namespace DX12GameEngine
             LOG_ERROR(LogCategory::Renderer, L"Failed to initialize CommandListManager");
             return false;
         }
+        m_commandListManager->SetFenceTimeline(m_fenceTimeline.get());
+
+        // 프레임 지연 모드 (동시 처리 프레임 수, 백 버퍼 개수, Present 대기열 깊이)
+        m_latencyMode = desc.latencyMode;
+        const uint32_t framesInFlight = ResolveFramesInFlight(desc.latencyMode, desc.framesInFlight);
+        m_commandListManager->SetFramesInFlight(framesInFlight);
 
         // SwapChain 초기화
         SwapChainDesc swapChainDesc;
@@ -79,6 +181,8 @@ namespace DX12GameEngine
         swapChainDesc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
         swapChainDesc.vsync = desc.vsync;
         swapChainDesc.allowTearing = !desc.vsync;  // VSync OFF일 때 Tearing 허용
+        swapChainDesc.bufferCount = GetBackBufferCountFor(framesInFlight);
+        swapChainDesc.maxFrameLatency = GetMaxFrameLatencyFor(desc.latencyMode, framesInFlight);
 
         m_swapChain = std::make_unique<SwapChain>();
         if (!m_swapChain->Initialize(m_device->GetFactory(), m_commandQueue->GetQueue(), swapChainDesc))
@@ -132,7 +236,8 @@ namespace DX12GameEngine
 
     bool Renderer::CreateRenderTargetViews()
     {
-        for (uint32_t i = 0; i < kBackBufferCount; ++i)
+        const uint32_t backBufferCount = m_swapChain->GetBufferCount();
+        for (uint32_t i = 0; i < backBufferCount; ++i)
         {
             m_rtvHandles[i] = m_descriptorHeapManager->AllocateRtv();
             if (!m_rtvHandles[i].IsValid())
@@ -145,13 +250,13 @@ namespace DX12GameEngine
                 m_swapChain->GetBackBuffer(i), nullptr, m_rtvHandles[i].cpuHandle);
         }
 
-        LOG_INFO(LogCategory::Renderer, L"Created {} RenderTargetViews", kBackBufferCount);
+        LOG_INFO(LogCategory::Renderer, L"Created {} RenderTargetViews", backBufferCount);
         return true;
     }
 
     void Renderer::ReleaseRenderTargetViews()
     {
-        for (uint32_t i = 0; i < kBackBufferCount; ++i)
+        for (uint32_t i = 0; i < kMaxBackBufferCount; ++i)
         {
             if (m_rtvHandles[i].IsValid())
             {
@@ -167,85 +272,122 @@ namespace DX12GameEngine
         return m_rtvHandles[index].cpuHandle;
     }
 
+    void Renderer::WaitForNextFrame()
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        // Present 대기열이 최대 프레임 지연 아래로 내려갈 때까지 대기 (이후 입력을 읽어 지연 최소화)
+        m_swapChain->WaitForFrameLatency();
+    }
+
     void Renderer::BeginFrame()
     {
+        // GPU가 끝낸 작업의 완료 콜백 처리 (블로킹 없음)
+        m_fenceTimeline->DispatchCompleted();
+
         // CommandListManager 프레임 시작
         m_commandListManager->BeginFrame(
             m_commandQueue->GetFence(),
             m_commandQueue->GetFenceEvent());
 
-        // 커맨드 리스트 획득
+        // GPU가 끝낸 프레임의 임시 디스크립터 회수
+        m_descriptorHeapManager->BeginFrame(m_commandQueue->GetCompletedFenceValue());
+
+        // 커맨드 리스트 임대
         m_commandList = m_commandListManager->GetCommandList();
 
+        // 이번 프레임 명령 기록 시작 (EndFrame에서 CommandList로 번역)
+        m_renderCommands.Reset();
+
         // 백 버퍼 상태 전환: PRESENT → RENDER_TARGET
-        ID3D12Resource* backBuffer = m_swapChain->GetCurrentBackBuffer();
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Transition.pResource = backBuffer;
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PRESENT;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        m_commandList->ResourceBarrier(1, &barrier);
+        m_renderCommands.Transition(ToRenderHandle(m_swapChain->GetCurrentBackBuffer()),
+                                    ResourceState::Present, ResourceState::RenderTarget);
 
         // 뷰포트 설정
-        D3D12_VIEWPORT viewport = {};
-        viewport.Width = static_cast<float>(m_width);
-        viewport.Height = static_cast<float>(m_height);
-        viewport.MaxDepth = 1.0f;
-        m_commandList->RSSetViewports(1, &viewport);
+        const RenderViewport viewport = { 0.0f, 0.0f, static_cast<float>(m_width), static_cast<float>(m_height), 0.0f, 1.0f };
+        m_renderCommands.SetViewport(viewport);
 
         // 시저 렉트 설정
-        D3D12_RECT scissorRect = { 0, 0, static_cast<LONG>(m_width), static_cast<LONG>(m_height) };
-        m_commandList->RSSetScissorRects(1, &scissorRect);
+        const RenderRect scissorRect = { 0, 0, m_width, m_height };
+        m_renderCommands.SetScissorRect(scissorRect);
 
         // 렌더 타겟 설정
-        D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = GetCurrentRtvHandle();
-        m_commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, nullptr);
+        const uint64_t rtvHandle = GetCurrentRtvHandle().ptr;
+        m_renderCommands.SetRenderTargets(1, &rtvHandle);
     }
 
     void Renderer::RenderFrame()
     {
         // 렌더 타겟 클리어 (Cornflower Blue)
         const float clearColor[] = { 0.39f, 0.58f, 0.93f, 1.0f };
-        m_commandList->ClearRenderTargetView(GetCurrentRtvHandle(), clearColor, 0, nullptr);
+        m_renderCommands.ClearRenderTarget(GetCurrentRtvHandle().ptr, clearColor);
 
         // 삼각형 렌더링
-        m_commandList->SetGraphicsRootSignature(m_rootSignature.Get());
-        m_commandList->SetPipelineState(m_pipelineState.Get());
-        m_commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        m_commandList->IASetVertexBuffers(0, 1, &m_vertexBufferView);
-        m_commandList->DrawInstanced(3, 1, 0, 0);
+        m_renderCommands.SetGraphicsRootSignature(ToRenderHandle(m_rootSignature.Get()));
+        BindBindlessTables();
+        m_renderCommands.SetPipelineState(ToRenderHandle(m_pipelineState.Get()));
+        m_renderCommands.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+        const VertexBufferBinding vertexBuffer = { m_vertexBufferView.BufferLocation, m_vertexBufferView.SizeInBytes,
+                                                   m_vertexBufferView.StrideInBytes };
+        m_renderCommands.SetVertexBuffers(0, 1, &vertexBuffer);
+        m_renderCommands.Draw(3, 1, 0, 0);
     }
 
     void Renderer::EndFrame()
     {
         // 백 버퍼 상태 전환: RENDER_TARGET → PRESENT
-        ID3D12Resource* backBuffer = m_swapChain->GetCurrentBackBuffer();
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Transition.pResource = backBuffer;
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
-        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        m_commandList->ResourceBarrier(1, &barrier);
+        m_renderCommands.Transition(ToRenderHandle(m_swapChain->GetCurrentBackBuffer()),
+                                    ResourceState::RenderTarget, ResourceState::Present);
+
+        // 기록한 명령을 CommandList로 번역 (새 상태를 설정하지 않는 명령은 버림)
+        m_commandTranslator.Translate(m_renderCommands, m_commandList.Get());
+
+        // 실제로 기록한 API 호출 수를 Allocator 크기 추적에 보고 (급증한 Allocator는 풀에서 교체)
+        m_commandListManager->ReportRecordedCommands(m_commandList, m_commandTranslator.GetFrameStats().GetIssuedCount());
+        m_commandTranslator.EndFrame();
 
         // 커맨드 리스트 닫기
         m_commandList->Close();
 
-        // 커맨드 리스트 실행
-        ID3D12CommandList* commandLists[] = { m_commandList };
-        m_commandQueue->ExecuteCommandLists(commandLists, 1);
+        // 스테이징 디스크립터를 셰이더 가시 힙에 복사 (실행 전에 완료되어야 함)
+        m_descriptorHeapManager->FlushDescriptorCopies();
+
+        // 쌓인 업로드를 복사 큐에 제출하고, 이번 프레임이 GPU에서 업로드 완료를 기다리도록 예약
+        m_uploadManager->QueueWait(*m_commandQueue);
+
+        // 이번 프레임의 작업을 스케줄러로 제출 (Compute / Copy 작업과 의존성도 여기서 함께 추가)
+        m_queueScheduler->AddJob(QueueType::Graphics, "Frame", m_commandList.Get());
+        const bool submitted = m_queueScheduler->Submit();
+
+        uint64_t fenceValue = 0;
+        if (submitted)
+        {
+            fenceValue = m_queueScheduler->GetLastFenceValue(QueueType::Graphics);
+        }
+        else
+        {
+            // 이번 프레임은 실행되지 않음. Allocator와 임시 디스크립터는 지금까지 제출된 작업 뒤에
+            // 새로 Signal한 값으로 반환 (이전 프레임 값이나 Signal되지 않은 값을 붙이지 않음)
+            LOG_ERROR(LogCategory::Renderer, L"Frame submission failed, skipping Present");
+            fenceValue = m_commandQueue->Signal();
+        }
 
         // 커맨드 리스트 반환
         m_commandListManager->ReturnCommandList(m_commandList);
-        m_commandList = nullptr;
+        m_commandList = CommandListLease();
 
-        // Present
-        m_swapChain->Present();
+        // Present (제출하지 못한 프레임은 백 버퍼를 넘기지 않음)
+        if (submitted)
+        {
+            m_swapChain->Present();
+        }
 
-        // Fence 시그널 및 CommandListManager 프레임 종료
-        uint64_t fenceValue = m_commandQueue->Signal();
+        // CommandListManager / 임시 디스크립터 프레임 종료
         m_commandListManager->EndFrame(fenceValue);
+        m_descriptorHeapManager->EndFrame(fenceValue);
     }
 
     void Renderer::OnResize(int width, int height)
@@ -261,7 +403,7 @@ namespace DX12GameEngine
         }
 
         // GPU 작업 완료 대기 (리사이즈 전 필수)
-        m_commandQueue->Flush();
+        m_queueScheduler->Flush();
 
         m_width = width;
         m_height = height;
@@ -278,6 +420,53 @@ namespace DX12GameEngine
         LOG_INFO(LogCategory::Renderer, L"Renderer resized ({}x{})", m_width, m_height);
     }
 
+    bool Renderer::SetFrameLatencyMode(FrameLatencyMode mode, uint32_t framesInFlight)
+    {
+        if (!m_initialized)
+        {
+            return false;
+        }
+
+        const uint32_t resolvedFrames = ResolveFramesInFlight(mode, framesInFlight);
+        const uint32_t backBufferCount = GetBackBufferCountFor(resolvedFrames);
+        if (mode == m_latencyMode && resolvedFrames == m_commandListManager->GetFramesInFlight() &&
+            backBufferCount == m_swapChain->GetBufferCount())
+        {
+            return true;
+        }
+
+        // 백 버퍼와 프레임별 리소스를 바꾸기 전에 GPU 작업 완료 대기
+        m_queueScheduler->Flush();
+
+        if (backBufferCount != m_swapChain->GetBufferCount())
+        {
+            ReleaseRenderTargetViews();
+            const bool resized = m_swapChain->SetBufferCount(backBufferCount);
+            if (!CreateRenderTargetViews() || !resized)
+            {
+                LOG_ERROR(LogCategory::Renderer, L"Failed to change back buffer count to {}", backBufferCount);
+                return false;
+            }
+        }
+
+        m_swapChain->SetMaximumFrameLatency(GetMaxFrameLatencyFor(mode, resolvedFrames));
+        if (!m_commandListManager->SetFramesInFlight(resolvedFrames))
+        {
+            return false;
+        }
+        m_latencyMode = mode;
+
+        LOG_INFO(LogCategory::Renderer, L"Frame latency mode: {} ({} frames in flight, {} back buffers, max latency {})",
+                 mode == FrameLatencyMode::LowLatency ? L"LowLatency" : L"Throughput",
+                 resolvedFrames, m_swapChain->GetBufferCount(), m_swapChain->GetMaximumFrameLatency());
+        return true;
+    }
+
+    uint32_t Renderer::GetFramesInFlight() const
+    {
+        return m_commandListManager ? m_commandListManager->GetFramesInFlight() : 0;
+    }
+
     ComPtr<ID3DBlob> Renderer::CompileShader(const std::wstring& filename,
         const std::string& entryPoint, const std::string& target)
     {
@@ -321,12 +510,87 @@ namespace DX12GameEngine
         return shaderBlob;
     }
 
+    void Renderer::BindBindlessTables()
+    {
+        BindlessDescriptorTable* resourceTable = m_descriptorHeapManager->GetBindlessResourceTable();
+        BindlessDescriptorTable* samplerTable = m_descriptorHeapManager->GetBindlessSamplerTable();
+        if (!resourceTable || !samplerTable)
+        {
+            return;
+        }
+
+        const RenderHandle heaps[] =
+        {
+            ToRenderHandle(m_descriptorHeapManager->GetCbvSrvUavHeap()->GetHeap()),
+            ToRenderHandle(m_descriptorHeapManager->GetSamplerHeap()->GetHeap())
+        };
+        m_renderCommands.SetDescriptorHeaps(2, heaps);
+
+        // SRV/UAV 테이블은 같은 구간을 가리킴 (슬롯마다 SRV 또는 UAV 중 하나)
+        m_renderCommands.SetGraphicsRootDescriptorTable(kRootParameterBindlessSrv, resourceTable->GetGpuTableStart().ptr);
+        m_renderCommands.SetGraphicsRootDescriptorTable(kRootParameterBindlessUav, resourceTable->GetGpuTableStart().ptr);
+        m_renderCommands.SetGraphicsRootDescriptorTable(kRootParameterBindlessSampler, samplerTable->GetGpuTableStart().ptr);
+    }
+
     bool Renderer::CreateRootSignature()
     {
-        // 삼각형 렌더링에는 외부 리소스(CBV/SRV/UAV)가 필요 없으므로 빈 루트 시그니처 사용
+        // 바인드리스 테이블: SRV(space1) / UAV(space2) / Sampler(space1) 배열.
+        // 셰이더는 BindlessHandle::GetShaderIndex()로 배열을 인덱싱하므로 드로우마다 테이블을 바꾸지 않음
+        // 크기 제한 없는 범위는 Tier 2(SRV) / Tier 3(UAV, Sampler) 이상에서만 유효하므로
+        // 범위는 실제 테이블 용량으로 잡고, 낮은 티어에서는 셰이더 단계당 한도로 줄임
+        const BindlessDescriptorTable* resourceTable = m_descriptorHeapManager->GetBindlessResourceTable();
+        const BindlessDescriptorTable* samplerTable = m_descriptorHeapManager->GetBindlessSamplerTable();
+        const bool useBindless = resourceTable && samplerTable;
+
+        const D3D12_RESOURCE_BINDING_TIER bindingTier = m_device->GetResourceBindingTier();
+        const D3D_FEATURE_LEVEL featureLevel = m_device->GetFeatureLevel();
+
+        D3D12_DESCRIPTOR_RANGE srvRange = {};
+        srvRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+        srvRange.BaseShaderRegister = 0;
+        srvRange.RegisterSpace = kBindlessSrvSpace;
+        srvRange.OffsetInDescriptorsFromTableStart = 0;
+
+        D3D12_DESCRIPTOR_RANGE uavRange = srvRange;
+        uavRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_UAV;
+        uavRange.RegisterSpace = kBindlessUavSpace;
+
+        D3D12_DESCRIPTOR_RANGE samplerRange = srvRange;
+        samplerRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER;
+        samplerRange.RegisterSpace = kBindlessSamplerSpace;
+
+        if (useBindless)
+        {
+            srvRange.NumDescriptors = GetBindlessRangeSize(L"SRV", srvRange.RangeType,
+                resourceTable->GetCapacity(), bindingTier, featureLevel);
+            uavRange.NumDescriptors = GetBindlessRangeSize(L"UAV", uavRange.RangeType,
+                resourceTable->GetCapacity(), bindingTier, featureLevel);
+            samplerRange.NumDescriptors = GetBindlessRangeSize(L"Sampler", samplerRange.RangeType,
+                samplerTable->GetCapacity(), bindingTier, featureLevel);
+
+            LOG_INFO(LogCategory::Renderer, L"Bindless root tables (binding tier {}): {} SRV, {} UAV, {} Sampler",
+                     static_cast<int>(bindingTier), srvRange.NumDescriptors, uavRange.NumDescriptors,
+                     samplerRange.NumDescriptors);
+        }
+        else
+        {
+            // BindBindlessTables도 테이블이 없으면 아무것도 바인딩하지 않음
+            LOG_WARNING(LogCategory::Renderer, L"Bindless tables are disabled, root signature has no descriptor tables");
+        }
+
+        D3D12_ROOT_PARAMETER rootParameters[kRootParameterCount] = {};
+        const D3D12_DESCRIPTOR_RANGE* ranges[kRootParameterCount] = { &srvRange, &uavRange, &samplerRange };
+        for (uint32_t i = 0; i < kRootParameterCount; ++i)
+        {
+            rootParameters[i].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+            rootParameters[i].DescriptorTable.NumDescriptorRanges = 1;
+            rootParameters[i].DescriptorTable.pDescriptorRanges = ranges[i];
+            rootParameters[i].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+        }
+
         D3D12_ROOT_SIGNATURE_DESC rootSigDesc = {};
-        rootSigDesc.NumParameters = 0;
-        rootSigDesc.pParameters = nullptr;
+        rootSigDesc.NumParameters = useBindless ? kRootParameterCount : 0;
+        rootSigDesc.pParameters = useBindless ? rootParameters : nullptr;
         rootSigDesc.NumStaticSamplers = 0;
         rootSigDesc.pStaticSamplers = nullptr;
         rootSigDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
@@ -458,49 +722,13 @@ namespace DX12GameEngine
 
         const UINT bufferSize = sizeof(vertices);
 
-        // CPU에서 쓰고 GPU에서 읽는 UPLOAD 힙 사용 (정적 지오메트리지만 Phase 1은 단순화)
-        D3D12_HEAP_PROPERTIES heapProps = {};
-        heapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
-
-        D3D12_RESOURCE_DESC bufferDesc = {};
-        bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-        bufferDesc.Alignment = 0;
-        bufferDesc.Width = bufferSize;
-        bufferDesc.Height = 1;
-        bufferDesc.DepthOrArraySize = 1;
-        bufferDesc.MipLevels = 1;
-        bufferDesc.Format = DXGI_FORMAT_UNKNOWN;
-        bufferDesc.SampleDesc.Count = 1;
-        bufferDesc.SampleDesc.Quality = 0;
-        bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-        bufferDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-
-        HRESULT hr = m_device->GetDevice()->CreateCommittedResource(
-            &heapProps,
-            D3D12_HEAP_FLAG_NONE,
-            &bufferDesc,
-            D3D12_RESOURCE_STATE_GENERIC_READ,
-            nullptr,
-            IID_PPV_ARGS(&m_vertexBuffer));
-
-        if (FAILED(hr))
-        {
-            LOG_ERROR(LogCategory::Renderer, L"Failed to create Vertex Buffer, HRESULT: {:#010x}",
-                static_cast<uint32_t>(hr));
-            return false;
-        }
-
-        // CPU에서 정점 데이터 복사
-        void* mappedData = nullptr;
-        D3D12_RANGE readRange = { 0, 0 };  // 읽기 없음
-        hr = m_vertexBuffer->Map(0, &readRange, &mappedData);
-        if (FAILED(hr))
+        // 정적 지오메트리는 DEFAULT 힙에 두고 복사 큐로 업로드 (첫 프레임 제출 시 GPU에서 완료를 기다림)
+        m_vertexBuffer = m_uploadManager->CreateBuffer(vertices, bufferSize);
+        if (!m_vertexBuffer)
         {
-            LOG_ERROR(LogCategory::Renderer, L"Failed to map Vertex Buffer");
+            LOG_ERROR(LogCategory::Renderer, L"Failed to create Vertex Buffer");
             return false;
         }
-        memcpy(mappedData, vertices, bufferSize);
-        m_vertexBuffer->Unmap(0, nullptr);
 
         // Vertex Buffer View 설정
         m_vertexBufferView.BufferLocation = m_vertexBuffer->GetGPUVirtualAddress();
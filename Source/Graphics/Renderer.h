@@ -10,6 +10,9 @@
 
 #include "SwapChain.h"
 #include "DescriptorHeap.h"
+#include "CommandListManager.h"
+#include "RenderCommandStream.h"
+#include "D3D12CommandTranslator.h"
 #include <Windows.h>
 #include <d3dcompiler.h>
 #include <memory>
@@ -18,10 +21,32 @@
 namespace DX12GameEngine
 {
     class Device;
+    class FenceTimeline;
     class CommandQueue;
-    class CommandListManager;
+    class QueueScheduler;
+    class UploadManager;
     class DescriptorHeapManager;
 
+    /**
+     * @brief 프레임 지연 모드
+     *
+     * - LowLatency: 동시 처리 1 ~ 2프레임, Present 대기열 1프레임 (입력 반응 우선, 경쟁 입력 게임)
+     * - Throughput: 동시 처리 3 ~ 4프레임, Present 대기열도 같은 깊이 (CPU/GPU 겹침 우선, 벤치마크)
+     */
+    enum class FrameLatencyMode : uint8_t
+    {
+        LowLatency,
+        Throughput
+    };
+
+    /**
+     * @brief 지연 모드의 기본 동시 처리 프레임 수
+     */
+    constexpr uint32_t GetDefaultFramesInFlight(FrameLatencyMode mode)
+    {
+        return mode == FrameLatencyMode::LowLatency ? 2 : kDefaultFramesInFlight;
+    }
+
     /**
      * @brief 렌더러 설정
      *
@@ -34,9 +59,10 @@ namespace DX12GameEngine
         bool vsync;             // 수직 동기화
         int msaaSamples;        // MSAA 샘플 수 (1, 2, 4, 8)
         bool hdr;               // HDR 렌더링 (나중에)
+        FrameLatencyMode latencyMode;   // 프레임 지연 모드 (실행 중 SetFrameLatencyMode로 변경 가능)
+        uint32_t framesInFlight;        // 동시 처리 프레임 수 (1 ~ kMaxFramesInFlight, 0이면 모드 기본값)
 
         // TODO: Phase 2+에서 추가
-        // int maxFramesInFlight;   // 동시 처리 프레임 수
         // bool raytracing;         // 레이트레이싱 활성화
 
         // 기본 생성자 (EngineDesc에서 설정)
@@ -45,6 +71,8 @@ namespace DX12GameEngine
             , vsync(true)
             , msaaSamples(1)
             , hdr(false)
+            , latencyMode(FrameLatencyMode::Throughput)
+            , framesInFlight(0)
         {
         }
     };
@@ -78,6 +106,14 @@ namespace DX12GameEngine
          */
         bool Initialize(HWND hwnd, int width, int height, const RendererDesc& desc);
 
+        /**
+         * @brief 스왑체인이 다음 프레임을 받을 수 있을 때까지 대기
+         *
+         * 게임 루프에서 입력을 처리하기 전에 호출합니다. 대기가 끝난 뒤 읽은 입력으로
+         * 프레임을 만들기 때문에, Present 대기열에서 기다리는 시간만큼 입력 지연이 줄어듭니다.
+         */
+        void WaitForNextFrame();
+
         /**
          * @brief 프레임 시작
          */
@@ -100,6 +136,32 @@ namespace DX12GameEngine
          */
         void OnResize(int width, int height);
 
+        /**
+         * @brief 프레임 지연 모드 변경 (프레임 사이에 호출, 재시작 불필요)
+         *
+         * GPU 작업 완료를 기다린 뒤 백 버퍼 개수, Present 대기열 깊이, 동시 처리 프레임 수를 바꿉니다.
+         *
+         * @param mode 프레임 지연 모드
+         * @param framesInFlight 동시 처리 프레임 수 (0이면 모드 기본값, 1 ~ kMaxFramesInFlight)
+         * @return 성공 시 true
+         */
+        bool SetFrameLatencyMode(FrameLatencyMode mode, uint32_t framesInFlight = 0);
+
+        /**
+         * @brief 현재 프레임 지연 모드
+         */
+        FrameLatencyMode GetFrameLatencyMode() const { return m_latencyMode; }
+
+        /**
+         * @brief 현재 동시 처리 프레임 수
+         */
+        uint32_t GetFramesInFlight() const;
+
+        /**
+         * @brief 마지막 프레임의 명령 번역 통계 (중복 상태 설정 제거 수 포함)
+         */
+        const CommandTranslationStats& GetCommandTranslationStats() const { return m_commandTranslator.GetLastFrameStats(); }
+
         /**
          * @brief 현재 백 버퍼의 RTV 핸들 가져오기
          * @return 현재 백 버퍼에 대한 CPU 디스크립터 핸들
@@ -109,7 +171,10 @@ namespace DX12GameEngine
     private:
         // DX12 객체들 (완전히 캡슐화, 외부 노출 없음)
         std::unique_ptr<Device> m_device;
-        std::unique_ptr<CommandQueue> m_commandQueue;
+        std::unique_ptr<FenceTimeline> m_fenceTimeline;     // 큐보다 늦게 해제 (큐 소멸자의 Flush가 사용)
+        std::unique_ptr<QueueScheduler> m_queueScheduler;   // Graphics / Compute / Copy 큐
+        CommandQueue* m_commandQueue;                       // m_queueScheduler의 Graphics 큐
+        std::unique_ptr<UploadManager> m_uploadManager;
         std::unique_ptr<CommandListManager> m_commandListManager;
         std::unique_ptr<SwapChain> m_swapChain;
         std::unique_ptr<DescriptorHeapManager> m_descriptorHeapManager;
@@ -136,11 +201,25 @@ namespace DX12GameEngine
             const std::string& entryPoint, const std::string& target);
 
         /**
-         * @brief Root Signature 생성
+         * @brief Root Signature 생성 (바인드리스 SRV/UAV/Sampler 테이블, 크기는 테이블 용량과 바인딩 티어로 결정)
          * @return 성공 시 true
          */
         bool CreateRootSignature();
 
+        /**
+         * @brief 셰이더 가시 힙과 바인드리스 테이블 바인딩 (루트 시그니처 설정 후 호출)
+         */
+        void BindBindlessTables();
+
+        // 루트 파라미터 인덱스와 바인드리스 레지스터 공간 (HLSL: Texture2D g_textures[] : register(t0, space1))
+        static constexpr uint32_t kRootParameterBindlessSrv = 0;
+        static constexpr uint32_t kRootParameterBindlessUav = 1;
+        static constexpr uint32_t kRootParameterBindlessSampler = 2;
+        static constexpr uint32_t kRootParameterCount = 3;
+        static constexpr uint32_t kBindlessSrvSpace = 1;
+        static constexpr uint32_t kBindlessUavSpace = 2;
+        static constexpr uint32_t kBindlessSamplerSpace = 1;
+
         /**
          * @brief Pipeline State Object 생성
          * @return 성공 시 true
@@ -148,13 +227,13 @@ namespace DX12GameEngine
         bool CreatePipelineState();
 
         /**
-         * @brief 삼각형 Vertex Buffer 생성
+         * @brief 삼각형 Vertex Buffer 생성 (DEFAULT 힙, 복사 큐로 업로드)
          * @return 성공 시 true
          */
         bool CreateTriangleVertexBuffer();
 
         // RTV 핸들 (백 버퍼별)
-        DescriptorHandle m_rtvHandles[kBackBufferCount];
+        DescriptorHandle m_rtvHandles[kMaxBackBufferCount];
 
         // 파이프라인 객체
         ComPtr<ID3D12RootSignature> m_rootSignature;
@@ -164,12 +243,17 @@ namespace DX12GameEngine
         ComPtr<ID3D12Resource> m_vertexBuffer;
         D3D12_VERTEX_BUFFER_VIEW m_vertexBufferView;
 
-        // 현재 프레임의 커맨드 리스트 (BeginFrame에서 획득, EndFrame에서 반환)
-        ID3D12GraphicsCommandList* m_commandList;
+        // 현재 프레임의 커맨드 리스트 임대 (BeginFrame에서 임대, EndFrame에서 반환)
+        CommandListLease m_commandList;
+
+        // 현재 프레임의 렌더 명령 (BeginFrame ~ EndFrame 동안 기록, EndFrame에서 m_commandList로 번역)
+        RenderCommandStream m_renderCommands;
+        D3D12CommandTranslator m_commandTranslator;
 
         // 상태
         bool m_initialized;
         int m_width;
         int m_height;
+        FrameLatencyMode m_latencyMode;
     };
 }
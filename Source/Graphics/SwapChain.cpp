@@ -5,11 +5,15 @@
 
 #include "SwapChain.h"
 #include <Utils/Logger.h>
+#include <algorithm>
 
 namespace DX12GameEngine
 {
     SwapChain::SwapChain()
-        : m_width(0)
+        : m_bufferCount(kDefaultBackBufferCount)
+        , m_maxFrameLatency(kDefaultBackBufferCount)
+        , m_frameLatencyWaitable(nullptr)
+        , m_width(0)
         , m_height(0)
         , m_format(DXGI_FORMAT_R8G8B8A8_UNORM)
         , m_vsync(true)
@@ -23,6 +27,11 @@ namespace DX12GameEngine
         if (m_initialized)
         {
             ReleaseBackBuffers();
+            if (m_frameLatencyWaitable)
+            {
+                CloseHandle(m_frameLatencyWaitable);
+                m_frameLatencyWaitable = nullptr;
+            }
             LOG_INFO(LogCategory::Renderer, L"SwapChain destroyed");
         }
     }
@@ -36,12 +45,14 @@ namespace DX12GameEngine
             return true;
         }
 
-        if (!factory || !commandQueue || !desc.hwnd)
+        if (!factory || !commandQueue || !desc.hwnd ||
+            desc.bufferCount < 2 || desc.bufferCount > kMaxBackBufferCount)
         {
             LOG_ERROR(LogCategory::Renderer, L"SwapChain::Initialize - invalid parameters");
             return false;
         }
 
+        m_bufferCount = desc.bufferCount;
         m_width = desc.width;
         m_height = desc.height;
         m_format = desc.format;
@@ -59,11 +70,15 @@ namespace DX12GameEngine
         swapChainDesc.SampleDesc.Count = 1;
         swapChainDesc.SampleDesc.Quality = 0;
         swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-        swapChainDesc.BufferCount = kBackBufferCount;
+        swapChainDesc.BufferCount = m_bufferCount;
         swapChainDesc.Scaling = DXGI_SCALING_STRETCH;
         swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
         swapChainDesc.AlphaMode = DXGI_ALPHA_MODE_UNSPECIFIED;
-        swapChainDesc.Flags = m_tearingSupported ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+        swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+        if (m_tearingSupported)
+        {
+            swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+        }
 
         ComPtr<IDXGISwapChain1> swapChain1;
         HRESULT hr = factory->CreateSwapChainForHwnd(
@@ -103,11 +118,14 @@ namespace DX12GameEngine
             return false;
         }
 
+        // Frame Latency Waitable Object (이 플래그로 만들면 기본 최대 지연이 1이므로 바로 설정)
+        m_frameLatencyWaitable = m_swapChain->GetFrameLatencyWaitableObject();
         m_initialized = true;
+        SetMaximumFrameLatency(desc.maxFrameLatency);
 
         LOG_INFO(LogCategory::Renderer,
-                 L"SwapChain initialized ({}x{}, {} buffers, VSync: {}, Tearing: {})",
-                 m_width, m_height, kBackBufferCount,
+                 L"SwapChain initialized ({}x{}, {} buffers, max latency {}, VSync: {}, Tearing: {})",
+                 m_width, m_height, m_bufferCount, m_maxFrameLatency,
                  m_vsync ? L"ON" : L"OFF",
                  m_tearingSupported ? L"Supported" : L"Not supported");
 
@@ -136,6 +154,10 @@ namespace DX12GameEngine
         {
             if (hr == DXGI_ERROR_DEVICE_REMOVED || hr == DXGI_ERROR_DEVICE_RESET)
             {
+                // 디바이스 제거 직전의 Trace/Debug 맥락을 먼저 덤프
+                FlightRecorder::Get().Dump(hr == DXGI_ERROR_DEVICE_REMOVED
+                    ? L"Device removed during Present" : L"Device reset during Present");
+
                 LOG_ERROR(LogCategory::Renderer, L"Device lost during Present");
                 // TODO: 디바이스 복구 처리
             }
@@ -180,7 +202,7 @@ namespace DX12GameEngine
         m_swapChain->GetDesc1(&desc);
 
         HRESULT hr = m_swapChain->ResizeBuffers(
-            kBackBufferCount,
+            m_bufferCount,
             width,
             height,
             m_format,
@@ -208,6 +230,86 @@ namespace DX12GameEngine
         return true;
     }
 
+    bool SwapChain::SetBufferCount(uint32_t bufferCount)
+    {
+        if (!m_initialized)
+        {
+            return false;
+        }
+
+        if (bufferCount < 2 || bufferCount > kMaxBackBufferCount)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"SwapChain::SetBufferCount - invalid count {} (2 ~ {})",
+                        bufferCount, kMaxBackBufferCount);
+            return false;
+        }
+
+        if (bufferCount == m_bufferCount)
+        {
+            return true;
+        }
+
+        ReleaseBackBuffers();
+
+        // 크기와 포맷은 유지하고 개수만 변경 (플래그는 생성 시와 같아야 함)
+        DXGI_SWAP_CHAIN_DESC1 desc;
+        m_swapChain->GetDesc1(&desc);
+
+        HRESULT hr = m_swapChain->ResizeBuffers(bufferCount, m_width, m_height, m_format, desc.Flags);
+        if (FAILED(hr))
+        {
+            LOG_ERROR(LogCategory::Renderer,
+                      L"Failed to change SwapChain buffer count (HRESULT: {:#x})",
+                      static_cast<uint32_t>(hr));
+            AcquireBackBuffers();
+            return false;
+        }
+
+        LOG_INFO(LogCategory::Renderer, L"SwapChain buffer count: {} -> {}", m_bufferCount, bufferCount);
+        m_bufferCount = bufferCount;
+
+        return AcquireBackBuffers();
+    }
+
+    bool SwapChain::SetMaximumFrameLatency(uint32_t maxFrameLatency)
+    {
+        if (!m_initialized)
+        {
+            return false;
+        }
+
+        // DXGI가 허용하는 최대 지연은 1 ~ 16
+        maxFrameLatency = std::clamp(maxFrameLatency, 1u, 16u);
+
+        HRESULT hr = m_swapChain->SetMaximumFrameLatency(maxFrameLatency);
+        if (FAILED(hr))
+        {
+            LOG_ERROR(LogCategory::Renderer,
+                      L"Failed to set maximum frame latency (HRESULT: {:#x})",
+                      static_cast<uint32_t>(hr));
+            return false;
+        }
+
+        m_maxFrameLatency = maxFrameLatency;
+        return true;
+    }
+
+    bool SwapChain::WaitForFrameLatency(uint32_t timeoutMs)
+    {
+        if (!m_initialized || !m_frameLatencyWaitable)
+        {
+            return false;
+        }
+
+        const DWORD result = WaitForSingleObjectEx(m_frameLatencyWaitable, timeoutMs, TRUE);
+        if (result == WAIT_TIMEOUT)
+        {
+            LOG_DEBUG_EVERY_MS(LogCategory::Renderer, 1000, L"Frame latency wait timed out ({} ms)", timeoutMs);
+            return false;
+        }
+        return result == WAIT_OBJECT_0;
+    }
+
     uint32_t SwapChain::GetCurrentBackBufferIndex() const
     {
         if (!m_initialized)
@@ -219,7 +321,7 @@ namespace DX12GameEngine
 
     ID3D12Resource* SwapChain::GetBackBuffer(uint32_t index) const
     {
-        if (index >= kBackBufferCount)
+        if (index >= m_bufferCount)
         {
             return nullptr;
         }
@@ -258,7 +360,7 @@ namespace DX12GameEngine
 
     bool SwapChain::AcquireBackBuffers()
     {
-        for (uint32_t i = 0; i < kBackBufferCount; i++)
+        for (uint32_t i = 0; i < m_bufferCount; i++)
         {
             HRESULT hr = m_swapChain->GetBuffer(i, IID_PPV_ARGS(&m_backBuffers[i]));
             if (FAILED(hr))
@@ -270,13 +372,13 @@ namespace DX12GameEngine
             }
         }
 
-        LOG_DEBUG(LogCategory::Renderer, L"Acquired {} back buffers", kBackBufferCount);
+        LOG_DEBUG(LogCategory::Renderer, L"Acquired {} back buffers", m_bufferCount);
         return true;
     }
 
     void SwapChain::ReleaseBackBuffers()
     {
-        for (uint32_t i = 0; i < kBackBufferCount; i++)
+        for (uint32_t i = 0; i < kMaxBackBufferCount; i++)
         {
             m_backBuffers[i].Reset();
         }
@@ -2,8 +2,8 @@
  * @file SwapChain.h
  * @brief DXGI 스왑체인 관리
  *
- * 더블/트리플 버퍼링을 지원하는 스왑체인을 관리합니다.
- * Present, 리사이즈, VSync 등을 담당합니다.
+ * 더블/트리플/쿼드 버퍼링을 지원하는 스왑체인을 관리합니다.
+ * Present, 리사이즈, VSync, 프레임 지연(Frame Latency Waitable Object) 등을 담당합니다.
  */
 
 #pragma once
@@ -17,8 +17,11 @@ namespace DX12GameEngine
 {
     using Microsoft::WRL::ComPtr;
 
-    /** @brief 백 버퍼 개수 (Triple Buffering) */
-    static constexpr uint32_t kBackBufferCount = 3;
+    /** @brief 최대 백 버퍼 개수 (실제 개수는 런타임에 2 ~ kMaxBackBufferCount) */
+    static constexpr uint32_t kMaxBackBufferCount = 4;
+
+    /** @brief 기본 백 버퍼 개수 (Triple Buffering) */
+    static constexpr uint32_t kDefaultBackBufferCount = 3;
 
     /**
      * @brief 스왑체인 설정
@@ -31,6 +34,8 @@ namespace DX12GameEngine
         DXGI_FORMAT format;     // 백 버퍼 포맷
         bool vsync;             // 수직 동기화
         bool allowTearing;      // Tearing 허용 (VRR/FreeSync)
+        uint32_t bufferCount;   // 백 버퍼 개수 (2 ~ kMaxBackBufferCount)
+        uint32_t maxFrameLatency;   // Present 대기열에 쌓을 수 있는 최대 프레임 수
 
         SwapChainDesc()
             : hwnd(nullptr)
@@ -39,6 +44,8 @@ namespace DX12GameEngine
             , format(DXGI_FORMAT_R8G8B8A8_UNORM)
             , vsync(true)
             , allowTearing(false)
+            , bufferCount(kDefaultBackBufferCount)
+            , maxFrameLatency(kDefaultBackBufferCount)
         {
         }
     };
@@ -48,6 +55,11 @@ namespace DX12GameEngine
      *
      * Triple Buffering을 기본으로 사용하며,
      * VSync 및 Tearing(FreeSync/G-Sync) 모드를 지원합니다.
+     *
+     * 항상 Frame Latency Waitable Object와 함께 생성합니다.
+     * 매 프레임 입력 처리 전에 WaitForFrameLatency()를 호출하면, Present 대기열이
+     * maxFrameLatency 프레임 아래로 내려갈 때까지 CPU를 재워 입력부터 화면까지의 지연을 줄입니다.
+     * 백 버퍼 개수와 최대 프레임 지연은 재시작 없이 바꿀 수 있습니다.
      */
     class SwapChain
     {
@@ -85,9 +97,43 @@ namespace DX12GameEngine
          */
         bool Resize(uint32_t width, uint32_t height);
 
+        /**
+         * @brief 백 버퍼 개수 변경 (GPU가 백 버퍼를 사용하지 않는 상태에서 호출)
+         *
+         * 백 버퍼를 외부에서 참조하고 있으면 (RTV 등) 먼저 해제해야 합니다.
+         *
+         * @param bufferCount 새 백 버퍼 개수 (2 ~ kMaxBackBufferCount)
+         * @return 성공 시 true
+         */
+        bool SetBufferCount(uint32_t bufferCount);
+
+        /**
+         * @brief 최대 프레임 지연 변경 (Present 대기열에 쌓을 수 있는 프레임 수)
+         * @param maxFrameLatency 최대 프레임 지연 (1 ~ 16)
+         * @return 성공 시 true
+         */
+        bool SetMaximumFrameLatency(uint32_t maxFrameLatency);
+
+        /**
+         * @brief Present 대기열에 자리가 날 때까지 대기 (입력 처리 전에 프레임마다 한 번 호출)
+         * @param timeoutMs 최대 대기 시간 (창이 가려져 Present가 멈춘 경우에도 루프가 돌도록)
+         * @return 시간 안에 자리가 났으면 true
+         */
+        bool WaitForFrameLatency(uint32_t timeoutMs = 1000);
+
+        /**
+         * @brief 백 버퍼 개수
+         */
+        uint32_t GetBufferCount() const { return m_bufferCount; }
+
+        /**
+         * @brief 최대 프레임 지연
+         */
+        uint32_t GetMaximumFrameLatency() const { return m_maxFrameLatency; }
+
         /**
          * @brief 현재 백 버퍼 인덱스 가져오기
-         * @return 현재 백 버퍼 인덱스 (0 ~ kBackBufferCount-1)
+         * @return 현재 백 버퍼 인덱스 (0 ~ GetBufferCount()-1)
          */
         uint32_t GetCurrentBackBufferIndex() const;
 
@@ -146,7 +192,10 @@ namespace DX12GameEngine
         void ReleaseBackBuffers();
 
         ComPtr<IDXGISwapChain4> m_swapChain;
-        ComPtr<ID3D12Resource> m_backBuffers[kBackBufferCount];
+        ComPtr<ID3D12Resource> m_backBuffers[kMaxBackBufferCount];
+        uint32_t m_bufferCount;
+        uint32_t m_maxFrameLatency;
+        HANDLE m_frameLatencyWaitable;      // Frame Latency Waitable Object (스왑체인 소유, 닫기 필요)
 
         uint32_t m_width;
         uint32_t m_height;
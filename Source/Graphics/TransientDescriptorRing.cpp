@@ -0,0 +1,148 @@
+/**
+ * @file TransientDescriptorRing.cpp
+ * @brief 프레임 단위 임시 디스크립터 링 할당자 구현
+ */
+
+#include "TransientDescriptorRing.h"
+#include <Utils/Logger.h>
+#include <algorithm>
+
+namespace DX12GameEngine
+{
+    TransientDescriptorRing::TransientDescriptorRing()
+        : m_heap(nullptr)
+        , m_capacity(0)
+        , m_head(0)
+        , m_limit(0)
+        , m_tail(0)
+        , m_initialized(false)
+    {
+    }
+
+    TransientDescriptorRing::~TransientDescriptorRing()
+    {
+        Shutdown();
+    }
+
+    bool TransientDescriptorRing::Initialize(DescriptorHeap* heap, uint32_t capacity)
+    {
+        if (m_initialized)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"TransientDescriptorRing already initialized");
+            return true;
+        }
+
+        if (!heap || !heap->IsShaderVisible() || capacity == 0)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"TransientDescriptorRing::Initialize - invalid parameters");
+            return false;
+        }
+
+        m_base = heap->AllocateRange(capacity);
+        if (!m_base.IsValid())
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to reserve {} transient descriptors", capacity);
+            return false;
+        }
+
+        m_heap = heap;
+        m_capacity = capacity;
+        m_head.store(0, std::memory_order_relaxed);
+        m_limit.store(capacity, std::memory_order_relaxed);
+        m_tail = 0;
+        m_pendingFrames.clear();
+        m_initialized = true;
+
+        LOG_INFO(LogCategory::Renderer, L"TransientDescriptorRing initialized ({} descriptors at [{}, {}))",
+                 capacity, m_base.heapIndex, m_base.heapIndex + capacity);
+        return true;
+    }
+
+    void TransientDescriptorRing::Shutdown()
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        m_heap->FreeRange(m_base, m_capacity);
+        m_heap = nullptr;
+        m_base = DescriptorHandle();
+        m_capacity = 0;
+        m_pendingFrames.clear();
+        m_initialized = false;
+    }
+
+    void TransientDescriptorRing::BeginFrame(uint64_t completedFenceValue)
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        // GPU가 끝낸 프레임 구간을 순서대로 한꺼번에 회수
+        while (!m_pendingFrames.empty() && m_pendingFrames.front().fenceValue <= completedFenceValue)
+        {
+            m_tail = m_pendingFrames.front().endPosition;
+            m_pendingFrames.pop_front();
+        }
+
+        m_limit.store(m_tail + m_capacity, std::memory_order_relaxed);
+    }
+
+    void TransientDescriptorRing::EndFrame(uint64_t fenceValue)
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        const uint64_t end = m_head.load(std::memory_order_relaxed);
+        const uint64_t frameStart = m_pendingFrames.empty() ? m_tail : m_pendingFrames.back().endPosition;
+        if (end > frameStart)
+        {
+            m_pendingFrames.push_back({ end, fenceValue });
+        }
+    }
+
+    DescriptorHandle TransientDescriptorRing::Allocate(uint32_t count)
+    {
+        if (!m_initialized || count == 0 || count > m_capacity)
+        {
+            return DescriptorHandle();
+        }
+
+        // 한도를 넘는 할당은 m_head를 움직이지 않고 실패 (CAS, 경합 시에만 재시도)
+        const uint64_t limit = m_limit.load(std::memory_order_relaxed);
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        uint64_t start;
+        do
+        {
+            // 링 끝을 걸치면 남은 꼬리는 버리고(프레임과 함께 회수) 링 처음부터 할당
+            start = head;
+            if (start % m_capacity + count > m_capacity)
+            {
+                start += m_capacity - start % m_capacity;
+            }
+
+            if (start + count > limit)
+            {
+                LOG_WARNING_EVERY_MS(LogCategory::Renderer, 1000,
+                                     L"TransientDescriptorRing is full ({} descriptors, requested {})",
+                                     m_capacity, count);
+                return DescriptorHandle();
+            }
+        } while (!m_head.compare_exchange_weak(head, start + count, std::memory_order_relaxed));
+
+        DescriptorHandle handle;
+        handle.heapIndex = m_base.heapIndex + static_cast<uint32_t>(start % m_capacity);
+        handle.cpuHandle = m_heap->GetCpuHandle(handle.heapIndex);
+        handle.gpuHandle = m_heap->GetGpuHandle(handle.heapIndex);
+        return handle;
+    }
+
+    uint32_t TransientDescriptorRing::GetUsedCount() const
+    {
+        return static_cast<uint32_t>(m_head.load(std::memory_order_relaxed) - m_tail);
+    }
+}
@@ -0,0 +1,108 @@
+/**
+ * @file TransientDescriptorRing.h
+ * @brief 프레임 단위 임시 디스크립터 링 할당자
+ *
+ * 셰이더 가시 CBV/SRV/UAV 힙의 일부 구간을 링 버퍼로 사용합니다.
+ * 드로우마다 만드는 동적 디스크립터 테이블처럼 한 프레임만 쓰는 디스크립터를
+ * 범프 포인터로 연속 할당하고, 프레임 단위로 한꺼번에 회수합니다.
+ *
+ * - Allocate: 원자적 CAS 한 번 (경합 시에만 재시도), 여러 기록 스레드에서 호출 가능
+ *   가득 차서 실패한 할당은 위치를 옮기지 않으므로 다음 할당에 영향이 없음
+ * - EndFrame: 이번 프레임 구간의 끝 위치와 CommandQueue::Signal의 Fence 값을 기록
+ * - BeginFrame: GPU가 완료한 프레임 구간을 개별 해제 없이 한 번에 회수
+ *
+ * BeginFrame/EndFrame은 렌더 스레드에서만, 다른 스레드의 Allocate와 겹치지 않게 호출해야 합니다.
+ */
+
+#pragma once
+
+#include "DescriptorHeap.h"
+#include <atomic>
+#include <deque>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 셰이더 가시 힙 위의 프레임 단위 링 할당자
+     */
+    class TransientDescriptorRing
+    {
+    public:
+        TransientDescriptorRing();
+        ~TransientDescriptorRing();
+
+        // 복사 및 이동 금지
+        TransientDescriptorRing(const TransientDescriptorRing&) = delete;
+        TransientDescriptorRing& operator=(const TransientDescriptorRing&) = delete;
+        TransientDescriptorRing(TransientDescriptorRing&&) = delete;
+        TransientDescriptorRing& operator=(TransientDescriptorRing&&) = delete;
+
+        /**
+         * @brief 힙에서 연속 구간을 예약해 링으로 사용
+         * @param heap 셰이더 가시 CBV/SRV/UAV 힙
+         * @param capacity 링 크기 (디스크립터 개수)
+         * @return 성공 시 true
+         */
+        bool Initialize(DescriptorHeap* heap, uint32_t capacity);
+
+        /**
+         * @brief 예약한 구간을 힙에 반환
+         *
+         * 호출 전에 GPU가 링의 디스크립터를 더 이상 참조하지 않아야 합니다.
+         */
+        void Shutdown();
+
+        /**
+         * @brief 프레임 시작 - 완료된 프레임 구간 회수
+         * @param completedFenceValue GPU가 완료한 Fence 값
+         */
+        void BeginFrame(uint64_t completedFenceValue);
+
+        /**
+         * @brief 프레임 종료 - 이번 프레임 구간을 Fence 값과 함께 기록
+         * @param fenceValue 이번 프레임 제출 후 CommandQueue::Signal이 반환한 값
+         */
+        void EndFrame(uint64_t fenceValue);
+
+        /**
+         * @brief 연속 디스크립터 할당 (스레드 안전)
+         * @param count 디스크립터 개수
+         * @return 첫 디스크립터 핸들 (i번째는 GetCpuHandle/GetGpuHandle(handle.heapIndex + i),
+         *         링이 가득 차면 IsValid() == false)
+         */
+        DescriptorHandle Allocate(uint32_t count);
+
+        /**
+         * @brief 링 크기
+         */
+        uint32_t GetCapacity() const { return m_capacity; }
+
+        /**
+         * @brief 아직 회수되지 않은 디스크립터 수 (진행 중인 프레임 포함, 링 끝 건너뛴 구간 포함)
+         */
+        uint32_t GetUsedCount() const;
+
+    private:
+        /**
+         * @brief 제출된 프레임이 사용한 링 구간
+         */
+        struct FrameSlice
+        {
+            uint64_t endPosition;   // 구간 끝 (누적 위치)
+            uint64_t fenceValue;    // 완료 시 회수 가능한 Fence 값
+        };
+
+    private:
+        DescriptorHeap* m_heap;
+        DescriptorHandle m_base;            // 예약 구간의 첫 디스크립터
+        uint32_t m_capacity;
+
+        // 누적 위치 (실제 오프셋은 % m_capacity), 64비트라 순환하지 않음
+        std::atomic<uint64_t> m_head;       // 다음 할당 위치
+        std::atomic<uint64_t> m_limit;      // 이번 프레임에 할당 가능한 끝 (m_tail + m_capacity)
+        uint64_t m_tail;                    // 회수된 위치 (GPU가 더 이상 사용하지 않음)
+
+        std::deque<FrameSlice> m_pendingFrames;
+        bool m_initialized;
+    };
+}
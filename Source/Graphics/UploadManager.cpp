@@ -0,0 +1,474 @@
+/**
+ * @file UploadManager.cpp
+ * @brief 복사 큐 기반 비동기 업로드 관리자 구현
+ */
+
+#include "UploadManager.h"
+#include <Utils/Logger.h>
+#include <cstring>
+
+namespace DX12GameEngine
+{
+    namespace
+    {
+        // 버퍼 복사는 정렬 제약이 없지만, 4바이트 단위로 맞춰 연속 업로드가 합쳐지기 쉽게 함
+        constexpr uint64_t kBufferStagingAlignment = 4;
+
+        uint64_t AlignUp(uint64_t value, uint64_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+    }
+
+    UploadManager::UploadManager()
+        : m_device(nullptr)
+        , m_initialized(false)
+        , m_batchAllocator(nullptr)
+        , m_batchCopyCount(0)
+        , m_lastSubmittedFenceValue(0)
+        , m_stagingData(nullptr)
+        , m_stagingCapacity(0)
+        , m_stagingHead(0)
+        , m_stagingUsed(0)
+        , m_batchStagingBytes(0)
+        , m_uploadedBytes(0)
+        , m_submittedBatchCount(0)
+        , m_recordedCopyCount(0)
+        , m_coalescedCopyCount(0)
+    {
+    }
+
+    UploadManager::~UploadManager()
+    {
+        Shutdown();
+    }
+
+    bool UploadManager::Initialize(ID3D12Device* device, const UploadManagerDesc& desc)
+    {
+        if (m_initialized)
+        {
+            LOG_WARNING(LogCategory::Renderer, L"UploadManager already initialized");
+            return true;
+        }
+
+        if (!device)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"UploadManager::Initialize - device is null");
+            return false;
+        }
+
+        if (desc.stagingBufferSize == 0)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"UploadManager::Initialize - staging buffer size is 0");
+            return false;
+        }
+
+        m_device = device;
+
+        if (!m_copyQueue.Initialize(device, D3D12_COMMAND_LIST_TYPE_COPY) ||
+            !m_allocatorPool.Initialize(device, D3D12_COMMAND_LIST_TYPE_COPY))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to initialize UploadManager copy queue");
+            return false;
+        }
+
+        // 영구 매핑 스테이징 링 (UPLOAD 힙은 Unmap 없이 계속 써도 됨)
+        D3D12_HEAP_PROPERTIES heapProps = {};
+        heapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
+
+        D3D12_RESOURCE_DESC bufferDesc = {};
+        bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+        bufferDesc.Width = desc.stagingBufferSize;
+        bufferDesc.Height = 1;
+        bufferDesc.DepthOrArraySize = 1;
+        bufferDesc.MipLevels = 1;
+        bufferDesc.Format = DXGI_FORMAT_UNKNOWN;
+        bufferDesc.SampleDesc.Count = 1;
+        bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+        bufferDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+        HRESULT hr = device->CreateCommittedResource(
+            &heapProps,
+            D3D12_HEAP_FLAG_NONE,
+            &bufferDesc,
+            D3D12_RESOURCE_STATE_GENERIC_READ,
+            nullptr,
+            IID_PPV_ARGS(&m_stagingBuffer));
+        if (FAILED(hr))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to create upload staging buffer (HRESULT: {:#x})",
+                      static_cast<uint32_t>(hr));
+            return false;
+        }
+
+        D3D12_RANGE readRange = { 0, 0 };  // 읽기 없음
+        void* mappedData = nullptr;
+        hr = m_stagingBuffer->Map(0, &readRange, &mappedData);
+        if (FAILED(hr))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to map upload staging buffer (HRESULT: {:#x})",
+                      static_cast<uint32_t>(hr));
+            return false;
+        }
+
+        m_stagingData = static_cast<uint8_t*>(mappedData);
+        m_stagingCapacity = desc.stagingBufferSize;
+        m_stagingHead = 0;
+        m_stagingUsed = 0;
+        m_initialized = true;
+
+        LOG_INFO(LogCategory::Renderer, L"UploadManager initialized (staging: {} KB)", m_stagingCapacity / 1024);
+        return true;
+    }
+
+    void UploadManager::Shutdown()
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            FlushLocked();
+        }
+        m_copyQueue.Flush();
+
+        // 완료된 묶음의 Allocator를 풀에 돌려받은 뒤 해제
+        m_allocatorPool.Trim(m_copyQueue.GetCompletedFenceValue(), 0);
+        m_commandList.Reset();
+
+        m_stagingBuffer->Unmap(0, nullptr);
+        m_stagingData = nullptr;
+        m_stagingBuffer.Reset();
+        m_retiredStaging.clear();
+        m_initialized = false;
+
+        LOG_INFO(LogCategory::Renderer, L"UploadManager shut down ({} bytes in {} batches)",
+                 m_uploadedBytes, m_submittedBatchCount);
+    }
+
+    ComPtr<ID3D12Resource> UploadManager::CreateBuffer(const void* data, uint64_t size)
+    {
+        if (!m_initialized)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"UploadManager::CreateBuffer - not initialized");
+            return nullptr;
+        }
+
+        D3D12_HEAP_PROPERTIES heapProps = {};
+        heapProps.Type = D3D12_HEAP_TYPE_DEFAULT;
+
+        D3D12_RESOURCE_DESC bufferDesc = {};
+        bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+        bufferDesc.Width = size;
+        bufferDesc.Height = 1;
+        bufferDesc.DepthOrArraySize = 1;
+        bufferDesc.MipLevels = 1;
+        bufferDesc.Format = DXGI_FORMAT_UNKNOWN;
+        bufferDesc.SampleDesc.Count = 1;
+        bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+        bufferDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+        // COMMON으로 만들어 복사 큐와 그래픽 큐 모두에서 암시적 상태 승격 사용
+        ComPtr<ID3D12Resource> buffer;
+        HRESULT hr = m_device->CreateCommittedResource(
+            &heapProps,
+            D3D12_HEAP_FLAG_NONE,
+            &bufferDesc,
+            D3D12_RESOURCE_STATE_COMMON,
+            nullptr,
+            IID_PPV_ARGS(&buffer));
+        if (FAILED(hr))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to create default heap buffer (HRESULT: {:#x})",
+                      static_cast<uint32_t>(hr));
+            return nullptr;
+        }
+
+        if (data && !UploadBuffer(buffer.Get(), 0, data, size))
+        {
+            return nullptr;
+        }
+        return buffer;
+    }
+
+    bool UploadManager::UploadBuffer(ID3D12Resource* destination, uint64_t destinationOffset,
+                                     const void* data, uint64_t size)
+    {
+        if (!destination || !data || size == 0)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"UploadManager::UploadBuffer - invalid arguments");
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_initialized)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"UploadManager::UploadBuffer - not initialized");
+            return false;
+        }
+
+        uint64_t stagingOffset = 0;
+        if (!AllocateStagingLocked(size, kBufferStagingAlignment, stagingOffset))
+        {
+            return false;
+        }
+        std::memcpy(m_stagingData + stagingOffset, data, static_cast<size_t>(size));
+        m_uploadedBytes += size;
+
+        // 같은 대상의 바로 뒤 구간이고 스테이징도 이어져 있으면 앞 복사에 합침
+        if (!m_pendingBufferCopies.empty())
+        {
+            PendingBufferCopy& last = m_pendingBufferCopies.back();
+            if (last.destination == destination &&
+                last.destinationOffset + last.size == destinationOffset &&
+                last.stagingOffset + last.size == stagingOffset)
+            {
+                last.size += size;
+                m_coalescedCopyCount++;
+                return true;
+            }
+        }
+
+        m_pendingBufferCopies.push_back({ destination, destinationOffset, stagingOffset, size });
+        return true;
+    }
+
+    bool UploadManager::UploadTexture(ID3D12Resource* destination, uint32_t subresource,
+                                      const D3D12_SUBRESOURCE_DATA& data)
+    {
+        if (!destination || !data.pData)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"UploadManager::UploadTexture - invalid arguments");
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_initialized)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"UploadManager::UploadTexture - not initialized");
+            return false;
+        }
+
+        // 행 피치가 256바이트로 정렬된 스테이징 배치 계산
+        const D3D12_RESOURCE_DESC textureDesc = destination->GetDesc();
+        D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint = {};
+        UINT rowCount = 0;
+        UINT64 rowSizeInBytes = 0;
+        UINT64 totalBytes = 0;
+        m_device->GetCopyableFootprints(&textureDesc, subresource, 1, 0,
+                                        &footprint, &rowCount, &rowSizeInBytes, &totalBytes);
+
+        uint64_t stagingOffset = 0;
+        if (!AllocateStagingLocked(totalBytes, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, stagingOffset))
+        {
+            return false;
+        }
+
+        const uint8_t* source = static_cast<const uint8_t*>(data.pData);
+        uint8_t* staging = m_stagingData + stagingOffset;
+        const uint64_t stagingSlicePitch = static_cast<uint64_t>(footprint.Footprint.RowPitch) * rowCount;
+        for (UINT slice = 0; slice < footprint.Footprint.Depth; slice++)
+        {
+            for (UINT row = 0; row < rowCount; row++)
+            {
+                std::memcpy(staging + slice * stagingSlicePitch + row * footprint.Footprint.RowPitch,
+                            source + slice * data.SlicePitch + row * data.RowPitch,
+                            static_cast<size_t>(rowSizeInBytes));
+            }
+        }
+        m_uploadedBytes += rowSizeInBytes * rowCount * footprint.Footprint.Depth;
+
+        ID3D12GraphicsCommandList* commandList = BeginBatchLocked();
+        if (!commandList)
+        {
+            return false;
+        }
+
+        footprint.Offset = stagingOffset;
+
+        D3D12_TEXTURE_COPY_LOCATION destinationLocation = {};
+        destinationLocation.pResource = destination;
+        destinationLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        destinationLocation.SubresourceIndex = subresource;
+
+        D3D12_TEXTURE_COPY_LOCATION sourceLocation = {};
+        sourceLocation.pResource = m_stagingBuffer.Get();
+        sourceLocation.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+        sourceLocation.PlacedFootprint = footprint;
+
+        commandList->CopyTextureRegion(&destinationLocation, 0, 0, 0, &sourceLocation, nullptr);
+        m_batchCopyCount++;
+        m_recordedCopyCount++;
+        return true;
+    }
+
+    uint64_t UploadManager::Flush()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return FlushLocked();
+    }
+
+    uint64_t UploadManager::QueueWait(CommandQueue& queue)
+    {
+        const uint64_t uploadFenceValue = Flush();
+        if (uploadFenceValue == 0 || IsComplete(uploadFenceValue))
+        {
+            // 이미 끝난 업로드는 GPU 대기도 필요 없음
+            return 0;
+        }
+
+        queue.WaitForQueue(m_copyQueue, uploadFenceValue);
+        return uploadFenceValue;
+    }
+
+    uint64_t UploadManager::GetStagingUsedBytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stagingUsed;
+    }
+
+    bool UploadManager::AllocateStagingLocked(uint64_t size, uint64_t alignment, uint64_t& outOffset)
+    {
+        if (size > m_stagingCapacity)
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Upload of {} bytes exceeds staging buffer ({} bytes)",
+                      size, m_stagingCapacity);
+            return false;
+        }
+
+        for (;;)
+        {
+            ReclaimStagingLocked(m_copyQueue.GetCompletedFenceValue());
+
+            // 모두 회수되었으면 처음부터 써서 링 끝 조각을 줄임
+            if (m_stagingUsed == 0)
+            {
+                m_stagingHead = 0;
+            }
+
+            uint64_t offset = AlignUp(m_stagingHead, alignment);
+            uint64_t consumed = offset - m_stagingHead + size;
+            if (offset + size > m_stagingCapacity)
+            {
+                // 링 끝을 건너뛰고 처음부터 (건너뛴 구간도 이번 묶음이 차지한 것으로 셈)
+                offset = 0;
+                consumed = m_stagingCapacity - m_stagingHead + size;
+            }
+
+            if (m_stagingUsed + consumed <= m_stagingCapacity)
+            {
+                m_stagingHead = offset + size;
+                m_stagingUsed += consumed;
+                m_batchStagingBytes += consumed;
+                outOffset = offset;
+                return true;
+            }
+
+            // 공간 부족 - 현재 묶음을 제출하고 가장 오래된 묶음의 완료를 기다림
+            if (m_batchStagingBytes > 0)
+            {
+                FlushLocked();
+            }
+            if (m_retiredStaging.empty())
+            {
+                LOG_ERROR(LogCategory::Renderer, L"UploadManager staging ring exhausted ({} bytes requested)", size);
+                return false;
+            }
+
+            LOG_DEBUG_EVERY_MS(LogCategory::Renderer, 1000,
+                               L"Upload staging ring full, waiting for copy queue (fence: {})",
+                               m_retiredStaging.front().fenceValue);
+            m_copyQueue.WaitForFenceValue(m_retiredStaging.front().fenceValue);
+        }
+    }
+
+    void UploadManager::ReclaimStagingLocked(uint64_t completedFenceValue)
+    {
+        while (!m_retiredStaging.empty() && m_retiredStaging.front().fenceValue <= completedFenceValue)
+        {
+            m_stagingUsed -= m_retiredStaging.front().bytes;
+            m_retiredStaging.pop_front();
+        }
+    }
+
+    ID3D12GraphicsCommandList* UploadManager::BeginBatchLocked()
+    {
+        if (m_batchAllocator)
+        {
+            return m_commandList.Get();
+        }
+
+        ID3D12CommandAllocator* allocator = m_allocatorPool.Acquire(m_copyQueue.GetCompletedFenceValue());
+        if (!allocator)
+        {
+            return nullptr;
+        }
+
+        // CommandList는 하나를 재사용 (제출 직후 Reset 가능, Allocator만 GPU 완료까지 보존)
+        if (!m_commandList)
+        {
+            m_commandList = m_copyQueue.CreateCommandList(m_device, allocator);
+            if (!m_commandList)
+            {
+                m_allocatorPool.Release(allocator, 0, 0);
+                return nullptr;
+            }
+        }
+
+        HRESULT hr = m_commandList->Reset(allocator, nullptr);
+        if (FAILED(hr))
+        {
+            LOG_ERROR(LogCategory::Renderer, L"Failed to reset upload CommandList (HRESULT: {:#x})",
+                      static_cast<uint32_t>(hr));
+            m_allocatorPool.Release(allocator, 0, 0);
+            return nullptr;
+        }
+
+        m_batchAllocator = allocator;
+        return m_commandList.Get();
+    }
+
+    uint64_t UploadManager::FlushLocked()
+    {
+        if (!m_pendingBufferCopies.empty())
+        {
+            ID3D12GraphicsCommandList* commandList = BeginBatchLocked();
+            if (!commandList)
+            {
+                return m_lastSubmittedFenceValue;
+            }
+
+            // 보류한 버퍼 복사를 추가 순서대로 기록 (같은 구간을 다시 올린 경우도 순서 유지)
+            for (const PendingBufferCopy& copy : m_pendingBufferCopies)
+            {
+                commandList->CopyBufferRegion(copy.destination, copy.destinationOffset,
+                                              m_stagingBuffer.Get(), copy.stagingOffset, copy.size);
+            }
+            m_batchCopyCount += static_cast<uint32_t>(m_pendingBufferCopies.size());
+            m_recordedCopyCount += m_pendingBufferCopies.size();
+            m_pendingBufferCopies.clear();
+        }
+
+        if (!m_batchAllocator)
+        {
+            return m_lastSubmittedFenceValue;
+        }
+
+        m_commandList->Close();
+        m_copyQueue.Enqueue(m_commandList.Get(), 0);
+        const uint64_t fenceValue = m_copyQueue.FlushSubmissions();
+
+        m_allocatorPool.Release(m_batchAllocator, fenceValue, m_batchCopyCount);
+        m_batchAllocator = nullptr;
+        m_batchCopyCount = 0;
+
+        m_retiredStaging.push_back({ fenceValue, m_batchStagingBytes });
+        m_batchStagingBytes = 0;
+
+        m_lastSubmittedFenceValue = fenceValue;
+        m_submittedBatchCount++;
+        return fenceValue;
+    }
+}
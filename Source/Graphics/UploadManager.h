@@ -0,0 +1,232 @@
+/**
+ * @file UploadManager.h
+ * @brief 복사 큐 기반 비동기 업로드 관리자
+ *
+ * 전용 COPY 타입 CommandQueue와 영구 매핑된 UPLOAD 힙 스테이징 링을 사용해
+ * 데이터를 DEFAULT 힙(비디오 메모리)으로 옮깁니다.
+ *
+ * - Upload*: 스테이징 링에 복사하고 복사 명령을 현재 묶음에 추가 (연속된 버퍼 복사는 하나로 합침)
+ * - Flush: 쌓인 복사를 복사 큐에 한 번에 제출하고 Fence 값 반환
+ * - QueueWait: 그래픽 큐가 GPU에서 업로드 완료를 기다리도록 예약 (CPU는 블로킹하지 않음)
+ *
+ * 대상 리소스는 COMMON 상태로 만들어 두면 복사 큐에서 COPY_DEST로 암시적 승격되고,
+ * 제출이 끝나면 COMMON으로 돌아가므로 그래픽 큐에서 읽기 상태로 다시 암시적 승격됩니다 (배리어 불필요).
+ *
+ * 스테이징 링은 제출 묶음 단위로 Fence 값을 기록해, 복사 큐가 완료한 구간만 재사용합니다.
+ * 링이 가득 차면 잠금을 쥔 채 복사 큐 Fence 이벤트로 직접 기다립니다
+ * (FenceTimeline을 거치지 않으므로 기다리는 동안 다른 콜백이 이 관리자에 재진입하지 않음).
+ * 모든 메서드는 내부 잠금으로 스레드 안전합니다 (로딩 스레드에서 호출 가능).
+ */
+
+#pragma once
+
+#include "CommandQueue.h"
+#include "CommandAllocatorPool.h"
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief 업로드 관리자 설정
+     */
+    struct UploadManagerDesc
+    {
+        uint64_t stagingBufferSize;     // 스테이징 링 크기 (바이트, 한 번에 올릴 수 있는 최대 크기)
+
+        UploadManagerDesc()
+            : stagingBufferSize(64ull * 1024 * 1024)
+        {
+        }
+    };
+
+    /**
+     * @brief 복사 큐 기반 비동기 업로드 관리자
+     *
+     * 사용 흐름:
+     * 1. CreateBuffer / UploadBuffer / UploadTexture - 로딩 시점에 아무 스레드에서나 호출
+     * 2. 프레임 제출 전 QueueWait(graphicsQueue) - 쌓인 업로드를 제출하고 그래픽 큐에 GPU 대기 예약
+     * 3. 그래픽 큐의 이후 작업에서 대상 리소스 사용
+     */
+    class UploadManager
+    {
+    public:
+        UploadManager();
+        ~UploadManager();
+
+        // 복사 및 이동 금지
+        UploadManager(const UploadManager&) = delete;
+        UploadManager& operator=(const UploadManager&) = delete;
+        UploadManager(UploadManager&&) = delete;
+        UploadManager& operator=(UploadManager&&) = delete;
+
+        /**
+         * @brief 초기화 (복사 큐, 스테이징 링 생성)
+         * @param device D3D12 디바이스
+         * @param desc 업로드 관리자 설정
+         * @return 성공 시 true
+         */
+        bool Initialize(ID3D12Device* device, const UploadManagerDesc& desc = UploadManagerDesc());
+
+        /**
+         * @brief 종료 (쌓인 업로드를 제출하고 복사 큐 완료까지 대기)
+         */
+        void Shutdown();
+
+        /**
+         * @brief DEFAULT 힙 버퍼를 만들고 초기 데이터 업로드 예약
+         * @param data 초기 데이터
+         * @param size 크기 (바이트)
+         * @return 생성된 버퍼 (COMMON 상태, 실패 시 nullptr)
+         */
+        ComPtr<ID3D12Resource> CreateBuffer(const void* data, uint64_t size);
+
+        /**
+         * @brief 버퍼 구간 업로드 예약
+         * @param destination 대상 버퍼 (COMMON 상태)
+         * @param destinationOffset 대상 오프셋 (바이트)
+         * @param data 원본 데이터 (반환 시점에 이미 스테이징에 복사됨)
+         * @param size 크기 (바이트)
+         * @return 성공 시 true (스테이징 링보다 크면 false)
+         */
+        bool UploadBuffer(ID3D12Resource* destination, uint64_t destinationOffset, const void* data, uint64_t size);
+
+        /**
+         * @brief 텍스처 서브리소스 업로드 예약
+         * @param destination 대상 텍스처 (COMMON 상태)
+         * @param subresource 서브리소스 인덱스
+         * @param data 원본 데이터 (pData / RowPitch / SlicePitch)
+         * @return 성공 시 true (스테이징 링보다 크면 false)
+         */
+        bool UploadTexture(ID3D12Resource* destination, uint32_t subresource, const D3D12_SUBRESOURCE_DATA& data);
+
+        /**
+         * @brief 쌓인 복사를 복사 큐에 한 번에 제출
+         * @return 마지막으로 제출한 업로드 묶음의 Fence 값 (쌓인 것이 없으면 이전 값)
+         */
+        uint64_t Flush();
+
+        /**
+         * @brief 쌓인 업로드를 제출하고, queue의 이후 작업이 모든 업로드 완료 뒤에 실행되도록 GPU 대기 예약
+         * @param queue 업로드한 리소스를 사용할 큐 (보통 그래픽 큐)
+         * @return 기다리게 한 업로드 Fence 값 (기다릴 업로드가 없으면 0)
+         */
+        uint64_t QueueWait(CommandQueue& queue);
+
+        /**
+         * @brief 업로드 Fence 값 완료 여부
+         */
+        bool IsComplete(uint64_t uploadFenceValue) const { return m_copyQueue.GetCompletedFenceValue() >= uploadFenceValue; }
+
+        /**
+         * @brief 복사 큐 가져오기
+         */
+        CommandQueue& GetCopyQueue() { return m_copyQueue; }
+
+        /**
+         * @brief 누적 업로드 바이트 수
+         */
+        uint64_t GetUploadedBytes() const { return m_uploadedBytes; }
+
+        /**
+         * @brief 누적 제출 묶음 수
+         */
+        uint64_t GetSubmittedBatchCount() const { return m_submittedBatchCount; }
+
+        /**
+         * @brief 누적 기록한 복사 명령 수 (합쳐진 복사는 하나로 셈)
+         */
+        uint64_t GetRecordedCopyCount() const { return m_recordedCopyCount; }
+
+        /**
+         * @brief 앞 복사와 합쳐져 명령을 아낀 업로드 수
+         */
+        uint64_t GetCoalescedCopyCount() const { return m_coalescedCopyCount; }
+
+        /**
+         * @brief 사용 중인 스테이징 바이트 수 (제출 후 GPU 완료 대기 중 포함)
+         */
+        uint64_t GetStagingUsedBytes() const;
+
+    private:
+        /**
+         * @brief 아직 기록하지 않은 버퍼 복사 (연속 구간을 합치기 위해 Flush까지 보류)
+         */
+        struct PendingBufferCopy
+        {
+            ID3D12Resource* destination;
+            uint64_t destinationOffset;
+            uint64_t stagingOffset;
+            uint64_t size;
+        };
+
+        /**
+         * @brief 제출한 묶음이 차지한 스테이징 바이트
+         */
+        struct RetiredStaging
+        {
+            uint64_t fenceValue;
+            uint64_t bytes;
+        };
+
+        /**
+         * @brief 스테이징 링에서 공간 예약 (부족하면 제출 후 복사 큐 완료를 기다림, m_mutex 잠근 상태)
+         * @param size 크기 (바이트)
+         * @param alignment 정렬 (2의 거듭제곱)
+         * @param outOffset 스테이징 버퍼 내 오프셋
+         * @return 성공 시 true
+         */
+        bool AllocateStagingLocked(uint64_t size, uint64_t alignment, uint64_t& outOffset);
+
+        /**
+         * @brief 복사 큐가 완료한 묶음의 스테이징 회수 (m_mutex 잠근 상태)
+         */
+        void ReclaimStagingLocked(uint64_t completedFenceValue);
+
+        /**
+         * @brief 현재 묶음의 CommandList 준비 (m_mutex 잠근 상태)
+         * @return 기록 가능한 CommandList (실패 시 nullptr)
+         */
+        ID3D12GraphicsCommandList* BeginBatchLocked();
+
+        /**
+         * @brief 현재 묶음 제출 (m_mutex 잠근 상태)
+         */
+        uint64_t FlushLocked();
+
+        ID3D12Device* m_device;
+        bool m_initialized;
+
+        mutable std::mutex m_mutex;
+
+        // 복사 큐와 묶음 기록
+        CommandQueue m_copyQueue;
+        CommandAllocatorPool m_allocatorPool;
+        ComPtr<ID3D12GraphicsCommandList> m_commandList;
+        ID3D12CommandAllocator* m_batchAllocator;       // 현재 묶음의 Allocator (기록 중이 아니면 nullptr)
+        std::vector<PendingBufferCopy> m_pendingBufferCopies;
+        uint32_t m_batchCopyCount;
+        uint64_t m_lastSubmittedFenceValue;
+
+        // 스테이징 링 (영구 매핑)
+        ComPtr<ID3D12Resource> m_stagingBuffer;
+        uint8_t* m_stagingData;
+        uint64_t m_stagingCapacity;
+        uint64_t m_stagingHead;         // 다음 할당 위치
+        uint64_t m_stagingUsed;         // 회수되지 않은 바이트 (링 끝 건너뛴 구간 포함)
+        uint64_t m_batchStagingBytes;   // 현재 묶음이 차지한 바이트
+        std::deque<RetiredStaging> m_retiredStaging;    // Fence 값 순서
+
+        // 통계
+        uint64_t m_uploadedBytes;
+        uint64_t m_submittedBatchCount;
+        uint64_t m_recordedCopyCount;
+        uint64_t m_coalescedCopyCount;
+    };
+}
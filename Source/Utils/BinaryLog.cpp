@@ -0,0 +1,653 @@
+/**
+ * @file BinaryLog.cpp
+ * @brief 지연 포맷(바이너리) 로그 레코드 인코딩/디코딩 구현
+ */
+
+#include "BinaryLog.h"
+#include <charconv>
+#include <chrono>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <mutex>
+
+namespace DX12GameEngine
+{
+    namespace
+    {
+        constexpr uint32_t kRegistryChunkSize = 256;
+        constexpr uint32_t kRegistryMaxChunks = 64;    // 최대 16384개 호출 지점
+
+        /**
+         * @brief 포맷 레지스트리 저장소
+         *
+         * Logger 싱글톤 소멸자(writer 스레드의 마지막 drain)에서도 조회되므로
+         * 정적 객체 소멸 순서 문제를 피하기 위해 해제하지 않습니다.
+         */
+        struct LogFormatRegistryStorage
+        {
+            std::mutex mutex;
+            std::atomic<LogFormatInfo*> chunks[kRegistryMaxChunks] = {};
+            uint32_t count = 0;
+        };
+
+        LogFormatRegistryStorage& GetRegistryStorage()
+        {
+            static LogFormatRegistryStorage* storage = new LogFormatRegistryStorage();
+            return *storage;
+        }
+
+        template<typename T>
+        void AppendValue(std::vector<uint8_t>& output, const T& value)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+            output.insert(output.end(), bytes, bytes + sizeof(T));
+        }
+
+        void AppendBytes(std::vector<uint8_t>& output, const void* data, size_t size)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            output.insert(output.end(), bytes, bytes + size);
+        }
+
+        template<typename T>
+        bool ReadArg(const uint8_t*& cursor, const uint8_t* end, T& value)
+        {
+            if (static_cast<size_t>(end - cursor) < sizeof(T))
+            {
+                return false;
+            }
+            std::memcpy(&value, cursor, sizeof(T));
+            cursor += sizeof(T);
+            return true;
+        }
+
+        /**
+         * @brief 단일 인자를 치환 필드 형식(fieldFormat, 예: L"{:#x}")으로 포맷
+         */
+        void FormatLogArg(const LogArgValue& value, std::wstring_view fieldFormat, std::wstring& output)
+        {
+            auto out = std::back_inserter(output);
+
+            try
+            {
+                switch (value.type)
+                {
+                case LogArgType::Int32:
+                case LogArgType::Int64:
+                {
+                    long long v = value.i64;
+                    std::vformat_to(out, fieldFormat, std::make_wformat_args(v));
+                    break;
+                }
+                case LogArgType::UInt32:
+                case LogArgType::UInt64:
+                {
+                    unsigned long long v = value.u64;
+                    std::vformat_to(out, fieldFormat, std::make_wformat_args(v));
+                    break;
+                }
+                case LogArgType::Float:
+                {
+                    float v = value.f32;
+                    std::vformat_to(out, fieldFormat, std::make_wformat_args(v));
+                    break;
+                }
+                case LogArgType::Double:
+                {
+                    double v = value.f64;
+                    std::vformat_to(out, fieldFormat, std::make_wformat_args(v));
+                    break;
+                }
+                case LogArgType::Bool:
+                {
+                    bool v = value.b;
+                    std::vformat_to(out, fieldFormat, std::make_wformat_args(v));
+                    break;
+                }
+                case LogArgType::Char:
+                {
+                    wchar_t v = value.c;
+                    std::vformat_to(out, fieldFormat, std::make_wformat_args(v));
+                    break;
+                }
+                case LogArgType::String:
+                {
+                    std::wstring_view v = value.str;
+                    std::vformat_to(out, fieldFormat, std::make_wformat_args(v));
+                    break;
+                }
+                case LogArgType::Pointer:
+                {
+                    const void* v = reinterpret_cast<const void*>(static_cast<uintptr_t>(value.u64));
+                    std::vformat_to(out, fieldFormat, std::make_wformat_args(v));
+                    break;
+                }
+                default:
+                    output += L"{?}";
+                    break;
+                }
+            }
+            catch (const std::format_error&)
+            {
+                output += L"{!}";
+            }
+        }
+
+        /**
+         * @brief 치환 필드의 인자 인덱스 해석 (비어 있으면 자동 인덱스)
+         * @return 숫자가 아닌 문자가 있거나 인자 범위를 벗어나면 false
+         */
+        bool ParseArgIndex(std::wstring_view indexPart, uint32_t argCount, uint32_t& nextAutoIndex, uint32_t& outIndex)
+        {
+            if (indexPart.empty())
+            {
+                outIndex = nextAutoIndex++;
+                return outIndex < argCount;
+            }
+
+            uint32_t index = 0;
+            for (wchar_t digit : indexPart)
+            {
+                if (digit < L'0' || digit > L'9')
+                {
+                    return false;
+                }
+
+                // 자릿수가 늘면 값이 줄지 않으므로 범위를 넘는 즉시 중단 (오버플로 방지)
+                index = index * 10 + static_cast<uint32_t>(digit - L'0');
+                if (index >= argCount)
+                {
+                    return false;
+                }
+            }
+
+            outIndex = index;
+            return true;
+        }
+
+        /**
+         * @brief 단일 인자용 포맷 문자열 "{:spec}" 구성
+         *
+         * 스펙 안의 중첩 치환 필드({}, {n}, 동적 너비 / 정밀도)는 참조하는 정수 인자 값으로 바꿉니다.
+         * 예: 스펙 L":{}" + 인자 8 -> L"{:8}"
+         * @return 중첩 필드가 잘못되었거나 음수가 아닌 정수 인자가 아니거나 버퍼를 넘으면 false
+         */
+        bool BuildFieldFormat(std::wstring_view spec, const LogArgValue* args, uint32_t argCount,
+                              uint32_t& nextAutoIndex, wchar_t* output, size_t capacity, size_t& outLength)
+        {
+            size_t length = 0;
+            output[length++] = L'{';
+
+            size_t i = 0;
+            while (i < spec.size())
+            {
+                if (spec[i] != L'{')
+                {
+                    if (length + 1 >= capacity)
+                    {
+                        return false;
+                    }
+                    output[length++] = spec[i++];
+                    continue;
+                }
+
+                const size_t close = spec.find(L'}', i + 1);
+                if (close == std::wstring_view::npos)
+                {
+                    return false;
+                }
+
+                uint32_t argIndex = 0;
+                if (!ParseArgIndex(spec.substr(i + 1, close - i - 1), argCount, nextAutoIndex, argIndex))
+                {
+                    return false;
+                }
+
+                const LogArgValue& value = args[argIndex];
+                uint64_t number = 0;
+                switch (value.type)
+                {
+                case LogArgType::Int32:
+                case LogArgType::Int64:
+                    if (value.i64 < 0)
+                    {
+                        return false;
+                    }
+                    number = static_cast<uint64_t>(value.i64);
+                    break;
+                case LogArgType::UInt32:
+                case LogArgType::UInt64:
+                    number = value.u64;
+                    break;
+                default:
+                    return false;
+                }
+
+                char digits[24];
+                const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), number);
+                for (const char* digit = digits; digit != result.ptr; digit++)
+                {
+                    if (length + 1 >= capacity)
+                    {
+                        return false;
+                    }
+                    output[length++] = static_cast<wchar_t>(*digit);
+                }
+
+                i = close + 1;
+            }
+
+            output[length++] = L'}';
+            outLength = length;
+            return true;
+        }
+    }
+
+    uint32_t LogFormatRegistry::Register(LogFormatSite& site, std::wstring_view format,
+                                         const LogArgType* argTypes, uint32_t argCount)
+    {
+        if (argCount > kMaxLogArgs)
+        {
+            return kInvalidLogFormatId;
+        }
+
+        LogFormatRegistryStorage& storage = GetRegistryStorage();
+        std::lock_guard<std::mutex> lock(storage.mutex);
+
+        // 다른 스레드가 먼저 등록했을 수 있음
+        uint32_t id = site.m_id.load(std::memory_order_relaxed);
+        if (id != kInvalidLogFormatId)
+        {
+            return id;
+        }
+
+        if (storage.count >= kRegistryChunkSize * kRegistryMaxChunks)
+        {
+            return kInvalidLogFormatId;
+        }
+
+        const uint32_t chunkIndex = storage.count / kRegistryChunkSize;
+        LogFormatInfo* chunk = storage.chunks[chunkIndex].load(std::memory_order_relaxed);
+        if (!chunk)
+        {
+            chunk = new LogFormatInfo[kRegistryChunkSize];
+            storage.chunks[chunkIndex].store(chunk, std::memory_order_release);
+        }
+
+        LogFormatInfo& info = chunk[storage.count % kRegistryChunkSize];
+        info.format = format;
+        info.argCount = argCount;
+        std::memcpy(info.argTypes, argTypes, argCount * sizeof(LogArgType));
+
+        id = ++storage.count;
+
+        // 등록 정보 쓰기 이후에 ID 공개
+        site.m_id.store(id, std::memory_order_release);
+        return id;
+    }
+
+    const LogFormatInfo* LogFormatRegistry::Find(uint32_t id)
+    {
+        if (id == kInvalidLogFormatId || id > kRegistryChunkSize * kRegistryMaxChunks)
+        {
+            return nullptr;
+        }
+
+        const uint32_t index = id - 1;
+        LogFormatInfo* chunk = GetRegistryStorage().chunks[index / kRegistryChunkSize].load(std::memory_order_acquire);
+        return chunk ? &chunk[index % kRegistryChunkSize] : nullptr;
+    }
+
+    bool DecodeLogArgs(const LogArgType* argTypes, uint32_t argCount,
+                       const uint8_t* data, size_t size, LogArgValue* outValues)
+    {
+        const uint8_t* cursor = data;
+        const uint8_t* end = data + size;
+
+        for (uint32_t i = 0; i < argCount; i++)
+        {
+            LogArgValue& value = outValues[i];
+            value.type = argTypes[i];
+            value.u64 = 0;
+            value.str = {};
+
+            bool ok = false;
+            switch (value.type)
+            {
+            case LogArgType::Int32:
+            {
+                int32_t v;
+                ok = ReadArg(cursor, end, v);
+                value.i64 = v;
+                break;
+            }
+            case LogArgType::UInt32:
+            {
+                uint32_t v;
+                ok = ReadArg(cursor, end, v);
+                value.u64 = v;
+                break;
+            }
+            case LogArgType::Int64:
+                ok = ReadArg(cursor, end, value.i64);
+                break;
+            case LogArgType::UInt64:
+            case LogArgType::Pointer:
+                ok = ReadArg(cursor, end, value.u64);
+                break;
+            case LogArgType::Float:
+                ok = ReadArg(cursor, end, value.f32);
+                break;
+            case LogArgType::Double:
+                ok = ReadArg(cursor, end, value.f64);
+                break;
+            case LogArgType::Bool:
+            {
+                uint32_t v;
+                ok = ReadArg(cursor, end, v);
+                value.b = v != 0;
+                break;
+            }
+            case LogArgType::Char:
+                ok = ReadArg(cursor, end, value.c);
+                break;
+            case LogArgType::String:
+            {
+                uint32_t length;
+                ok = ReadArg(cursor, end, length) &&
+                     static_cast<size_t>(end - cursor) >= length * sizeof(wchar_t);
+                if (ok)
+                {
+                    value.str = std::wstring_view(reinterpret_cast<const wchar_t*>(cursor), length);
+                    cursor += length * sizeof(wchar_t);
+                }
+                break;
+            }
+            default:
+                break;
+            }
+
+            if (!ok)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void FormatLogArgs(std::wstring_view format, const LogArgValue* args, uint32_t argCount,
+                       std::wstring& output)
+    {
+        uint32_t nextAutoIndex = 0;
+        size_t i = 0;
+
+        while (i < format.size())
+        {
+            const wchar_t c = format[i];
+
+            if (c == L'}')
+            {
+                // "}}" 이스케이프
+                output += L'}';
+                i += (i + 1 < format.size() && format[i + 1] == L'}') ? 2 : 1;
+                continue;
+            }
+
+            if (c != L'{')
+            {
+                output += c;
+                i++;
+                continue;
+            }
+
+            // "{{" 이스케이프
+            if (i + 1 < format.size() && format[i + 1] == L'{')
+            {
+                output += L'{';
+                i += 2;
+                continue;
+            }
+
+            // 중첩 치환 필드(예: {:{}})를 건너뛰도록 짝이 맞는 '}'를 찾음
+            size_t close = i + 1;
+            uint32_t depth = 1;
+            for (; close < format.size(); close++)
+            {
+                if (format[close] == L'{')
+                {
+                    depth++;
+                }
+                else if (format[close] == L'}' && --depth == 0)
+                {
+                    break;
+                }
+            }
+
+            if (close >= format.size())
+            {
+                output.append(format.substr(i));
+                break;
+            }
+
+            // 치환 필드: {인덱스:스펙}
+            const std::wstring_view field = format.substr(i + 1, close - i - 1);
+            const size_t colon = field.find(L':');
+            const std::wstring_view indexPart = field.substr(0, colon);
+            const std::wstring_view specPart = colon == std::wstring_view::npos ? std::wstring_view() : field.substr(colon);
+
+            // 단일 인자용 포맷 문자열 "{:spec}" 구성 (스택 버퍼)
+            wchar_t fieldFormat[64];
+            size_t fieldLength = 0;
+            uint32_t argIndex = 0;
+            if (ParseArgIndex(indexPart, argCount, nextAutoIndex, argIndex) &&
+                BuildFieldFormat(specPart, args, argCount, nextAutoIndex, fieldFormat, std::size(fieldFormat), fieldLength))
+            {
+                FormatLogArg(args[argIndex], std::wstring_view(fieldFormat, fieldLength), output);
+            }
+            else
+            {
+                output += L"{?}";
+            }
+
+            i = close + 1;
+        }
+    }
+
+    void FormatDeferredLogMessage(const LogFormatInfo& info, const uint8_t* data, size_t size,
+                                  std::wstring& output)
+    {
+        LogArgValue values[kMaxLogArgs];
+        if (!DecodeLogArgs(info.argTypes, info.argCount, data, size, values))
+        {
+            output += L"<corrupted log record: ";
+            output += info.format;
+            output += L">";
+            return;
+        }
+
+        FormatLogArgs(info.format, values, info.argCount, output);
+    }
+
+    // =========================================================================
+    // BinaryLogWriter
+    // =========================================================================
+
+    void BinaryLogWriter::AppendFileHeader(std::vector<uint8_t>& output)
+    {
+        BinaryLogFileHeader header = {};
+        std::memcpy(header.magic, kBinaryLogMagic, sizeof(header.magic));
+        header.version = kBinaryLogVersion;
+        header.wcharSize = sizeof(wchar_t);
+        header.clockPeriodNum = std::chrono::system_clock::period::num;
+        header.clockPeriodDen = std::chrono::system_clock::period::den;
+        AppendValue(output, header);
+    }
+
+    void BinaryLogWriter::AppendFormatDefinition(std::vector<uint8_t>& output, uint32_t formatId,
+                                                 const LogFormatInfo& info)
+    {
+        AppendValue(output, BinaryLogEntryType::FormatDefinition);
+        AppendValue(output, formatId);
+        AppendValue(output, static_cast<uint8_t>(info.argCount));
+        AppendBytes(output, info.argTypes, info.argCount * sizeof(LogArgType));
+        AppendValue(output, static_cast<uint32_t>(info.format.size()));
+        AppendBytes(output, info.format.data(), info.format.size() * sizeof(wchar_t));
+    }
+
+    void BinaryLogWriter::AppendMessage(std::vector<uint8_t>& output, LogLevel level, LogCategory category,
+                                        int64_t timestamp, uint32_t formatId, const uint8_t* args, uint32_t size)
+    {
+        AppendValue(output, BinaryLogEntryType::Message);
+        AppendValue(output, level);
+        AppendValue(output, category);
+        AppendValue(output, timestamp);
+        AppendValue(output, formatId);
+        AppendValue(output, size);
+        AppendBytes(output, args, size);
+    }
+
+    void BinaryLogWriter::AppendText(std::vector<uint8_t>& output, LogLevel level, LogCategory category,
+                                     int64_t timestamp, std::wstring_view text)
+    {
+        AppendValue(output, BinaryLogEntryType::Text);
+        AppendValue(output, level);
+        AppendValue(output, category);
+        AppendValue(output, timestamp);
+        AppendValue(output, static_cast<uint32_t>(text.size()));
+        AppendBytes(output, text.data(), text.size() * sizeof(wchar_t));
+    }
+
+    // =========================================================================
+    // BinaryLogReader
+    // =========================================================================
+
+    bool BinaryLogReader::Open(const uint8_t* data, size_t size)
+    {
+        m_cursor = data;
+        m_end = data + size;
+        m_formats.clear();
+
+        if (!Read(&m_header, sizeof(m_header)))
+        {
+            return false;
+        }
+
+        if (std::memcmp(m_header.magic, kBinaryLogMagic, sizeof(kBinaryLogMagic)) != 0 ||
+            m_header.version != kBinaryLogVersion)
+        {
+            return false;
+        }
+
+        // 기록한 플랫폼과 wchar_t 크기가 다르면 문자열을 해석할 수 없음
+        return m_header.wcharSize == sizeof(wchar_t);
+    }
+
+    bool BinaryLogReader::Read(void* dst, size_t size)
+    {
+        if (static_cast<size_t>(m_end - m_cursor) < size)
+        {
+            return false;
+        }
+        std::memcpy(dst, m_cursor, size);
+        m_cursor += size;
+        return true;
+    }
+
+    bool BinaryLogReader::Next(DecodedLogEntry& entry)
+    {
+        for (;;)
+        {
+            BinaryLogEntryType type;
+            if (!Read(&type, sizeof(type)))
+            {
+                return false;
+            }
+
+            switch (type)
+            {
+            case BinaryLogEntryType::FormatDefinition:
+            {
+                uint32_t formatId;
+                uint8_t argCount;
+                if (!Read(&formatId, sizeof(formatId)) || !Read(&argCount, sizeof(argCount)) ||
+                    argCount > kMaxLogArgs)
+                {
+                    return false;
+                }
+
+                FormatDefinition definition;
+                definition.argTypes.resize(argCount);
+                uint32_t length;
+                if (!Read(definition.argTypes.data(), argCount * sizeof(LogArgType)) ||
+                    !Read(&length, sizeof(length)))
+                {
+                    return false;
+                }
+
+                definition.format.resize(length);
+                if (!Read(definition.format.data(), length * sizeof(wchar_t)))
+                {
+                    return false;
+                }
+
+                m_formats[formatId] = std::move(definition);
+                continue;
+            }
+
+            case BinaryLogEntryType::Message:
+            {
+                uint32_t formatId;
+                uint32_t size;
+                if (!Read(&entry.level, sizeof(entry.level)) || !Read(&entry.category, sizeof(entry.category)) ||
+                    !Read(&entry.timestamp, sizeof(entry.timestamp)) || !Read(&formatId, sizeof(formatId)) ||
+                    !Read(&size, sizeof(size)) || static_cast<size_t>(m_end - m_cursor) < size)
+                {
+                    return false;
+                }
+
+                const uint8_t* args = m_cursor;
+                m_cursor += size;
+
+                entry.message.clear();
+                auto it = m_formats.find(formatId);
+                if (it == m_formats.end())
+                {
+                    entry.message = std::format(L"<unknown format id {}>", formatId);
+                    return true;
+                }
+
+                const FormatDefinition& definition = it->second;
+                const uint32_t argCount = static_cast<uint32_t>(definition.argTypes.size());
+                LogArgValue values[kMaxLogArgs];
+                if (!DecodeLogArgs(definition.argTypes.data(), argCount, args, size, values))
+                {
+                    entry.message = L"<corrupted log record: " + definition.format + L">";
+                    return true;
+                }
+
+                FormatLogArgs(definition.format, values, argCount, entry.message);
+                return true;
+            }
+
+            case BinaryLogEntryType::Text:
+            {
+                uint32_t length;
+                if (!Read(&entry.level, sizeof(entry.level)) || !Read(&entry.category, sizeof(entry.category)) ||
+                    !Read(&entry.timestamp, sizeof(entry.timestamp)) || !Read(&length, sizeof(length)))
+                {
+                    return false;
+                }
+
+                entry.message.resize(length);
+                return Read(entry.message.data(), length * sizeof(wchar_t));
+            }
+
+            default:
+                // 손상된 파일
+                return false;
+            }
+        }
+    }
+}
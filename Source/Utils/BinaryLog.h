@@ -0,0 +1,410 @@
+/**
+ * @file BinaryLog.h
+ * @brief 지연 포맷(바이너리) 로그 레코드 인코딩/디코딩
+ *
+ * 호출 지점에서는 포맷 문자열 ID와 인자의 원시 바이트만 캡처하고,
+ * 실제 문자열 포맷팅은 writer 스레드 또는 오프라인 디코더(LogDecoder)에서 수행합니다.
+ * Windows/DirectX 의존성이 없어 디코더 도구에서도 그대로 사용합니다.
+ */
+
+#pragma once
+
+#include "LogTypes.h"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 바이너리로 인코딩된 로그 인자 타입
+     */
+    enum class LogArgType : uint8_t
+    {
+        Int32,
+        UInt32,
+        Int64,
+        UInt64,
+        Float,
+        Double,
+        Bool,
+        Char,       // wchar_t
+        String,     // uint32 길이 + wchar_t 배열
+        Pointer
+    };
+
+    /** @brief 한 포맷 문자열이 가질 수 있는 최대 지연 인자 수 */
+    static constexpr uint32_t kMaxLogArgs = 16;
+
+    /** @brief 등록되지 않은 포맷 ID (유효 ID는 1부터 시작) */
+    static constexpr uint32_t kInvalidLogFormatId = 0;
+
+    /**
+     * @brief 인자 타입별 인코딩 규칙
+     *
+     * kDeferrable == false인 타입이 하나라도 있으면 호출 지점에서 즉시 포맷합니다.
+     */
+    template<typename T>
+    struct LogArgTraits
+    {
+        static constexpr bool kDeferrable = false;
+    };
+
+    namespace Detail
+    {
+        template<typename T>
+        inline uint8_t* WriteLogArgBytes(uint8_t* dst, const T& value)
+        {
+            std::memcpy(dst, &value, sizeof(T));
+            return dst + sizeof(T);
+        }
+
+        template<typename T>
+        constexpr bool kIsCharType = std::is_same_v<T, char> || std::is_same_v<T, wchar_t> ||
+                                     std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> ||
+                                     std::is_same_v<T, char32_t>;
+    }
+
+    // 정수 (bool, 문자 타입 제외)
+    template<typename T>
+        requires (std::is_integral_v<T> && !std::is_same_v<T, bool> && !Detail::kIsCharType<T>)
+    struct LogArgTraits<T>
+    {
+        static constexpr bool kDeferrable = true;
+        static constexpr bool kIs64Bit = sizeof(T) > 4;
+        static constexpr LogArgType kType = std::is_signed_v<T>
+            ? (kIs64Bit ? LogArgType::Int64 : LogArgType::Int32)
+            : (kIs64Bit ? LogArgType::UInt64 : LogArgType::UInt32);
+
+        using StorageType = std::conditional_t<std::is_signed_v<T>,
+            std::conditional_t<kIs64Bit, int64_t, int32_t>,
+            std::conditional_t<kIs64Bit, uint64_t, uint32_t>>;
+
+        static size_t GetEncodedSize(T) { return sizeof(StorageType); }
+        static uint8_t* Encode(uint8_t* dst, T value) { return Detail::WriteLogArgBytes(dst, static_cast<StorageType>(value)); }
+    };
+
+    template<>
+    struct LogArgTraits<float>
+    {
+        static constexpr bool kDeferrable = true;
+        static constexpr LogArgType kType = LogArgType::Float;
+        static size_t GetEncodedSize(float) { return sizeof(float); }
+        static uint8_t* Encode(uint8_t* dst, float value) { return Detail::WriteLogArgBytes(dst, value); }
+    };
+
+    template<>
+    struct LogArgTraits<double>
+    {
+        static constexpr bool kDeferrable = true;
+        static constexpr LogArgType kType = LogArgType::Double;
+        static size_t GetEncodedSize(double) { return sizeof(double); }
+        static uint8_t* Encode(uint8_t* dst, double value) { return Detail::WriteLogArgBytes(dst, value); }
+    };
+
+    template<>
+    struct LogArgTraits<bool>
+    {
+        static constexpr bool kDeferrable = true;
+        static constexpr LogArgType kType = LogArgType::Bool;
+        // 4바이트로 저장해 뒤따르는 문자열의 wchar_t 정렬을 유지
+        static size_t GetEncodedSize(bool) { return sizeof(uint32_t); }
+        static uint8_t* Encode(uint8_t* dst, bool value) { return Detail::WriteLogArgBytes(dst, static_cast<uint32_t>(value)); }
+    };
+
+    template<>
+    struct LogArgTraits<wchar_t>
+    {
+        static constexpr bool kDeferrable = true;
+        static constexpr LogArgType kType = LogArgType::Char;
+        static size_t GetEncodedSize(wchar_t) { return sizeof(wchar_t); }
+        static uint8_t* Encode(uint8_t* dst, wchar_t value) { return Detail::WriteLogArgBytes(dst, value); }
+    };
+
+    // 문자열 (내용을 복사하므로 호출 후 원본이 사라져도 안전)
+    template<>
+    struct LogArgTraits<std::wstring_view>
+    {
+        static constexpr bool kDeferrable = true;
+        static constexpr LogArgType kType = LogArgType::String;
+
+        static size_t GetEncodedSize(std::wstring_view value)
+        {
+            return sizeof(uint32_t) + value.size() * sizeof(wchar_t);
+        }
+
+        static uint8_t* Encode(uint8_t* dst, std::wstring_view value)
+        {
+            dst = Detail::WriteLogArgBytes(dst, static_cast<uint32_t>(value.size()));
+            std::memcpy(dst, value.data(), value.size() * sizeof(wchar_t));
+            return dst + value.size() * sizeof(wchar_t);
+        }
+    };
+
+    template<>
+    struct LogArgTraits<std::wstring> : LogArgTraits<std::wstring_view> {};
+
+    template<>
+    struct LogArgTraits<const wchar_t*>
+    {
+        static constexpr bool kDeferrable = true;
+        static constexpr LogArgType kType = LogArgType::String;
+
+        static std::wstring_view ToView(const wchar_t* value)
+        {
+            return value ? std::wstring_view(value) : std::wstring_view();
+        }
+
+        static size_t GetEncodedSize(const wchar_t* value) { return LogArgTraits<std::wstring_view>::GetEncodedSize(ToView(value)); }
+        static uint8_t* Encode(uint8_t* dst, const wchar_t* value) { return LogArgTraits<std::wstring_view>::Encode(dst, ToView(value)); }
+    };
+
+    template<>
+    struct LogArgTraits<wchar_t*> : LogArgTraits<const wchar_t*> {};
+
+    // 포인터 (std::format이 지원하는 void 포인터만)
+    template<>
+    struct LogArgTraits<const void*>
+    {
+        static constexpr bool kDeferrable = true;
+        static constexpr LogArgType kType = LogArgType::Pointer;
+        static size_t GetEncodedSize(const void*) { return sizeof(uint64_t); }
+        static uint8_t* Encode(uint8_t* dst, const void* value)
+        {
+            return Detail::WriteLogArgBytes(dst, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+        }
+    };
+
+    template<>
+    struct LogArgTraits<void*> : LogArgTraits<const void*> {};
+
+    /**
+     * @brief 인자 목록 전체가 지연 포맷 가능한지 여부
+     */
+    template<typename... Args>
+    constexpr bool kAreLogArgsDeferrable =
+        sizeof...(Args) <= kMaxLogArgs && (LogArgTraits<std::decay_t<Args>>::kDeferrable && ...);
+
+    /**
+     * @brief 인코딩된 인자 크기 계산
+     */
+    template<typename... Args>
+    size_t GetEncodedLogArgsSize(const Args&... args)
+    {
+        return (size_t{ 0 } + ... + LogArgTraits<std::decay_t<Args>>::GetEncodedSize(args));
+    }
+
+    /**
+     * @brief 인자를 바이트 배열로 인코딩 (dst는 GetEncodedLogArgsSize() 이상이어야 함)
+     */
+    template<typename... Args>
+    void EncodeLogArgs(uint8_t* dst, const Args&... args)
+    {
+        ((dst = LogArgTraits<std::decay_t<Args>>::Encode(dst, args)), ...);
+    }
+
+    /**
+     * @brief 호출 지점(LOG_* 매크로)마다 하나씩 존재하는 포맷 문자열 식별자
+     *
+     * 함수 내부 static으로 선언되며 상수 초기화되므로 호출 비용이 없습니다.
+     * 첫 지연 포맷 호출 시 LogFormatRegistry에 등록되어 ID를 얻습니다.
+     */
+    class LogFormatSite
+    {
+    public:
+        constexpr LogFormatSite() = default;
+
+        uint32_t GetId() const { return m_id.load(std::memory_order_acquire); }
+
+    private:
+        friend class LogFormatRegistry;
+        std::atomic<uint32_t> m_id{ kInvalidLogFormatId };
+    };
+
+    /**
+     * @brief 등록된 포맷 문자열 정보
+     */
+    struct LogFormatInfo
+    {
+        std::wstring_view format;           // 정적 수명의 포맷 문자열 리터럴
+        LogArgType argTypes[kMaxLogArgs];
+        uint32_t argCount;
+    };
+
+    /**
+     * @brief 포맷 문자열 ID 레지스트리 (프로세스 전역)
+     *
+     * 등록은 호출 지점당 한 번만 락을 잡고, 조회는 락 없이 수행합니다.
+     */
+    class LogFormatRegistry
+    {
+    public:
+        /**
+         * @brief 호출 지점 등록
+         * @return 포맷 ID (등록 한도 초과 시 kInvalidLogFormatId)
+         */
+        static uint32_t Register(LogFormatSite& site, std::wstring_view format,
+                                 const LogArgType* argTypes, uint32_t argCount);
+
+        /**
+         * @brief 포맷 ID로 정보 조회
+         * @return 등록 정보 (없으면 nullptr)
+         */
+        static const LogFormatInfo* Find(uint32_t id);
+    };
+
+    /**
+     * @brief 디코딩된 로그 인자 값
+     */
+    struct LogArgValue
+    {
+        LogArgType type;
+        union
+        {
+            int64_t i64;
+            uint64_t u64;
+            float f32;
+            double f64;
+            bool b;
+            wchar_t c;
+        };
+        std::wstring_view str;  // String 타입일 때 원본 바이트를 가리킴
+    };
+
+    /**
+     * @brief 인코딩된 인자 디코딩
+     * @param argTypes 인자 타입 배열
+     * @param argCount 인자 수
+     * @param data 인코딩된 바이트
+     * @param size 바이트 크기
+     * @param outValues 결과 배열 (argCount 이상)
+     * @return 데이터가 손상되지 않았으면 true
+     */
+    bool DecodeLogArgs(const LogArgType* argTypes, uint32_t argCount,
+                       const uint8_t* data, size_t size, LogArgValue* outValues);
+
+    /**
+     * @brief std::format 규칙으로 포맷 문자열에 디코딩된 인자를 적용 (결과를 output 뒤에 추가)
+     *
+     * {}, {n}, {:spec}, {n:spec} 치환 필드와 {{, }} 이스케이프를 지원합니다.
+     * 스펙 안의 중첩 필드({:{}}, {:.{}})는 정수 인자로 동적 너비 / 정밀도를 지정합니다.
+     * 인덱스가 숫자가 아니거나 범위를 벗어나면 {?}를 출력합니다.
+     */
+    void FormatLogArgs(std::wstring_view format, const LogArgValue* args, uint32_t argCount,
+                       std::wstring& output);
+
+    /**
+     * @brief 지연 포맷 레코드를 문자열로 변환 (결과를 output 뒤에 추가)
+     */
+    void FormatDeferredLogMessage(const LogFormatInfo& info, const uint8_t* data, size_t size,
+                                  std::wstring& output);
+
+    // =========================================================================
+    // 바이너리 로그 파일 (.blog)
+    // =========================================================================
+
+    /**
+     * @brief 바이너리 로그 파일 엔트리 타입
+     *
+     * 파일 레이아웃: [BinaryLogFileHeader][엔트리...]
+     * - FormatDefinition: u8 type, u32 id, u8 argCount, u8 argTypes[], u32 length, wchar_t format[]
+     * - Message:          u8 type, u8 level, u8 category, i64 timestamp, u32 formatId, u32 size, u8 args[]
+     * - Text:             u8 type, u8 level, u8 category, i64 timestamp, u32 length, wchar_t text[]
+     */
+    enum class BinaryLogEntryType : uint8_t
+    {
+        FormatDefinition = 1,
+        Message = 2,
+        Text = 3
+    };
+
+    /**
+     * @brief 바이너리 로그 파일 헤더
+     */
+    struct BinaryLogFileHeader
+    {
+        char magic[8];              // "DX12BLG"
+        uint32_t version;
+        uint32_t wcharSize;         // 기록한 플랫폼의 sizeof(wchar_t)
+        int64_t clockPeriodNum;     // 타임스탬프 틱 단위 (system_clock::period)
+        int64_t clockPeriodDen;
+    };
+
+    static constexpr char kBinaryLogMagic[8] = { 'D', 'X', '1', '2', 'B', 'L', 'G', '\0' };
+    static constexpr uint32_t kBinaryLogVersion = 1;
+
+    /**
+     * @brief 바이너리 로그 엔트리 직렬화
+     */
+    class BinaryLogWriter
+    {
+    public:
+        static void AppendFileHeader(std::vector<uint8_t>& output);
+
+        static void AppendFormatDefinition(std::vector<uint8_t>& output, uint32_t formatId,
+                                           const LogFormatInfo& info);
+
+        static void AppendMessage(std::vector<uint8_t>& output, LogLevel level, LogCategory category,
+                                  int64_t timestamp, uint32_t formatId, const uint8_t* args, uint32_t size);
+
+        static void AppendText(std::vector<uint8_t>& output, LogLevel level, LogCategory category,
+                               int64_t timestamp, std::wstring_view text);
+    };
+
+    /**
+     * @brief 디코딩된 로그 엔트리
+     */
+    struct DecodedLogEntry
+    {
+        LogLevel level;
+        LogCategory category;
+        int64_t timestamp;          // 파일 헤더의 clockPeriod 단위
+        std::wstring message;
+    };
+
+    /**
+     * @brief 바이너리 로그 파일 디코더 (오프라인 도구용)
+     */
+    class BinaryLogReader
+    {
+    public:
+        /**
+         * @brief 파일 헤더 읽기
+         * @param data 파일 전체 바이트
+         * @param size 바이트 크기
+         * @return 유효한 바이너리 로그면 true
+         */
+        bool Open(const uint8_t* data, size_t size);
+
+        /**
+         * @brief 다음 로그 엔트리 디코딩 (포맷 정의 엔트리는 내부에 저장하고 건너뜀)
+         * @return 엔트리를 읽었으면 true, 파일 끝이거나 잘린 엔트리면 false
+         */
+        bool Next(DecodedLogEntry& entry);
+
+        /**
+         * @brief 파일 헤더 가져오기
+         */
+        const BinaryLogFileHeader& GetHeader() const { return m_header; }
+
+    private:
+        struct FormatDefinition
+        {
+            std::wstring format;
+            std::vector<LogArgType> argTypes;
+        };
+
+        bool Read(void* dst, size_t size);
+
+        const uint8_t* m_cursor = nullptr;
+        const uint8_t* m_end = nullptr;
+        BinaryLogFileHeader m_header = {};
+        std::unordered_map<uint32_t, FormatDefinition> m_formats;
+    };
+}
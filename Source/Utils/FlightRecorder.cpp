@@ -0,0 +1,400 @@
+/**
+ * @file FlightRecorder.cpp
+ * @brief 메모리 내 플라이트 레코더 구현
+ */
+
+#include "FlightRecorder.h"
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    namespace
+    {
+        /**
+         * @brief 스레드 종료 시 링 소유권 반환
+         */
+        struct ThreadRingOwner
+        {
+            std::atomic<bool>* owned = nullptr;
+
+            ~ThreadRingOwner()
+            {
+                if (owned)
+                {
+                    owned->store(false, std::memory_order_release);
+                }
+            }
+        };
+
+        LPTOP_LEVEL_EXCEPTION_FILTER g_previousExceptionFilter = nullptr;
+
+        LONG WINAPI FlightRecorderExceptionFilter(EXCEPTION_POINTERS* exceptionInfo)
+        {
+            const DWORD code = exceptionInfo && exceptionInfo->ExceptionRecord
+                ? exceptionInfo->ExceptionRecord->ExceptionCode : 0;
+
+            wchar_t reason[64];
+            const auto result = std::format_to_n(reason, std::size(reason) - 1,
+                                                 L"Unhandled exception (code {:#010x})", static_cast<uint32_t>(code));
+            *result.out = L'\0';
+            FlightRecorder::Get().Dump(reason);
+
+            return g_previousExceptionFilter ? g_previousExceptionFilter(exceptionInfo) : EXCEPTION_CONTINUE_SEARCH;
+        }
+
+        /**
+         * @brief 타임스탬프 문자열 추가 (2026-01-20 22:30:15.123)
+         */
+        void AppendTimestamp(std::wstring& output, int64_t timestamp)
+        {
+            const std::chrono::system_clock::time_point time{ std::chrono::system_clock::duration(timestamp) };
+            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()) % 1000;
+            const std::time_t timeT = std::chrono::system_clock::to_time_t(time);
+
+            std::tm localTime;
+            localtime_s(&localTime, &timeT);
+
+            std::format_to(std::back_inserter(output), L"{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:03}",
+                           localTime.tm_year + 1900, localTime.tm_mon + 1, localTime.tm_mday,
+                           localTime.tm_hour, localTime.tm_min, localTime.tm_sec, ms.count());
+        }
+    }
+
+    FlightRecorder& FlightRecorder::Get()
+    {
+        static FlightRecorder instance;
+        return instance;
+    }
+
+    void FlightRecorder::Initialize(const FlightRecorderDesc& desc)
+    {
+        if (!kFlightRecorderCompiled)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_dumpMutex);
+            m_desc = desc;
+            m_dumpCount = 0;
+
+            // 첫 덤프부터 할당하지 않도록 미리 확보
+            m_dumpRecords.reserve(kEntriesPerThread * 4);
+            m_dumpText.reserve(kEntriesPerThread * 4 * 128);
+        }
+
+        if (desc.installCrashHandler && !m_crashHandlerInstalled)
+        {
+            g_previousExceptionFilter = SetUnhandledExceptionFilter(&FlightRecorderExceptionFilter);
+            m_crashHandlerInstalled = true;
+        }
+
+        s_enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void FlightRecorder::Shutdown()
+    {
+        s_enabled.store(false, std::memory_order_relaxed);
+
+        if (m_crashHandlerInstalled)
+        {
+            SetUnhandledExceptionFilter(g_previousExceptionFilter);
+            g_previousExceptionFilter = nullptr;
+            m_crashHandlerInstalled = false;
+        }
+    }
+
+    FlightRecorder::ThreadRing* FlightRecorder::AcquireThreadRing()
+    {
+        thread_local ThreadRing* t_ring = nullptr;
+        thread_local ThreadRingOwner t_owner;
+        thread_local bool t_exhausted = false;
+
+        if (t_ring || t_exhausted)
+        {
+            return t_ring;
+        }
+
+        // 종료된 스레드가 반환한 링 재사용, 없으면 빈 슬롯에 새 링 할당
+        for (uint32_t i = 0; i < kMaxThreads && !t_ring; i++)
+        {
+            ThreadRing* ring = s_rings[i].load(std::memory_order_acquire);
+            if (!ring)
+            {
+                ThreadRing* newRing = new ThreadRing();
+                newRing->owned.store(true, std::memory_order_relaxed);
+                if (s_rings[i].compare_exchange_strong(ring, newRing, std::memory_order_acq_rel))
+                {
+                    t_ring = newRing;
+                    break;
+                }
+                delete newRing;
+            }
+
+            bool expected = false;
+            if (ring && ring->owned.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                t_ring = ring;
+            }
+        }
+
+        if (!t_ring)
+        {
+            t_exhausted = true;
+            return nullptr;
+        }
+
+        // 프로세스 종료까지 유지 (덤프 시 종료된 스레드의 레코드도 포함)
+        t_ring->threadId = GetCurrentThreadId();
+        t_owner.owned = &t_ring->owned;
+        return t_ring;
+    }
+
+    FlightRecorder::Entry* FlightRecorder::BeginEntry(LogLevel level, LogCategory category,
+                                                      uint32_t formatId, uint32_t size)
+    {
+        ThreadRing* ring = AcquireThreadRing();
+        if (!ring)
+        {
+            return nullptr;
+        }
+
+        Entry* entry = &ring->entries[ring->writeIndex];
+        ring->writeIndex = (ring->writeIndex + 1) % kEntriesPerThread;
+
+        // 홀수 시퀀스 = 기록 중 (덤프 스레드는 이 슬롯을 건너뜀)
+        const uint32_t sequence = entry->sequence.load(std::memory_order_relaxed);
+        entry->sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        entry->formatId = formatId;
+        entry->serial = ++ring->writeCount;
+        entry->timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+        entry->threadId = ring->threadId;
+        entry->size = static_cast<uint16_t>(size);
+        entry->level = level;
+        entry->category = category;
+        return entry;
+    }
+
+    void FlightRecorder::EndEntry(Entry* entry)
+    {
+        const uint32_t sequence = entry->sequence.load(std::memory_order_relaxed);
+        entry->sequence.store(sequence + 1, std::memory_order_release);
+    }
+
+    void FlightRecorder::RecordText(LogLevel level, LogCategory category, std::wstring_view text)
+    {
+        const size_t length = std::min(text.size(), kEntryPayloadSize / sizeof(wchar_t));
+
+        Entry* entry = BeginEntry(level, category, kInvalidLogFormatId, static_cast<uint32_t>(length * sizeof(wchar_t)));
+        if (entry)
+        {
+            std::memcpy(entry->data, text.data(), length * sizeof(wchar_t));
+            EndEntry(entry);
+        }
+    }
+
+    void FlightRecorder::DumpOnError(LogLevel level, LogCategory category)
+    {
+        if (!IsEnabled())
+        {
+            return;
+        }
+
+        wchar_t reason[kMaxReasonLength];
+        const auto result = std::format_to_n(reason, std::size(reason) - 1, L"{} log ({})",
+                                             LogLevelToString(level), LogCategoryToString(category));
+        *result.out = L'\0';
+
+        // writer 스레드가 있으면 오류를 남긴 스레드에서 포맷팅/파일 I/O를 하지 않음
+        if (m_deferredDumps.load(std::memory_order_acquire))
+        {
+            RequestDump(std::wstring_view(reason, static_cast<size_t>(result.out - reason)));
+            return;
+        }
+
+        Dump(reason);
+    }
+
+    void FlightRecorder::RequestDump(std::wstring_view reason)
+    {
+        PendingDumpState expected = PendingDumpState::None;
+        if (!m_pendingDumpState.compare_exchange_strong(expected, PendingDumpState::Writing,
+                                                        std::memory_order_acquire))
+        {
+            return;
+        }
+
+        const size_t length = std::min(reason.size(), kMaxReasonLength - 1);
+        std::memcpy(m_pendingReason, reason.data(), length * sizeof(wchar_t));
+        m_pendingReason[length] = L'\0';
+
+        m_pendingDumpState.store(PendingDumpState::Ready, std::memory_order_release);
+    }
+
+    bool FlightRecorder::ProcessPendingDump()
+    {
+        PendingDumpState state = m_pendingDumpState.load(std::memory_order_acquire);
+        if (state == PendingDumpState::None)
+        {
+            return false;
+        }
+
+        // 예약한 스레드가 사유 복사를 마칠 때까지 대기 (짧은 memcpy)
+        while (state == PendingDumpState::Writing)
+        {
+            std::this_thread::yield();
+            state = m_pendingDumpState.load(std::memory_order_acquire);
+        }
+
+        wchar_t reason[kMaxReasonLength];
+        std::memcpy(reason, m_pendingReason, sizeof(reason));
+        m_pendingDumpState.store(PendingDumpState::None, std::memory_order_release);
+
+        return Dump(reason);
+    }
+
+    bool FlightRecorder::Dump(std::wstring_view reason)
+    {
+        if (!IsEnabled())
+        {
+            return false;
+        }
+
+        // 크래시 핸들러에서 재진입하거나 다른 스레드가 덤프 중이면 건너뜀
+        std::unique_lock<std::mutex> lock(m_dumpMutex, std::try_to_lock);
+        if (!lock.owns_lock() || m_dumpCount >= m_desc.maxDumps)
+        {
+            return false;
+        }
+
+        // 1. 모든 링에서 이전 덤프 이후의 레코드 복사 (기록 중이거나 덮어쓰인 슬롯은 제외)
+        std::vector<DumpRecord>& records = m_dumpRecords;
+        records.clear();
+        uint32_t threadCount = 0;
+        uint64_t dumpedSerials[kMaxThreads];
+        std::copy(std::begin(m_lastDumpedSerials), std::end(m_lastDumpedSerials), dumpedSerials);
+
+        for (uint32_t i = 0; i < kMaxThreads; i++)
+        {
+            const ThreadRing* ring = s_rings[i].load(std::memory_order_acquire);
+            if (!ring)
+            {
+                break;
+            }
+
+            const size_t before = records.size();
+            for (const Entry& entry : ring->entries)
+            {
+                const uint32_t sequenceBegin = entry.sequence.load(std::memory_order_acquire);
+                if (sequenceBegin == 0 || (sequenceBegin & 1) != 0)
+                {
+                    continue;
+                }
+
+                DumpRecord record;
+                record.timestamp = entry.timestamp;
+                record.serial = entry.serial;
+                record.threadId = entry.threadId;
+                record.formatId = entry.formatId;
+                record.level = entry.level;
+                record.category = entry.category;
+                record.size = std::min<uint16_t>(entry.size, kEntryPayloadSize);
+                std::memcpy(record.data, entry.data, record.size);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (entry.sequence.load(std::memory_order_relaxed) != sequenceBegin ||
+                    record.serial <= m_lastDumpedSerials[i])
+                {
+                    continue;
+                }
+
+                records.push_back(record);
+                dumpedSerials[i] = std::max(dumpedSerials[i], record.serial);
+            }
+
+            if (records.size() > before)
+            {
+                threadCount++;
+            }
+        }
+
+        if (records.empty())
+        {
+            return false;
+        }
+
+        // 같은 시각의 레코드는 기록 순번으로 순서 유지
+        std::sort(records.begin(), records.end(), [](const DumpRecord& a, const DumpRecord& b) {
+            return a.timestamp != b.timestamp ? a.timestamp < b.timestamp : a.serial < b.serial;
+        });
+        std::copy(std::begin(dumpedSerials), std::end(dumpedSerials), m_lastDumpedSerials);
+
+        // 2. 텍스트로 변환
+        // 포맷: [2026-01-20 22:30:15.123][TRACE][Renderer][T:1234] Message
+        std::wstring& text = m_dumpText;
+        text.clear();
+
+        std::format_to(std::back_inserter(text), L"[FlightRecorder] Reason: {}\n", reason);
+        std::format_to(std::back_inserter(text), L"[FlightRecorder] {} records from {} threads\n\n",
+                       records.size(), threadCount);
+
+        for (const DumpRecord& record : records)
+        {
+            text += L"[";
+            AppendTimestamp(text, record.timestamp);
+            std::format_to(std::back_inserter(text), L"][{}][{}][T:{}] ",
+                           LogLevelToString(record.level), LogCategoryToString(record.category), record.threadId);
+
+            if (record.formatId == kInvalidLogFormatId)
+            {
+                text.append(reinterpret_cast<const wchar_t*>(record.data), record.size / sizeof(wchar_t));
+            }
+            else if (const LogFormatInfo* info = LogFormatRegistry::Find(record.formatId))
+            {
+                FormatDeferredLogMessage(*info, record.data, record.size, text);
+            }
+            text += L"\n";
+        }
+
+        // 3. UTF-8 파일로 기록
+        const int utf8Length = WideCharToMultiByte(CP_UTF8, 0, text.c_str(), static_cast<int>(text.size()),
+                                                   nullptr, 0, nullptr, nullptr);
+        std::string& utf8 = m_dumpUtf8;
+        utf8.resize(static_cast<size_t>(std::max(utf8Length, 0)));
+        WideCharToMultiByte(CP_UTF8, 0, text.c_str(), static_cast<int>(text.size()),
+                            utf8.data(), utf8Length, nullptr, nullptr);
+
+        const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+        std::tm localTime;
+        localtime_s(&localTime, &now);
+
+        const std::filesystem::path path = m_desc.directory / std::format(
+            L"{}_FlightRecorder_{:04}-{:02}-{:02}_{:02}-{:02}-{:02}_{}.log", m_desc.filePrefix,
+            localTime.tm_year + 1900, localTime.tm_mon + 1, localTime.tm_mday,
+            localTime.tm_hour, localTime.tm_min, localTime.tm_sec, m_dumpCount);
+
+        std::ofstream file(path, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!file.is_open())
+        {
+            std::wcerr << L"[FlightRecorder] Warning: Failed to open dump file\n";
+            return false;
+        }
+
+        file.write(utf8.data(), static_cast<std::streamsize>(utf8.size()));
+        m_dumpCount++;
+        return true;
+    }
+}
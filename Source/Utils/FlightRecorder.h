@@ -0,0 +1,279 @@
+/**
+ * @file FlightRecorder.h
+ * @brief 메모리 내 플라이트 레코더 (최근 Trace/Debug 로그 보관)
+ *
+ * 출력되지 않는 Trace/Debug 로그를 스레드별 고정 크기 링에 바이너리 형태로 보관하고,
+ * Error/Fatal 로그, 디바이스 제거, 프로세스 크래시 시에만 파일로 덤프합니다.
+ * Release 빌드에서도 오류 직전의 상세 맥락을 얻을 수 있습니다.
+ *
+ * Error/Fatal 로그의 덤프는 Logger writer 스레드가 동작 중이면 예약만 하고 writer가 기록합니다
+ * (로그를 남긴 스레드는 포맷팅/파일 I/O를 하지 않음). 크래시와 디바이스 제거는 즉시 기록합니다.
+ */
+
+#pragma once
+
+#include "LogTypes.h"
+#include "BinaryLog.h"
+#include <Core/BuildConfig.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 플라이트 레코더 컴파일 여부
+     *
+     * false면 출력되지 않는 Trace/Debug 호출은 기존처럼 인자 평가 없이 제거됩니다.
+     */
+    static constexpr bool kFlightRecorderCompiled = BUILD_DEFAULT(EnableFlightRecorder);
+
+    /**
+     * @brief 해당 레벨이 플라이트 레코더 대상인지 여부 (Trace, Debug)
+     */
+    constexpr bool IsFlightRecorderLevel(LogLevel level)
+    {
+        return kFlightRecorderCompiled && level <= LogLevel::Debug;
+    }
+
+    /**
+     * @brief 플라이트 레코더 설정
+     */
+    struct FlightRecorderDesc
+    {
+        std::filesystem::path directory;    // 덤프 파일 저장 폴더
+        std::wstring filePrefix;            // 덤프 파일 접두사
+        uint32_t maxDumps;                  // 실행당 최대 덤프 파일 수
+        bool installCrashHandler;           // 처리되지 않은 예외 시 덤프
+
+        FlightRecorderDesc()
+            : filePrefix(L"Engine")
+            , maxDumps(16)
+            , installCrashHandler(true)
+        {
+        }
+    };
+
+    /**
+     * @brief 스레드별 락 없는 최근 로그 링 (싱글톤)
+     *
+     * - 기록: 호출 스레드 전용 링의 다음 슬롯에 포맷 ID + 인자 바이트를 복사합니다.
+     *   락, 포맷팅, 힙 할당이 없습니다 (스레드 첫 기록 시 링 할당 한 번 제외).
+     * - 덤프: 모든 스레드 링을 시퀀스 번호(seqlock)로 검증하며 복사하고,
+     *   시각 순으로 정렬해 텍스트 파일로 기록합니다. 링별 기록 순번으로 이전 덤프 이후의 레코드만 포함합니다.
+     */
+    class FlightRecorder
+    {
+    public:
+        static constexpr uint32_t kEntriesPerThread = 512;     // 스레드당 보관 레코드 수
+        static constexpr uint32_t kMaxThreads = 64;            // 링을 가질 수 있는 최대 동시 스레드 수
+        static constexpr uint32_t kEntryPayloadSize = 224;     // 레코드당 인자/텍스트 바이트
+
+        /**
+         * @brief 싱글톤 인스턴스 반환
+         */
+        static FlightRecorder& Get();
+
+        /**
+         * @brief 플라이트 레코더 시작
+         * @param desc 설정
+         */
+        void Initialize(const FlightRecorderDesc& desc);
+
+        /**
+         * @brief 플라이트 레코더 중지 (크래시 핸들러 복원)
+         */
+        void Shutdown();
+
+        /**
+         * @brief 기록 활성화 여부
+         */
+        static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief 포맷된 로그 레코드 기록 (LOG_* 매크로용)
+         *
+         * 인자가 지연 포맷 가능하면 인자 바이트를, 아니면 포맷 문자열만 기록합니다.
+         */
+        template<typename... Args>
+        static void Record(LogFormatSite& site, LogLevel level, LogCategory category,
+                           std::wformat_string<Args...> fmt, Args&&... args)
+        {
+            if (!IsEnabled())
+            {
+                return;
+            }
+
+            if constexpr (kAreLogArgsDeferrable<Args...>)
+            {
+                const size_t argsSize = GetEncodedLogArgsSize(args...);
+                if (argsSize <= kEntryPayloadSize)
+                {
+                    uint32_t formatId = site.GetId();
+                    if (formatId == kInvalidLogFormatId)
+                    {
+                        const LogArgType argTypes[] = { LogArgTraits<std::decay_t<Args>>::kType..., LogArgType::Int32 };
+                        formatId = LogFormatRegistry::Register(site, fmt.get(), argTypes, sizeof...(Args));
+                    }
+
+                    if (formatId != kInvalidLogFormatId)
+                    {
+                        Entry* entry = BeginEntry(level, category, formatId, static_cast<uint32_t>(argsSize));
+                        if (entry)
+                        {
+                            EncodeLogArgs(entry->data, args...);
+                            EndEntry(entry);
+                        }
+                        return;
+                    }
+                }
+            }
+
+            RecordText(level, category, fmt.get());
+        }
+
+        /**
+         * @brief 텍스트 로그 레코드 기록 (LOG_* 매크로용, 초과분은 잘림)
+         */
+        static void Record(LogFormatSite& site, LogLevel level, LogCategory category, std::wstring_view message)
+        {
+            (void)site;
+            if (IsEnabled())
+            {
+                RecordText(level, category, message);
+            }
+        }
+
+        /**
+         * @brief 보관 중인 레코드를 파일로 덤프
+         *
+         * 이전 덤프 이후 새 레코드가 없으면 파일을 만들지 않습니다.
+         *
+         * @param reason 덤프 사유 (파일 첫 줄에 기록)
+         * @return 파일을 기록했으면 true
+         */
+        bool Dump(std::wstring_view reason);
+
+        /**
+         * @brief Error/Fatal 로그 발생 시 덤프 (지연 덤프가 켜져 있으면 예약만 함)
+         */
+        void DumpOnError(LogLevel level, LogCategory category);
+
+        /**
+         * @brief 지연 덤프 켜기 / 끄기 (Logger writer 스레드 시작 / 종료 시)
+         */
+        void SetDeferredDumpsEnabled(bool enabled) { m_deferredDumps.store(enabled, std::memory_order_release); }
+
+        /**
+         * @brief 예약된 덤프가 있으면 기록 (Logger writer 스레드에서 호출)
+         * @return 파일을 기록했으면 true
+         */
+        bool ProcessPendingDump();
+
+    private:
+        FlightRecorder() = default;
+        ~FlightRecorder() = default;
+
+        // 복사 및 이동 금지
+        FlightRecorder(const FlightRecorder&) = delete;
+        FlightRecorder& operator=(const FlightRecorder&) = delete;
+        FlightRecorder(FlightRecorder&&) = delete;
+        FlightRecorder& operator=(FlightRecorder&&) = delete;
+
+        /**
+         * @brief 링 슬롯 (seqlock: 홀수 = 기록 중, 0 = 비어 있음)
+         */
+        struct Entry
+        {
+            std::atomic<uint32_t> sequence;
+            uint32_t formatId;          // kInvalidLogFormatId면 텍스트
+            uint64_t serial;            // 링 내 기록 순번 (1부터, 덤프 중복 제거용)
+            int64_t timestamp;          // system_clock 틱
+            uint32_t threadId;
+            uint16_t size;              // data 바이트 수
+            LogLevel level;
+            LogCategory category;
+            uint8_t data[kEntryPayloadSize];
+        };
+
+        /**
+         * @brief 스레드 전용 링 (스레드 종료 시 다른 스레드가 재사용)
+         */
+        struct ThreadRing
+        {
+            Entry entries[kEntriesPerThread];
+            std::atomic<bool> owned{ false };
+            uint32_t writeIndex = 0;    // 소유 스레드만 접근
+            uint32_t threadId = 0;
+            uint64_t writeCount = 0;    // 소유 스레드만 접근 (링을 재사용해도 이어서 증가)
+        };
+
+        /**
+         * @brief 덤프용으로 복사한 레코드
+         */
+        struct DumpRecord
+        {
+            int64_t timestamp;
+            uint64_t serial;
+            uint32_t threadId;
+            uint32_t formatId;
+            LogLevel level;
+            LogCategory category;
+            uint16_t size;
+            uint8_t data[kEntryPayloadSize];
+        };
+
+        /**
+         * @brief 예약된 덤프 상태
+         */
+        enum class PendingDumpState : uint32_t
+        {
+            None,
+            Writing,    // 예약한 스레드가 사유를 복사하는 중
+            Ready
+        };
+
+        static constexpr size_t kMaxReasonLength = 64;
+
+        static Entry* BeginEntry(LogLevel level, LogCategory category, uint32_t formatId, uint32_t size);
+        static void EndEntry(Entry* entry);
+        static void RecordText(LogLevel level, LogCategory category, std::wstring_view text);
+
+        /**
+         * @brief 호출 스레드의 링 반환 (첫 호출 시 빈 링을 확보)
+         * @return 링 (스레드 수 한도 초과 시 nullptr)
+         */
+        static ThreadRing* AcquireThreadRing();
+
+        /**
+         * @brief 덤프 예약 (이미 예약되어 있으면 무시, 다음 예약 처리 때 함께 기록됨)
+         */
+        void RequestDump(std::wstring_view reason);
+
+    private:
+        inline static std::atomic<bool> s_enabled{ false };
+        inline static std::atomic<ThreadRing*> s_rings[kMaxThreads] = {};
+
+        FlightRecorderDesc m_desc;
+        std::mutex m_dumpMutex;
+        uint64_t m_lastDumpedSerials[kMaxThreads] = {};     // 링별 마지막으로 덤프한 순번
+        uint32_t m_dumpCount = 0;
+        bool m_crashHandlerInstalled = false;
+
+        // 덤프 버퍼 (m_dumpMutex 보호, 용량 재사용)
+        std::vector<DumpRecord> m_dumpRecords;
+        std::wstring m_dumpText;
+        std::string m_dumpUtf8;
+
+        // 지연 덤프 예약
+        std::atomic<bool> m_deferredDumps{ false };
+        std::atomic<PendingDumpState> m_pendingDumpState{ PendingDumpState::None };
+        wchar_t m_pendingReason[kMaxReasonLength] = {};
+    };
+}
@@ -0,0 +1,225 @@
+/**
+ * @file JsonLinesLogSink.cpp
+ * @brief JSON Lines 로그 싱크 구현
+ */
+
+#include "JsonLinesLogSink.h"
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+
+namespace DX12GameEngine
+{
+    namespace
+    {
+        /**
+         * @brief JSON 필드 값용 레벨 이름 (공백 패딩 없음)
+         */
+        const char* GetLevelName(LogLevel level)
+        {
+            switch (level)
+            {
+            case LogLevel::Trace:   return "Trace";
+            case LogLevel::Debug:   return "Debug";
+            case LogLevel::Info:    return "Info";
+            case LogLevel::Warning: return "Warning";
+            case LogLevel::Error:   return "Error";
+            case LogLevel::Fatal:   return "Fatal";
+            default:                return "Unknown";
+            }
+        }
+
+        /**
+         * @brief JSON 필드 값용 카테고리 이름 (공백 패딩 없음)
+         */
+        const char* GetCategoryName(LogCategory category)
+        {
+            switch (category)
+            {
+            case LogCategory::Engine:   return "Engine";
+            case LogCategory::Renderer: return "Renderer";
+            case LogCategory::Device:   return "Device";
+            case LogCategory::Window:   return "Window";
+            case LogCategory::Input:    return "Input";
+            case LogCategory::Resource: return "Resource";
+            case LogCategory::Shader:   return "Shader";
+            case LogCategory::Memory:   return "Memory";
+            case LogCategory::Core:     return "Core";
+            default:                    return "Unknown";
+            }
+        }
+
+        /**
+         * @brief 부호 없는 정수를 10진수로 추가
+         */
+        void AppendNumber(std::string& output, uint64_t value)
+        {
+            char digits[20];
+            size_t count = 0;
+            do
+            {
+                digits[count++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value > 0);
+
+            while (count > 0)
+            {
+                output += digits[--count];
+            }
+        }
+    }
+
+    JsonLinesLogSink::~JsonLinesLogSink()
+    {
+        Close();
+    }
+
+    bool JsonLinesLogSink::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        m_file.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!m_file.is_open())
+        {
+            std::wcerr << L"[JsonLinesLogSink] Warning: Failed to open " << path.wstring() << L"\n";
+            return false;
+        }
+
+        m_buffer.reserve(kFlushThreshold + 1024);
+        m_cachedSecond = -1;
+        return true;
+    }
+
+    void JsonLinesLogSink::Close()
+    {
+        if (m_file.is_open())
+        {
+            Flush();
+            m_file.close();
+        }
+    }
+
+    void JsonLinesLogSink::Write(const LogRecord& record)
+    {
+        if (!m_file.is_open())
+        {
+            return;
+        }
+
+        m_buffer += "{\"time\":\"";
+        AppendTime(record.timestamp);
+        m_buffer += "\",\"monotonicNs\":";
+        AppendNumber(m_buffer, static_cast<uint64_t>(record.monotonicTimestamp));
+        m_buffer += ",\"frame\":";
+        AppendNumber(m_buffer, record.frameNumber);
+        m_buffer += ",\"threadId\":";
+        AppendNumber(m_buffer, record.threadId);
+        m_buffer += ",\"level\":\"";
+        m_buffer += GetLevelName(record.level);
+        m_buffer += "\",\"category\":\"";
+        m_buffer += GetCategoryName(record.category);
+        m_buffer += "\",\"message\":\"";
+        AppendEscapedMessage(record.message);
+        m_buffer += "\"}\n";
+
+        if (m_buffer.size() >= kFlushThreshold)
+        {
+            m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+            m_buffer.clear();
+        }
+    }
+
+    void JsonLinesLogSink::Flush()
+    {
+        if (!m_file.is_open())
+        {
+            return;
+        }
+
+        if (!m_buffer.empty())
+        {
+            m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+            m_buffer.clear();
+        }
+        m_file.flush();
+    }
+
+    void JsonLinesLogSink::AppendTime(int64_t timestamp)
+    {
+        // ISO 8601 UTC: 2026-01-20T13:30:15.123Z
+        const std::chrono::system_clock::time_point time{ std::chrono::system_clock::duration(timestamp) };
+        const int64_t totalMs = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+        const int64_t second = totalMs >= 0 ? totalMs / 1000 : (totalMs - 999) / 1000;
+        const uint32_t ms = static_cast<uint32_t>(totalMs - second * 1000);
+
+        // 날짜/시각 부분은 초가 바뀔 때만 다시 계산
+        if (second != m_cachedSecond)
+        {
+            const std::time_t timeT = static_cast<std::time_t>(second);
+            std::tm utcTime;
+            gmtime_s(&utcTime, &timeT);
+            std::strftime(m_cachedTime, sizeof(m_cachedTime), "%Y-%m-%dT%H:%M:%S", &utcTime);
+            m_cachedSecond = second;
+        }
+
+        m_buffer += m_cachedTime;
+        m_buffer += '.';
+        m_buffer += static_cast<char>('0' + ms / 100);
+        m_buffer += static_cast<char>('0' + ms / 10 % 10);
+        m_buffer += static_cast<char>('0' + ms % 10);
+        m_buffer += 'Z';
+    }
+
+    void JsonLinesLogSink::AppendEscapedMessage(std::wstring_view message)
+    {
+        if (message.empty())
+        {
+            return;
+        }
+
+        const int sourceLength = static_cast<int>(message.size());
+        const int utf8Length = WideCharToMultiByte(CP_UTF8, 0, message.data(), sourceLength, nullptr, 0, nullptr, nullptr);
+        if (utf8Length <= 0)
+        {
+            return;
+        }
+
+        if (m_utf8Message.size() < static_cast<size_t>(utf8Length))
+        {
+            m_utf8Message.resize(static_cast<size_t>(utf8Length));
+        }
+        WideCharToMultiByte(CP_UTF8, 0, message.data(), sourceLength, m_utf8Message.data(), utf8Length, nullptr, nullptr);
+
+        static constexpr char kHexDigits[] = "0123456789abcdef";
+
+        for (int i = 0; i < utf8Length; i++)
+        {
+            const char c = m_utf8Message[i];
+            switch (c)
+            {
+            case '"':  m_buffer += "\\\""; break;
+            case '\\': m_buffer += "\\\\"; break;
+            case '\n': m_buffer += "\\n"; break;
+            case '\r': m_buffer += "\\r"; break;
+            case '\t': m_buffer += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    m_buffer += "\\u00";
+                    m_buffer += kHexDigits[(c >> 4) & 0xF];
+                    m_buffer += kHexDigits[c & 0xF];
+                }
+                else
+                {
+                    // UTF-8 멀티바이트 시퀀스는 그대로 기록
+                    m_buffer += c;
+                }
+                break;
+            }
+        }
+    }
+}
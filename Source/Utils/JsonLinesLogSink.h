@@ -0,0 +1,71 @@
+/**
+ * @file JsonLinesLogSink.h
+ * @brief JSON Lines 형식 구조화 로그 싱크
+ *
+ * 레코드마다 한 줄의 JSON 객체를 UTF-8로 기록합니다. 로그 수집기/대시보드가
+ * 정규식 없이 필드를 읽을 수 있습니다.
+ *
+ * {"time":"2026-01-20T13:30:15.123Z","monotonicNs":1234567,"frame":42,"threadId":1234,
+ *  "level":"Warning","category":"Renderer","message":"..."}
+ */
+
+#pragma once
+
+#include "LogSink.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief JSON Lines 파일 싱크
+     */
+    class JsonLinesLogSink : public ILogSink
+    {
+    public:
+        JsonLinesLogSink() = default;
+        ~JsonLinesLogSink() override;
+
+        // 복사 및 이동 금지
+        JsonLinesLogSink(const JsonLinesLogSink&) = delete;
+        JsonLinesLogSink& operator=(const JsonLinesLogSink&) = delete;
+        JsonLinesLogSink(JsonLinesLogSink&&) = delete;
+        JsonLinesLogSink& operator=(JsonLinesLogSink&&) = delete;
+
+        /**
+         * @brief 출력 파일 열기 (기존 내용은 지움)
+         * @param path .jsonl 파일 경로
+         * @return 성공 시 true
+         */
+        bool Open(const std::filesystem::path& path);
+
+        /**
+         * @brief 남은 내용을 기록하고 파일 닫기
+         */
+        void Close();
+
+        void Write(const LogRecord& record) override;
+        void Flush() override;
+
+    private:
+        /**
+         * @brief UTC 시각 문자열 추가 (초 단위 부분은 캐시)
+         */
+        void AppendTime(int64_t timestamp);
+
+        /**
+         * @brief 메시지를 UTF-8로 변환하고 JSON 문자열 규칙에 맞게 이스케이프해 추가
+         */
+        void AppendEscapedMessage(std::wstring_view message);
+
+    private:
+        static constexpr size_t kFlushThreshold = 64 * 1024;
+
+        std::ofstream m_file;
+        std::string m_buffer;           // 배치 버퍼 (용량 재사용)
+        std::string m_utf8Message;      // 메시지 UTF-8 변환 버퍼 (용량 재사용)
+        int64_t m_cachedSecond = -1;
+        char m_cachedTime[20] = {};     // "YYYY-MM-DDTHH:MM:SS"
+    };
+}
@@ -0,0 +1,103 @@
+/**
+ * @file LogRateLimit.cpp
+ * @brief 로그 빈도 제한과 중복 병합 구현
+ */
+
+#include "LogRateLimit.h"
+#include <chrono>
+#include <cstring>
+
+namespace DX12GameEngine
+{
+    bool LogRateLimitSite::ShouldLogEveryMs(uint32_t intervalMs, uint32_t& suppressedCount)
+    {
+        const int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+        int64_t nextLogTime = m_nextLogTime.load(std::memory_order_relaxed);
+
+        // 간격이 지나지 않았거나 다른 스레드가 먼저 통과하면 세기만 함
+        if (now < nextLogTime ||
+            !m_nextLogTime.compare_exchange_strong(nextLogTime,
+                now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::milliseconds(intervalMs)).count(),
+                std::memory_order_relaxed))
+        {
+            m_suppressedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        suppressedCount = m_suppressedCount.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool LogRateLimitSite::ShouldLogFirstN(uint32_t limit, uint32_t& suppressedCount)
+    {
+        const uint32_t count = m_callCount.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (count <= limit)
+        {
+            suppressedCount = 0;
+            return true;
+        }
+
+        // limit * 2^k번째 호출마다 요약 (출력 횟수가 로그 스케일로만 증가)
+        const uint32_t multiple = limit > 0 ? count / limit : count;
+        const bool isSummaryPoint = (limit == 0 || count % limit == 0) && (multiple & (multiple - 1)) == 0;
+        if (!isSummaryPoint)
+        {
+            m_suppressedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        suppressedCount = m_suppressedCount.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    void LogRepeatTracker::Reserve(size_t payloadSize)
+    {
+        m_payload.reserve(payloadSize);
+    }
+
+    bool LogRepeatTracker::IsRepeat(LogLevel level, LogCategory category, uint32_t formatId,
+                                    const void* data, size_t size, int64_t timestamp)
+    {
+        if (!m_hasLast || level != m_level || category != m_category || formatId != m_formatId ||
+            size != m_payload.size() || (size > 0 && std::memcmp(data, m_payload.data(), size) != 0))
+        {
+            return false;
+        }
+
+        if (m_repeatCount == 0)
+        {
+            m_firstRepeatTimestamp = timestamp;
+        }
+        m_repeatCount++;
+        m_lastRepeatTimestamp = timestamp;
+        return true;
+    }
+
+    void LogRepeatTracker::SetLast(LogLevel level, LogCategory category, uint32_t formatId,
+                                   const void* data, size_t size, int64_t timestamp)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        m_payload.assign(bytes, bytes + size);
+        m_level = level;
+        m_category = category;
+        m_formatId = formatId;
+        m_repeatCount = 0;
+        m_firstRepeatTimestamp = timestamp;
+        m_lastRepeatTimestamp = timestamp;
+        m_hasLast = true;
+    }
+
+    uint32_t LogRepeatTracker::TakeRepeatCount()
+    {
+        const uint32_t count = m_repeatCount;
+        m_repeatCount = 0;
+        return count;
+    }
+
+    void LogRepeatTracker::Clear()
+    {
+        m_repeatCount = 0;
+        m_hasLast = false;
+    }
+}
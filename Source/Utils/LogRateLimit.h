@@ -0,0 +1,112 @@
+/**
+ * @file LogRateLimit.h
+ * @brief 호출 지점별 로그 빈도 제한과 연속 중복 로그 병합
+ *
+ * 매 프레임 호출되는 경로의 로그가 출력 대상을 가득 채우지 않도록
+ * 호출 지점마다 "N ms에 한 번" 또는 "처음 N번 이후 요약만" 제한을 겁니다.
+ * Logger는 같은 메시지가 연속으로 들어오면 "repeated xN" 레코드 하나로 병합합니다.
+ */
+
+#pragma once
+
+#include "LogTypes.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 호출 지점별 빈도 제한 상태 (LOG_*_EVERY_MS, LOG_*_FIRST_N 매크로의 static 변수)
+     *
+     * 모든 멤버가 상수 초기화되는 atomic이므로 정적 초기화 순서나 락이 필요 없습니다.
+     * 통과 여부 판단은 relaxed 로드 한 번과, 통과할 때만 CAS 한 번입니다.
+     */
+    class LogRateLimitSite
+    {
+    public:
+        constexpr LogRateLimitSite() = default;
+
+        /**
+         * @brief intervalMs마다 한 번만 통과
+         * @param intervalMs 최소 출력 간격 (밀리초)
+         * @param suppressedCount [out] 통과 시, 직전 출력 이후 걸러진 호출 수
+         * @return 이번 호출을 출력하면 true
+         */
+        bool ShouldLogEveryMs(uint32_t intervalMs, uint32_t& suppressedCount);
+
+        /**
+         * @brief 처음 limit번 통과, 이후에는 누적 횟수가 limit의 2, 4, 8...배가 될 때만 통과
+         * @param limit 그대로 출력할 횟수
+         * @param suppressedCount [out] 통과 시, 직전 출력 이후 걸러진 호출 수
+         * @return 이번 호출을 출력하면 true
+         */
+        bool ShouldLogFirstN(uint32_t limit, uint32_t& suppressedCount);
+
+    private:
+        std::atomic<int64_t> m_nextLogTime{ 0 };       // steady_clock 틱
+        std::atomic<uint32_t> m_callCount{ 0 };
+        std::atomic<uint32_t> m_suppressedCount{ 0 };
+    };
+
+    /**
+     * @brief 직전 레코드와 같은 레코드를 세어 "repeated xN"으로 병합 (Logger 내부용)
+     *
+     * 레벨, 카테고리, 포맷 ID, 페이로드 바이트(텍스트 또는 인코딩된 인자)가 모두 같으면
+     * 같은 메시지로 봅니다. 포맷팅 없이 바이트 비교만 하므로 지연 포맷 레코드에도 쓸 수 있습니다.
+     * 스레드 안전하지 않습니다 (writer 스레드 또는 m_mutex 보유 상태에서만 사용).
+     */
+    class LogRepeatTracker
+    {
+    public:
+        /**
+         * @brief 병합되지 않은 반복이 이 시간 이상 쌓이면 새 메시지가 없어도 요약 출력
+         */
+        static constexpr int64_t kMaxPendingMs = 1000;
+
+        /**
+         * @brief 최대 페이로드 크기만큼 미리 확보 (이후 재할당 없음)
+         */
+        void Reserve(size_t payloadSize);
+
+        /**
+         * @brief 직전 레코드와 같은지 검사하고, 같으면 반복 횟수 증가
+         * @param timestamp 레코드 시각 (system_clock 틱)
+         * @return 직전 레코드의 반복이면 true (출력 생략)
+         */
+        bool IsRepeat(LogLevel level, LogCategory category, uint32_t formatId,
+                      const void* data, size_t size, int64_t timestamp);
+
+        /**
+         * @brief 다음 비교 기준이 될 레코드 저장 (반복 횟수 초기화)
+         */
+        void SetLast(LogLevel level, LogCategory category, uint32_t formatId,
+                     const void* data, size_t size, int64_t timestamp);
+
+        /**
+         * @brief 출력하지 않은 반복 횟수 반환 후 초기화
+         */
+        uint32_t TakeRepeatCount();
+
+        /**
+         * @brief 비교 기준 제거 (다음 레코드는 항상 새 메시지)
+         */
+        void Clear();
+
+        uint32_t GetRepeatCount() const { return m_repeatCount; }
+        LogLevel GetLevel() const { return m_level; }
+        LogCategory GetCategory() const { return m_category; }
+        int64_t GetFirstRepeatTimestamp() const { return m_firstRepeatTimestamp; }
+        int64_t GetLastRepeatTimestamp() const { return m_lastRepeatTimestamp; }
+
+    private:
+        std::vector<uint8_t> m_payload;
+        LogLevel m_level = LogLevel::Trace;
+        LogCategory m_category = LogCategory::Core;
+        uint32_t m_formatId = 0;
+        uint32_t m_repeatCount = 0;
+        int64_t m_firstRepeatTimestamp = 0;
+        int64_t m_lastRepeatTimestamp = 0;
+        bool m_hasLast = false;
+    };
+}
@@ -0,0 +1,123 @@
+/**
+ * @file LogRingBuffer.cpp
+ * @brief 비동기 로깅용 다중 생산자 링 버퍼 구현
+ */
+
+#include "LogRingBuffer.h"
+#include <algorithm>
+#include <bit>
+
+namespace DX12GameEngine
+{
+    LogRingBuffer::LogRingBuffer()
+        : m_buffer(nullptr)
+        , m_capacity(0)
+        , m_mask(0)
+        , m_maxPayloadSize(0)
+        , m_writePos(0)
+        , m_readPos(0)
+    {
+    }
+
+    LogRingBuffer::~LogRingBuffer()
+    {
+        Release();
+    }
+
+    bool LogRingBuffer::Initialize(uint32_t capacityBytes)
+    {
+        if (m_buffer || capacityBytes == 0)
+        {
+            return false;
+        }
+
+        // 위치 계산을 마스크 연산으로 하기 위해 2의 거듭제곱으로 올림
+        m_capacity = std::bit_ceil(std::max<uint64_t>(capacityBytes, 4096));
+        m_mask = m_capacity - 1;
+
+        // 한 레코드가 버퍼의 절반을 넘으면 패딩 때문에 영원히 예약하지 못할 수 있음
+        m_maxPayloadSize = static_cast<uint32_t>(m_capacity / 2 - sizeof(RecordHeader));
+
+        // 0으로 초기화된 버퍼 = 모든 위치가 미커밋 상태
+        m_storage = std::make_unique<uint64_t[]>(m_capacity / sizeof(uint64_t));
+        m_buffer = reinterpret_cast<uint8_t*>(m_storage.get());
+
+        m_writePos.store(0, std::memory_order_relaxed);
+        m_readPos.store(0, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    void LogRingBuffer::Release()
+    {
+        m_storage.reset();
+        m_buffer = nullptr;
+        m_capacity = 0;
+        m_mask = 0;
+        m_maxPayloadSize = 0;
+        m_writePos.store(0, std::memory_order_relaxed);
+        m_readPos.store(0, std::memory_order_relaxed);
+    }
+
+    void* LogRingBuffer::TryReserve(uint32_t payloadSize)
+    {
+        if (!m_buffer || payloadSize > m_maxPayloadSize)
+        {
+            return nullptr;
+        }
+
+        const uint64_t recordSize = GetRecordSize(payloadSize);
+        uint64_t writePos = m_writePos.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            const uint64_t offset = writePos & m_mask;
+            const uint64_t tailSpace = m_capacity - offset;
+
+            // 버퍼 끝에 들어가지 않으면 끝까지 패딩 후 앞쪽에 배치
+            const bool needsPadding = recordSize > tailSpace;
+            const uint64_t required = needsPadding ? tailSpace + recordSize : recordSize;
+
+            const uint64_t readPos = m_readPos.load(std::memory_order_acquire);
+            if (writePos + required - readPos > m_capacity)
+            {
+                return nullptr;  // 가득 참
+            }
+
+            if (m_writePos.compare_exchange_weak(writePos, writePos + required,
+                                                 std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+                uint64_t recordPos = writePos;
+
+                if (needsPadding)
+                {
+                    RecordHeader* padding = GetHeaderAt(writePos);
+                    padding->payloadSize = kPaddingMarker;
+                    std::atomic_ref<uint32_t>(padding->committedSize)
+                        .store(static_cast<uint32_t>(tailSpace), std::memory_order_release);
+                    recordPos += tailSpace;
+                }
+
+                RecordHeader* header = GetHeaderAt(recordPos);
+                header->payloadSize = payloadSize;
+                return header + 1;
+            }
+
+            // CAS 실패 시 writePos가 최신 값으로 갱신되어 재시도
+        }
+    }
+
+    void LogRingBuffer::Commit(void* payload)
+    {
+        if (!payload)
+        {
+            return;
+        }
+
+        RecordHeader* header = static_cast<RecordHeader*>(payload) - 1;
+        const uint32_t recordSize = static_cast<uint32_t>(GetRecordSize(header->payloadSize));
+
+        // payload 쓰기가 소비자에게 보이도록 release
+        std::atomic_ref<uint32_t>(header->committedSize).store(recordSize, std::memory_order_release);
+    }
+}
@@ -0,0 +1,165 @@
+/**
+ * @file LogRingBuffer.h
+ * @brief 비동기 로깅용 다중 생산자 링 버퍼
+ *
+ * 여러 스레드가 가변 길이 레코드를 락 없이 예약/커밋하고,
+ * 단일 소비자(로그 writer 스레드)가 커밋 순서대로 꺼내 처리합니다.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 가변 길이 레코드용 MPSC 링 버퍼
+     *
+     * 레코드 레이아웃: [RecordHeader][payload...] (8바이트 정렬)
+     *
+     * - 생산자: TryReserve()로 쓰기 위치를 CAS 한 번으로 예약하고,
+     *   payload를 채운 뒤 Commit()으로 헤더에 크기를 기록(release)합니다.
+     * - 소비자: Drain()으로 커밋된 레코드를 순서대로 처리하고,
+     *   처리한 영역을 0으로 지운 뒤 읽기 위치를 전진시킵니다.
+     *
+     * 버퍼 끝에 레코드가 들어가지 않으면 남은 공간을 패딩 레코드로 채우고
+     * 버퍼 앞쪽에 레코드를 배치합니다.
+     */
+    class LogRingBuffer
+    {
+    public:
+        LogRingBuffer();
+        ~LogRingBuffer();
+
+        // 복사 및 이동 금지
+        LogRingBuffer(const LogRingBuffer&) = delete;
+        LogRingBuffer& operator=(const LogRingBuffer&) = delete;
+        LogRingBuffer(LogRingBuffer&&) = delete;
+        LogRingBuffer& operator=(LogRingBuffer&&) = delete;
+
+        /**
+         * @brief 링 버퍼 초기화
+         * @param capacityBytes 버퍼 크기 (2의 거듭제곱으로 올림)
+         * @return 성공 시 true
+         */
+        bool Initialize(uint32_t capacityBytes);
+
+        /**
+         * @brief 링 버퍼 해제
+         */
+        void Release();
+
+        /**
+         * @brief 레코드 공간 예약 (생산자, 스레드 안전)
+         * @param payloadSize 예약할 payload 크기 (바이트)
+         * @return payload 포인터 (버퍼가 가득 차면 nullptr)
+         */
+        void* TryReserve(uint32_t payloadSize);
+
+        /**
+         * @brief 예약한 레코드 커밋 (생산자)
+         * @param payload TryReserve()가 반환한 포인터
+         */
+        void Commit(void* payload);
+
+        /**
+         * @brief 커밋된 레코드를 순서대로 처리 (소비자 전용)
+         *
+         * 아직 커밋되지 않은 레코드를 만나면 그 지점에서 멈춥니다.
+         *
+         * @param callback void(const void* payload, uint32_t payloadSize)
+         * @return 처리한 레코드 수
+         */
+        template<typename Callback>
+        uint32_t Drain(Callback&& callback);
+
+        /**
+         * @brief 버퍼가 비어 있는지 확인 (예약 후 미커밋 레코드 포함)
+         */
+        bool IsEmpty() const
+        {
+            return m_readPos.load(std::memory_order_acquire) == m_writePos.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief 한 레코드에 담을 수 있는 최대 payload 크기
+         */
+        uint32_t GetMaxPayloadSize() const { return m_maxPayloadSize; }
+
+        /**
+         * @brief 버퍼 전체 크기 (바이트)
+         */
+        uint32_t GetCapacity() const { return static_cast<uint32_t>(m_capacity); }
+
+    private:
+        struct RecordHeader
+        {
+            uint32_t committedSize;     // 레코드 전체 크기 (0이면 미커밋)
+            uint32_t payloadSize;       // payload 크기 (kPaddingMarker면 패딩)
+        };
+
+        static constexpr uint32_t kAlignment = 8;
+        static constexpr uint32_t kPaddingMarker = UINT32_MAX;
+
+        static uint64_t GetRecordSize(uint32_t payloadSize)
+        {
+            return (sizeof(RecordHeader) + static_cast<uint64_t>(payloadSize) + kAlignment - 1) & ~static_cast<uint64_t>(kAlignment - 1);
+        }
+
+        RecordHeader* GetHeaderAt(uint64_t position) const
+        {
+            return reinterpret_cast<RecordHeader*>(m_buffer + (position & m_mask));
+        }
+
+        uint8_t* m_buffer;
+        std::unique_ptr<uint64_t[]> m_storage;  // 8바이트 정렬 보장용
+        uint64_t m_capacity;
+        uint64_t m_mask;
+        uint32_t m_maxPayloadSize;
+
+        // 생산자/소비자 위치는 서로 다른 캐시 라인에 배치 (false sharing 방지)
+        alignas(64) std::atomic<uint64_t> m_writePos;
+        alignas(64) std::atomic<uint64_t> m_readPos;
+    };
+
+    template<typename Callback>
+    uint32_t LogRingBuffer::Drain(Callback&& callback)
+    {
+        if (!m_buffer)
+        {
+            return 0;
+        }
+
+        uint32_t count = 0;
+        uint64_t readPos = m_readPos.load(std::memory_order_relaxed);
+        const uint64_t writePos = m_writePos.load(std::memory_order_acquire);
+
+        while (readPos != writePos)
+        {
+            RecordHeader* header = GetHeaderAt(readPos);
+            const uint32_t recordSize = std::atomic_ref<uint32_t>(header->committedSize).load(std::memory_order_acquire);
+            if (recordSize == 0)
+            {
+                // 예약만 되고 아직 커밋되지 않은 레코드 - 다음 Drain에서 처리
+                break;
+            }
+
+            if (header->payloadSize != kPaddingMarker)
+            {
+                callback(static_cast<const void*>(header + 1), header->payloadSize);
+                count++;
+            }
+
+            // 다음 랩에서 미커밋 상태로 읽히도록 영역을 0으로 지움
+            std::memset(header, 0, recordSize);
+
+            readPos += recordSize;
+            m_readPos.store(readPos, std::memory_order_release);
+        }
+
+        return count;
+    }
+}
@@ -0,0 +1,59 @@
+/**
+ * @file LogSink.h
+ * @brief 로그 출력 대상(싱크) 인터페이스
+ *
+ * Logger.cpp를 수정하지 않고 로그 출력 대상을 추가할 수 있도록 합니다.
+ * 싱크는 Logger::AddSink로 등록하며, 비동기 모드에서는 writer 스레드에서만 호출됩니다.
+ */
+
+#pragma once
+
+#include "LogTypes.h"
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 싱크에 전달되는 로그 레코드 (Write 호출 동안만 유효)
+     */
+    struct LogRecord
+    {
+        int64_t timestamp;              // system_clock 틱 (벽시계)
+        int64_t monotonicTimestamp;     // steady_clock 나노초 (프로세스 내 순서/간격 계산용)
+        uint64_t frameNumber;           // 기록 시점의 엔진 프레임 번호 (Logger::SetFrameNumber)
+        uint32_t threadId;              // 기록한 스레드 ID (Logger 내부 요약 레코드는 0)
+        LogLevel level;
+        LogCategory category;
+        std::wstring_view message;      // 포맷이 끝난 메시지
+    };
+
+    /**
+     * @brief 로그 싱크 인터페이스
+     *
+     * - 비동기 모드: writer 스레드에서 레코드마다 Write, 배치마다 Flush를 호출합니다.
+     *   호출자 스레드의 임계 구역에서는 실행되지 않습니다.
+     * - 동기 모드: 별도 writer가 없으므로 로그를 기록한 스레드에서 Logger 내부 락 밖에서 호출됩니다.
+     *   Flush는 Error 이상 로그와 종료 시에만 호출하므로 싱크가 스스로 버퍼를 비워야 합니다.
+     * 한 싱크의 Write/Flush가 동시에 호출되는 일은 없습니다.
+     */
+    class ILogSink
+    {
+    public:
+        virtual ~ILogSink() = default;
+
+        /**
+         * @brief 레코드 하나 기록
+         */
+        virtual void Write(const LogRecord& record) = 0;
+
+        /**
+         * @brief 버퍼에 모은 내용을 출력 (배치 끝, 종료 시)
+         */
+        virtual void Flush() {}
+    };
+
+    using LogSinkList = std::vector<std::shared_ptr<ILogSink>>;
+}
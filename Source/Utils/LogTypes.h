@@ -0,0 +1,87 @@
+/**
+ * @file LogTypes.h
+ * @brief 로그 레벨/카테고리 공용 타입
+ *
+ * Logger와 바이너리 로그 디코더가 함께 사용하는 기본 타입을 정의합니다.
+ * Windows/DirectX 의존성이 없습니다.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 로그 레벨
+     */
+    enum class LogLevel : uint8_t
+    {
+        Trace,      // 가장 상세한 디버깅 정보
+        Debug,      // 디버깅 정보
+        Info,       // 일반 정보
+        Warning,    // 경고
+        Error,      // 오류
+        Fatal       // 치명적 오류
+    };
+
+    /**
+     * @brief 로그 카테고리
+     */
+    enum class LogCategory : uint8_t
+    {
+        Engine,     // 엔진 코어
+        Renderer,   // 렌더링
+        Device,     // DirectX 디바이스
+        Window,     // 윈도우 시스템
+        Input,      // 입력 시스템
+        Resource,   // 리소스 관리
+        Shader,     // 셰이더
+        Memory,     // 메모리 관리
+        Core        // 기타 코어 시스템
+    };
+
+    /**
+     * @brief 로그 카테고리 수 (카테고리별 레벨 테이블 크기)
+     */
+    static constexpr uint32_t kLogCategoryCount = static_cast<uint32_t>(LogCategory::Core) + 1;
+
+    /**
+     * @brief 로그 레벨을 문자열로 변환 (5자 고정)
+     */
+    inline const wchar_t* LogLevelToString(LogLevel level)
+    {
+        // 5자 고정 폭
+        switch (level)
+        {
+        case LogLevel::Trace:   return L"TRACE";
+        case LogLevel::Debug:   return L"DEBUG";
+        case LogLevel::Info:    return L"INFO ";
+        case LogLevel::Warning: return L"WARN ";
+        case LogLevel::Error:   return L"ERROR";
+        case LogLevel::Fatal:   return L"FATAL";
+        default:                return L"?????";
+        }
+    }
+
+    /**
+     * @brief 로그 카테고리를 문자열로 변환 (8자 고정)
+     */
+    inline const wchar_t* LogCategoryToString(LogCategory category)
+    {
+        // 8자 고정 폭
+        switch (category)
+        {
+        case LogCategory::Engine:   return L"Engine  ";
+        case LogCategory::Renderer: return L"Renderer";
+        case LogCategory::Device:   return L"Device  ";
+        case LogCategory::Window:   return L"Window  ";
+        case LogCategory::Input:    return L"Input   ";
+        case LogCategory::Resource: return L"Resource";
+        case LogCategory::Shader:   return L"Shader  ";
+        case LogCategory::Memory:   return L"Memory  ";
+        case LogCategory::Core:     return L"Core    ";
+        default:                    return L"????????";
+        }
+    }
+}
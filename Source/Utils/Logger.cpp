@@ -9,14 +9,141 @@
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <Windows.h>
-#include <chrono>
+#include <algorithm>
 #include <iomanip>
+#include <climits>
+#include <ctime>
 #include <sstream>
 #include <filesystem>
 #include <iostream>
+#include <cstring>
 
 namespace DX12GameEngine
 {
+    namespace
+    {
+        // writer 스레드가 한 번에 모아서 출력할 배치 크기 기준
+        constexpr size_t kWriterBatchReserve = 64 * 1024;
+
+        // "[YYYY-MM-DD HH:MM:SS.mmm][LEVEL][Category] " + 메시지 + "\n" + 널
+        constexpr size_t kLogLinePrefixLength = 43;
+        constexpr size_t kMaxLogLineLength = kLogLinePrefixLength + kMaxLogMessageLength + 2;
+
+        // "YYYY-MM-DD HH:MM:SS"
+        constexpr size_t kTimestampSecondsLength = 19;
+
+        /**
+         * @brief 초 단위 날짜/시각 문자열 캐시 (스레드별)
+         *
+         * localtime_s 변환은 초가 바뀔 때만 수행하고 밀리초 3자리는 매번 덧붙입니다.
+         */
+        struct TimestampCache
+        {
+            int64_t second = INT64_MIN;
+            wchar_t text[kTimestampSecondsLength];
+        };
+
+        thread_local TimestampCache t_timestampCache;
+        thread_local wchar_t t_formatBuffer[kMaxLogMessageLength];
+        thread_local wchar_t t_lineBuffer[kMaxLogLineLength];
+
+        const wchar_t* GetCachedTimestamp(int64_t second)
+        {
+            TimestampCache& cache = t_timestampCache;
+            if (cache.second != second)
+            {
+                const std::time_t timeT = static_cast<std::time_t>(second);
+                std::tm localTime;
+                localtime_s(&localTime, &timeT);
+
+                std::format_to_n(cache.text, kTimestampSecondsLength, L"{:04}-{:02}-{:02} {:02}:{:02}:{:02}",
+                                 localTime.tm_year + 1900, localTime.tm_mon + 1, localTime.tm_mday,
+                                 localTime.tm_hour, localTime.tm_min, localTime.tm_sec);
+                cache.second = second;
+            }
+            return cache.text;
+        }
+
+        /**
+         * @brief 고정 버퍼에 문자열 추가 (공간이 부족하면 잘림)
+         */
+        wchar_t* AppendText(wchar_t* dst, const wchar_t* end, std::wstring_view text)
+        {
+            const size_t count = std::min(text.size(), static_cast<size_t>(end - dst));
+            std::memcpy(dst, text.data(), count * sizeof(wchar_t));
+            return dst + count;
+        }
+
+        thread_local uint32_t t_threadId = 0;
+
+        /**
+         * @brief 호출 스레드 ID (스레드당 한 번만 조회)
+         */
+        uint32_t GetCachedThreadId()
+        {
+            if (t_threadId == 0)
+            {
+                t_threadId = static_cast<uint32_t>(GetCurrentThreadId());
+            }
+            return t_threadId;
+        }
+
+        /**
+         * @brief 단조 증가 시각 (steady_clock 나노초)
+         */
+        int64_t GetMonotonicTimestamp()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        // 반복 병합 요약 메시지 버퍼 크기 (문자 수)
+        constexpr size_t kRepeatSummaryLength = 96;
+
+        /**
+         * @brief 반복 병합 요약 메시지 포맷 (호출자 버퍼 사용, 스레드 포맷 버퍼를 덮어쓰지 않음)
+         */
+        std::wstring_view FormatRepeatSummary(wchar_t (&buffer)[kRepeatSummaryLength], uint32_t count, int64_t duration)
+        {
+            const int64_t durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::duration(duration)).count();
+            const auto result = std::format_to_n(buffer, kRepeatSummaryLength - 1,
+                                                 L"(previous message repeated x{} over {} ms)", count, durationMs);
+            *result.out = L'\0';
+            return std::wstring_view(buffer, static_cast<size_t>(result.out - buffer));
+        }
+
+        // 동기 경로 요약 메시지 버퍼 (m_mutex를 놓은 뒤 싱크에 전달할 때까지 유지)
+        thread_local wchar_t t_repeatSummaryBuffer[kRepeatSummaryLength];
+
+        /**
+         * @brief 병합 중인 반복을 새 메시지 없이도 출력할 때가 되었는지 여부
+         */
+        bool IsRepeatSummaryDue(const LogRepeatTracker& tracker, int64_t now)
+        {
+            const int64_t maxPending = std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::milliseconds(LogRepeatTracker::kMaxPendingMs)).count();
+            return tracker.GetRepeatCount() > 0 && now - tracker.GetFirstRepeatTimestamp() >= maxPending;
+        }
+    }
+
+    std::filesystem::path Logger::GetLogDirectory()
+    {
+        // 실행 파일 경로에서 Build/Logs 폴더 경로 계산
+        wchar_t exePath[MAX_PATH];
+        GetModuleFileNameW(nullptr, exePath, MAX_PATH);
+
+        std::filesystem::path logsDir = std::filesystem::path(exePath).parent_path().parent_path().parent_path() / L"Logs";
+        std::error_code error;
+        std::filesystem::create_directories(logsDir, error);
+        return logsDir;
+    }
+
+    wchar_t* Logger::GetThreadFormatBuffer()
+    {
+        return t_formatBuffer;
+    }
+
     Logger& Logger::Get()
     {
         static Logger instance;
@@ -30,165 +157,992 @@ namespace DX12GameEngine
 
     void Logger::Initialize(LogLevel minLevel, bool logToFile, const std::wstring& logFilePrefix)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        LoggerDesc desc;
+        desc.minLevel = minLevel;
+        desc.logToFile = logToFile;
+        desc.logToConsole = BUILD_DEFAULT(LogToConsole);
+        desc.logFilePrefix = logFilePrefix;
+        Initialize(desc);
+    }
+
+    void Logger::Initialize(const LoggerDesc& desc)
+    {
+        bool startWriter = false;
 
-        if (m_initialized)
         {
-            return;
-        }
+            std::lock_guard<std::mutex> lock(m_mutex);
 
-        m_minLevel = minLevel;
-        m_logToFile = logToFile;
+            if (m_initialized)
+            {
+                return;
+            }
 
-        // 콘솔 로그 활성화 시 콘솔 창 할당
-        if constexpr (BUILD_DEFAULT(LogToConsole))
-        {
-            if (AllocConsole())
+            SetMinLevel(desc.minLevel);
+            m_logToFile = desc.logToFile;
+            m_logToConsole = desc.logToConsole;
+            m_deferredFormatting = desc.deferredFormatting;
+            m_coalesceRepeats = desc.coalesceRepeats;
+
+            // 비교 기준 버퍼를 최대 메시지 크기로 미리 확보
+            m_syncRepeats.Reserve(kMaxLogMessageLength * sizeof(wchar_t));
+            m_writerRepeats.Reserve(kMaxLogMessageLength * sizeof(wchar_t));
+
+            // 콘솔 로그 활성화 시 콘솔 창 할당
+            if (m_logToConsole)
             {
-                FILE* fp = nullptr;
-                freopen_s(&fp, "CONOUT$", "w", stdout);
-                freopen_s(&fp, "CONOUT$", "w", stderr);
-                std::wcout.clear();
-                std::wcerr.clear();
+                if (AllocConsole())
+                {
+                    FILE* fp = nullptr;
+                    freopen_s(&fp, "CONOUT$", "w", stdout);
+                    freopen_s(&fp, "CONOUT$", "w", stderr);
+                    std::wcout.clear();
+                    std::wcerr.clear();
+                }
+            }
+
+            if (desc.mode == LogMode::Asynchronous)
+            {
+                m_overflowPolicy = desc.overflowPolicy;
+                m_flushInterval = std::chrono::milliseconds(std::max<uint32_t>(desc.flushIntervalMs, 1));
+
+                startWriter = m_ringBuffer.Initialize(desc.bufferSize);
+                if (!startWriter)
+                {
+                    std::wcerr << L"[Logger] Warning: Failed to create async buffer, using synchronous mode\n";
+                }
+            }
+
+            // 바이너리 파일은 writer 스레드가 기록하므로 비동기 모드에서만 사용
+            m_fileFormat = desc.fileFormat;
+            if (m_fileFormat == LogFileFormat::Binary && !startWriter)
+            {
+                std::wcerr << L"[Logger] Warning: Binary log file requires asynchronous mode, using text format\n";
+                m_fileFormat = LogFileFormat::Text;
+            }
+
+            // 타임스탬프 파일명 생성 (텍스트/바이너리 로그와 싱크 파일이 같은 이름을 공유)
+            {
+                auto now = std::chrono::system_clock::now();
+                auto time = std::chrono::system_clock::to_time_t(now);
+                std::tm localTime;
+                localtime_s(&localTime, &time);
+
+                std::wstringstream ss;
+                ss << std::put_time(&localTime, L"%Y-%m-%d_%H-%M-%S");
+                m_logFileBaseName = desc.logFilePrefix + L"_" + ss.str();
             }
+
+            if (m_logToFile)
+            {
+                OpenLogFile(desc);
+            }
+
+            if (desc.enableFlightRecorder)
+            {
+                FlightRecorderDesc flightRecorderDesc;
+                flightRecorderDesc.directory = GetLogDirectory();
+                flightRecorderDesc.filePrefix = desc.logFilePrefix;
+                FlightRecorder::Get().Initialize(flightRecorderDesc);
+            }
+
+            m_initialized = true;
         }
 
-        if (logToFile)
+        if (startWriter)
         {
-            // 실행 파일 경로에서 Build/Logs 폴더 경로 계산
-            wchar_t exePath[MAX_PATH];
-            GetModuleFileNameW(nullptr, exePath, MAX_PATH);
+            StartWriterThread();
+        }
+    }
 
-            std::filesystem::path logsDir = std::filesystem::path(exePath).parent_path().parent_path().parent_path() / L"Logs";
-            std::filesystem::create_directories(logsDir);
+    void Logger::SetMinLevel(LogLevel level)
+    {
+        m_minLevel = level;
 
-            // 타임스탬프 파일명 생성
-            auto now = std::chrono::system_clock::now();
-            auto time = std::chrono::system_clock::to_time_t(now);
-            std::tm localTime;
-            localtime_s(&localTime, &time);
+        for (std::atomic<uint8_t>& categoryLevel : s_categoryLevels)
+        {
+            categoryLevel.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+        }
+    }
+
+    void Logger::OpenLogFile(const LoggerDesc& desc)
+    {
+        const std::filesystem::path logsDir = GetLogDirectory();
+
+        // writer 배치 최대 크기의 UTF-8 변환 공간 (문자당 최대 3바이트)
+        if (m_fileFormat == LogFileFormat::Text)
+        {
+            m_utf8Buffer.resize((kWriterBatchReserve + kMaxLogLineLength) * 3);
+        }
+
+        // 메모리 맵 회전 세그먼트
+        if (desc.fileSegmentSize > 0)
+        {
+            MappedLogFileDesc mappedDesc;
+            mappedDesc.directory = logsDir;
+            mappedDesc.baseName = m_logFileBaseName;
+            mappedDesc.segmentSize = desc.fileSegmentSize;
+            mappedDesc.maxSegments = desc.maxFileSegments;
+
+            if (m_fileFormat == LogFileFormat::Binary)
+            {
+                mappedDesc.extension = L".mblog";
+                mappedDesc.content = MappedLogContent::Binary;
+            }
+            else
+            {
+                mappedDesc.extension = L".mlog";
+                mappedDesc.content = MappedLogContent::Text;
+            }
 
-            std::wstringstream ss;
-            ss << std::put_time(&localTime, L"%Y-%m-%d_%H-%M-%S");
-            std::wstring timestamp = ss.str();
+            if (m_mappedLogFile.Open(mappedDesc))
+            {
+                m_writtenFormatIds.clear();
+                if (m_fileFormat == LogFileFormat::Binary)
+                {
+                    std::vector<uint8_t> header;
+                    BinaryLogWriter::AppendFileHeader(header);
+                    m_mappedLogFile.Write(header.data(), header.size());
+                }
+                return;
+            }
+        }
+        else if (m_fileFormat == LogFileFormat::Binary)
+        {
+            std::filesystem::path fullLogPath = logsDir / (m_logFileBaseName + L".blog");
 
-            std::filesystem::path fullLogPath = logsDir / (logFilePrefix + L"_" + timestamp + L".log");
+            m_binaryLogFile.open(fullLogPath, std::ios::out | std::ios::trunc | std::ios::binary);
+            if (m_binaryLogFile.is_open())
+            {
+                std::vector<uint8_t> header;
+                BinaryLogWriter::AppendFileHeader(header);
+                WriteBinaryOutput(header);
+                m_writtenFormatIds.clear();
+                return;
+            }
+        }
+        else
+        {
+            std::filesystem::path fullLogPath = logsDir / (m_logFileBaseName + L".log");
 
-            m_logFile.open(fullLogPath, std::ios::out | std::ios::trunc);
-            if (!m_logFile.is_open())
+            m_logFile.open(fullLogPath, std::ios::out | std::ios::trunc | std::ios::binary);
+            if (m_logFile.is_open())
             {
-                std::wcerr << L"[Logger] Warning: Failed to open log file\n";
-                m_logToFile = false;
+                return;
             }
         }
 
-        m_initialized = true;
+        std::wcerr << L"[Logger] Warning: Failed to open log file\n";
+        m_logToFile = false;
     }
 
     void Logger::Shutdown()
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        // 남은 레코드를 모두 기록한 뒤 writer 종료 (m_mutex를 잡기 전에 수행)
+        StopWriterThread();
 
-        if (!m_initialized)
+        LogRecord summary = {};
+        bool hasSummary = false;
         {
-            return;
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (!m_initialized)
+            {
+                return;
+            }
+
+            hasSummary = WriteRepeatSummary(summary);
+            m_syncRepeats.Clear();
+        }
+
+        // 남은 요약을 전달하고 싱크 해제 (파일 싱크는 소멸 시 닫힘)
+        DispatchSyncRecords(hasSummary ? &summary : nullptr, nullptr, true);
+        {
+            std::lock_guard<std::mutex> sinkLock(m_sinkMutex);
+            m_sinks.reset();
         }
 
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         if (m_logFile.is_open())
         {
             m_logFile.close();
         }
 
+        if (m_binaryLogFile.is_open())
+        {
+            m_binaryLogFile.close();
+        }
+
+        m_mappedLogFile.Close();
+        FlightRecorder::Get().Shutdown();
+
         m_initialized = false;
     }
 
-    void Logger::Log(LogLevel level, LogCategory category, const std::wstring& message)
+    void Logger::Log(LogLevel level, LogCategory category, std::wstring_view message)
     {
-        if (level < m_minLevel)
+        if (!IsEnabled(level, category))
         {
             return;
         }
 
-        std::wstring formattedMessage = FormatLogMessage(level, category, message);
+        // 오류 직전의 Trace/Debug 맥락 덤프
+        if (level >= LogLevel::Error)
+        {
+            FlightRecorder::Get().DumpOnError(level, category);
+        }
 
-        std::lock_guard<std::mutex> lock(m_mutex);
+        // 비동기 모드: 링 버퍼에 넣고 즉시 반환
+        if (m_asyncRunning.load(std::memory_order_acquire) && EnqueueRecord(level, category, message))
+        {
+            return;
+        }
+
+        const auto now = std::chrono::system_clock::now();
+        const LogRecord record = { now.time_since_epoch().count(), GetMonotonicTimestamp(),
+                                   s_frameNumber.load(std::memory_order_relaxed), GetCachedThreadId(),
+                                   level, category, message };
+
+        LogRecord summary = {};
+        bool hasSummary = false;
+        bool isRepeat = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // 직전 메시지와 같으면 세기만 하고, 오래 쌓였으면 요약만 출력
+            if (m_coalesceRepeats)
+            {
+                const int64_t timestamp = now.time_since_epoch().count();
+                isRepeat = m_syncRepeats.IsRepeat(level, category, kInvalidLogFormatId,
+                                                  message.data(), message.size() * sizeof(wchar_t), timestamp);
+                if (isRepeat)
+                {
+                    if (IsRepeatSummaryDue(m_syncRepeats, timestamp))
+                    {
+                        hasSummary = WriteRepeatSummary(summary);
+                    }
+                }
+                else
+                {
+                    hasSummary = WriteRepeatSummary(summary);
+                    m_syncRepeats.SetLast(level, category, kInvalidLogFormatId,
+                                          message.data(), message.size() * sizeof(wchar_t), timestamp);
+                }
+            }
+
+            if (!isRepeat)
+            {
+                const size_t lineLength = FormatLogLine(t_lineBuffer, kMaxLogLineLength, now, level, category, message);
+                WriteOutput(t_lineBuffer, lineLength);
+
+                if (m_logToFile && m_logFile.is_open())
+                {
+                    m_logFile.flush();
+                }
+
+                // writer 종료 중 동기 경로로 넘어온 메시지도 바이너리 파일에 남김
+                if (m_logToFile && m_fileFormat == LogFileFormat::Binary)
+                {
+                    std::vector<uint8_t> bytes;
+                    BinaryLogWriter::AppendText(bytes, level, category, now.time_since_epoch().count(), message);
+                    WriteBinaryOutput(bytes);
+
+                    if (m_binaryLogFile.is_open())
+                    {
+                        m_binaryLogFile.flush();
+                    }
+                }
+            }
+        }
+
+        // 동기 모드에는 writer가 없으므로 호출 스레드가 싱크까지 처리 (m_mutex 밖에서)
+        // 줄마다 flush하지 않고 싱크 자체 버퍼링에 맡기며, 오류 이상만 바로 flush
+        if (hasSummary || !isRepeat)
+        {
+            DispatchSyncRecords(hasSummary ? &summary : nullptr, isRepeat ? nullptr : &record,
+                                level >= LogLevel::Error);
+        }
+    }
+
+    void Logger::DispatchSyncRecords(const LogRecord* summary, const LogRecord* record, bool flush)
+    {
+        const std::shared_ptr<const LogSinkList> sinks = GetSinks();
+        if (!sinks)
+        {
+            return;
+        }
+
+        // 한 싱크의 Write/Flush가 겹치지 않도록 직렬화 (m_mutex와 달리 파일/콘솔 출력을 막지 않음)
+        std::lock_guard<std::mutex> lock(m_sinkDispatchMutex);
+
+        if (summary)
+        {
+            DispatchToSinks(sinks.get(), *summary);
+        }
+
+        if (record)
+        {
+            DispatchToSinks(sinks.get(), *record);
+        }
+
+        if (flush)
+        {
+            FlushSinks(sinks.get());
+        }
+    }
+
+    bool Logger::EnqueueRecord(LogLevel level, LogCategory category, std::wstring_view message)
+    {
+        // writer 종료가 시작되었으면 링 버퍼를 건드리지 않고 동기 경로로 처리
+        ProducerScope producer(*this);
+        if (!producer.IsAsync())
+        {
+            return false;
+        }
 
+        const size_t maxLength = std::min(kMaxLogMessageLength,
+            (m_ringBuffer.GetMaxPayloadSize() - sizeof(AsyncRecord)) / sizeof(wchar_t));
+        const uint32_t length = static_cast<uint32_t>(std::min(message.size(), maxLength));
+        const uint32_t payloadSize = static_cast<uint32_t>(sizeof(AsyncRecord) + length * sizeof(wchar_t));
+
+        bool dropped = false;
+        void* payload = ReserveRecord(payloadSize, dropped);
+        if (!payload)
+        {
+            return dropped;
+        }
+
+        AsyncRecord* record = static_cast<AsyncRecord*>(payload);
+        FillRecordHeader(record, level, category, kInvalidLogFormatId, length);
+        std::memcpy(record + 1, message.data(), length * sizeof(wchar_t));
+
+        CommitRecord(payload, level);
+        return true;
+    }
+
+    void Logger::FillRecordHeader(AsyncRecord* record, LogLevel level, LogCategory category,
+                                  uint32_t formatId, uint32_t length)
+    {
+        record->timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+        record->monotonicTimestamp = GetMonotonicTimestamp();
+        record->frameNumber = s_frameNumber.load(std::memory_order_relaxed);
+        record->length = length;
+        record->formatId = formatId;
+        record->threadId = GetCachedThreadId();
+        record->level = level;
+        record->category = category;
+    }
+
+    void* Logger::ReserveRecord(uint32_t payloadSize, bool& dropped)
+    {
+        dropped = false;
+
+        void* payload = m_ringBuffer.TryReserve(payloadSize);
+        while (!payload)
+        {
+            switch (m_overflowPolicy)
+            {
+            case LogOverflowPolicy::Drop:
+                m_totalDroppedCount.fetch_add(1, std::memory_order_relaxed);
+                dropped = true;
+                return nullptr;
+
+            case LogOverflowPolicy::DropAndCount:
+                m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+                m_totalDroppedCount.fetch_add(1, std::memory_order_relaxed);
+                dropped = true;
+                return nullptr;
+
+            case LogOverflowPolicy::Block:
+            default:
+                // writer가 종료 중이면 동기 경로로 처리
+                if (!m_asyncRunning.load(std::memory_order_acquire))
+                {
+                    return nullptr;
+                }
+                WakeWriterThread();
+                std::this_thread::yield();
+                payload = m_ringBuffer.TryReserve(payloadSize);
+                break;
+            }
+        }
+
+        return payload;
+    }
+
+    void Logger::CommitRecord(void* payload, LogLevel level)
+    {
+        m_ringBuffer.Commit(payload);
+
+        // 오류 이상은 지연 없이 기록되도록 즉시 깨움
+        if (level >= LogLevel::Error)
+        {
+            WakeWriterThread();
+        }
+    }
+
+    void Logger::WriteOutput(const wchar_t* text, size_t length)
+    {
         // 콘솔 출력 (Debug 빌드)
-        if constexpr (BUILD_DEFAULT(LogToConsole))
+        if (m_logToConsole)
         {
-            std::wcout << formattedMessage;
+            std::wcout.write(text, static_cast<std::streamsize>(length));
         }
         else
         {
             // Release 빌드: IDE 디버그 출력 창
-            OutputDebugStringW(formattedMessage.c_str());
+            OutputDebugStringW(text);
+        }
+
+        // 파일 출력 - UTF-8 바이트로 변환해 기록 (flush는 호출자가 결정)
+        const bool textFileOpen = m_logFile.is_open() ||
+                                  (m_mappedLogFile.IsOpen() && m_fileFormat == LogFileFormat::Text);
+        if (m_logToFile && textFileOpen && length > 0)
+        {
+            const int sourceLength = static_cast<int>(length);
+            const int utf8Length = WideCharToMultiByte(CP_UTF8, 0, text, sourceLength, nullptr, 0, nullptr, nullptr);
+            if (utf8Length > 0)
+            {
+                // 용량을 재사용하므로 워밍업 이후에는 할당이 없음
+                if (m_utf8Buffer.size() < static_cast<size_t>(utf8Length))
+                {
+                    m_utf8Buffer.resize(static_cast<size_t>(utf8Length));
+                }
+
+                WideCharToMultiByte(CP_UTF8, 0, text, sourceLength, m_utf8Buffer.data(), utf8Length, nullptr, nullptr);
+                WriteTextFileBytes(m_utf8Buffer.data(), static_cast<size_t>(utf8Length));
+            }
+        }
+    }
+
+    void Logger::WriteTextFileBytes(const char* data, size_t size)
+    {
+        if (!m_mappedLogFile.IsOpen())
+        {
+            m_logFile.write(data, static_cast<std::streamsize>(size));
+            return;
+        }
+
+        // 빈 세그먼트에 들어가는 기록은 줄이 잘리지 않도록 통째로 다음 세그먼트에 기록
+        if (size > m_mappedLogFile.GetRemaining() && size <= m_mappedLogFile.GetCapacity())
+        {
+            if (!RotateMappedLogFile())
+            {
+                return;
+            }
+        }
+
+        // 세그먼트보다 큰 기록은 세그먼트 단위로 나눠 기록
+        while (size > 0)
+        {
+            if (m_mappedLogFile.GetRemaining() == 0 && !RotateMappedLogFile())
+            {
+                return;
+            }
+
+            const size_t chunk = static_cast<size_t>(std::min<uint64_t>(size, m_mappedLogFile.GetRemaining()));
+            m_mappedLogFile.Write(data, chunk);
+            data += chunk;
+            size -= chunk;
+        }
+    }
+
+    bool Logger::RotateMappedLogFile()
+    {
+        if (!m_mappedLogFile.Rotate())
+        {
+            m_logToFile = false;
+            return false;
+        }
+
+        // 바이너리 세그먼트는 단독으로 디코딩할 수 있도록 헤더와 지금까지의 포맷 정의를 다시 기록
+        if (m_fileFormat == LogFileFormat::Binary)
+        {
+            std::vector<uint8_t> bytes;
+            BinaryLogWriter::AppendFileHeader(bytes);
+
+            for (uint32_t formatId = 0; formatId < m_writtenFormatIds.size(); formatId++)
+            {
+                const LogFormatInfo* info = m_writtenFormatIds[formatId] ? LogFormatRegistry::Find(formatId) : nullptr;
+                if (info)
+                {
+                    BinaryLogWriter::AppendFormatDefinition(bytes, formatId, *info);
+                }
+            }
+
+            m_mappedLogFile.Write(bytes.data(), bytes.size());
+        }
+
+        return true;
+    }
+
+    void Logger::WriteBinaryOutput(const std::vector<uint8_t>& bytes)
+    {
+        if (m_mappedLogFile.IsOpen())
+        {
+            // 엔트리가 세그먼트 경계에 걸치지 않도록 배치 단위로 회전
+            // (배치는 writer가 kWriterBatchReserve 근처에서 끊으므로 최소 세그먼트 크기보다 작음)
+            if (bytes.size() > m_mappedLogFile.GetRemaining() && !RotateMappedLogFile())
+            {
+                return;
+            }
+
+            m_mappedLogFile.Write(bytes.data(), bytes.size());
+            return;
         }
 
-        // 파일 출력
-        if (m_logToFile && m_logFile.is_open())
+        if (m_binaryLogFile.is_open())
+        {
+            m_binaryLogFile.write(reinterpret_cast<const char*>(bytes.data()),
+                                  static_cast<std::streamsize>(bytes.size()));
+        }
+    }
+
+    void Logger::StartWriterThread()
+    {
+        m_stopRequested.store(false, std::memory_order_relaxed);
+        m_wakeRequested.store(false, std::memory_order_relaxed);
+        m_droppedCount.store(0, std::memory_order_relaxed);
+
+        m_writerThread = std::thread(&Logger::WriterThreadMain, this);
+        m_asyncRunning.store(true, std::memory_order_release);
+
+        // Error/Fatal 로그의 플라이트 레코더 덤프는 writer가 기록
+        FlightRecorder::Get().SetDeferredDumpsEnabled(true);
+    }
+
+    void Logger::StopWriterThread()
+    {
+        if (!m_writerThread.joinable())
+        {
+            return;
+        }
+
+        // 이후 호출은 동기 경로로 처리
+        m_asyncRunning.store(false, std::memory_order_seq_cst);
+
+        // 이미 링 버퍼에 예약한 생산자가 커밋을 마칠 때까지 대기
+        // (Block 정책의 대기 루프는 m_asyncRunning을 보고 빠져나오며, writer는 아직 비우는 중)
+        // ProducerScope와 같은 seq_cst 순서에 있어야 store 이전에 비동기로 들어온 생산자를 놓치지 않음
+        while (m_activeProducers.load(std::memory_order_seq_cst) != 0)
+        {
+            std::this_thread::yield();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_stopRequested.store(true, std::memory_order_release);
+        }
+        m_wakeCondition.notify_one();
+
+        // writer는 종료 전에 커밋된 레코드를 모두 비움 (마지막 드레인)
+        m_writerThread.join();
+        m_ringBuffer.Release();
+
+        // writer의 마지막 처리 이후 예약된 덤프는 여기서 기록
+        FlightRecorder::Get().SetDeferredDumpsEnabled(false);
+        FlightRecorder::Get().ProcessPendingDump();
+    }
+
+    void Logger::WakeWriterThread()
+    {
+        // 락 없이 통지 - 깨우기를 놓쳐도 최대 m_flushInterval 이내에 처리됨
+        if (!m_wakeRequested.exchange(true, std::memory_order_acq_rel))
+        {
+            m_wakeCondition.notify_one();
+        }
+    }
+
+    void Logger::WriterThreadMain()
+    {
+        std::wstring batch;
+        batch.reserve(kWriterBatchReserve);
+
+        std::vector<uint8_t> binaryBatch;
+        binaryBatch.reserve(kWriterBatchReserve);
+
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_wakeMutex);
+                m_wakeCondition.wait_for(lock, m_flushInterval, [this]() {
+                    return m_stopRequested.load(std::memory_order_acquire) ||
+                           m_wakeRequested.load(std::memory_order_acquire);
+                });
+            }
+            m_wakeRequested.store(false, std::memory_order_release);
+
+            const bool stopping = m_stopRequested.load(std::memory_order_acquire);
+
+            // 텍스트 출력 대상이 없으면 지연 포맷 레코드를 문자열로 만들지 않음
+            const bool formatText = m_logToConsole || IsDebuggerPresent() ||
+                                    (m_logToFile && m_fileFormat == LogFileFormat::Text);
+
+            // 종료 시에는 예약된 레코드가 모두 커밋될 때까지 반복해서 비움
+            do
+            {
+                {
+                    // 종료 중 동기 경로로 넘어온 호출자와 싱크 호출이 겹치지 않게 함
+                    std::lock_guard<std::mutex> dispatchLock(m_sinkDispatchMutex);
+
+                    const uint32_t drainedCount = DrainRecords(batch, binaryBatch, formatText);
+
+                    // 같은 메시지가 계속 반복 중이어도 주기적으로 요약 출력
+                    if (stopping || IsRepeatSummaryDue(m_writerRepeats, std::chrono::system_clock::now().time_since_epoch().count()))
+                    {
+                        AppendRepeatSummary(batch, binaryBatch, formatText,
+                                            m_logToFile && m_fileFormat == LogFileFormat::Binary);
+                    }
+
+                    if (drainedCount > 0 || !batch.empty())
+                    {
+                        FlushSinks(m_writerSinks.get());
+                    }
+                }
+
+                if (!batch.empty() || !binaryBatch.empty())
+                {
+                    // 배치당 한 번만 flush
+                    WriteBatch(batch, binaryBatch, true);
+                }
+                else if (stopping && !m_ringBuffer.IsEmpty())
+                {
+                    std::this_thread::yield();
+                }
+            } while (stopping && !m_ringBuffer.IsEmpty());
+
+            // 오류를 남긴 스레드 대신 플라이트 레코더 덤프 기록
+            FlightRecorder::Get().ProcessPendingDump();
+
+            if (stopping)
+            {
+                break;
+            }
+        }
+    }
+
+    void Logger::WriteBatch(std::wstring& batch, std::vector<uint8_t>& binaryBatch, bool flush)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!batch.empty())
+        {
+            WriteOutput(batch.c_str(), batch.size());
+        }
+
+        if (!binaryBatch.empty())
+        {
+            WriteBinaryOutput(binaryBatch);
+        }
+
+        if (flush && m_logToFile && m_logFile.is_open())
         {
-            m_logFile << formattedMessage;
             m_logFile.flush();
         }
+
+        if (flush && m_logToFile && m_binaryLogFile.is_open())
+        {
+            m_binaryLogFile.flush();
+        }
+
+        // 용량은 유지 (워밍업 이후 재할당 없음)
+        batch.clear();
+        binaryBatch.clear();
     }
 
-    std::wstring Logger::FormatLogMessage(LogLevel level, LogCategory category, const std::wstring& message)
+    uint32_t Logger::DrainRecords(std::wstring& batch, std::vector<uint8_t>& binaryBatch, bool formatText)
+    {
+        const bool writeBinary = m_logToFile && m_fileFormat == LogFileFormat::Binary;
+
+        // 배치마다 싱크 목록 스냅샷을 한 번만 잡음 (이후 락 없이 순회)
+        m_writerSinks = GetSinks();
+        const LogSinkList* sinks = m_writerSinks.get();
+        const bool formatMessage = formatText || sinks;
+
+        const uint32_t count = m_ringBuffer.Drain([&](const void* payload, uint32_t payloadSize) {
+            // 배치가 예약 용량을 넘기 전에 중간 기록 (버퍼가 커지지 않도록)
+            if (batch.size() + kMaxLogLineLength > batch.capacity() ||
+                binaryBatch.size() + payloadSize + sizeof(AsyncRecord) > binaryBatch.capacity())
+            {
+                WriteBatch(batch, binaryBatch, false);
+            }
+
+            const AsyncRecord* record = static_cast<const AsyncRecord*>(payload);
+            const std::chrono::system_clock::time_point time{
+                std::chrono::system_clock::duration(record->timestamp) };
+            const uint8_t* data = reinterpret_cast<const uint8_t*>(record + 1);
+
+            // 직전 레코드와 바이트 단위로 같으면 포맷하지 않고 세기만 함
+            if (m_coalesceRepeats)
+            {
+                const size_t dataSize = record->formatId == kInvalidLogFormatId
+                    ? record->length * sizeof(wchar_t) : record->length;
+
+                if (m_writerRepeats.IsRepeat(record->level, record->category, record->formatId,
+                                             data, dataSize, record->timestamp))
+                {
+                    return;
+                }
+
+                AppendRepeatSummary(batch, binaryBatch, formatText, writeBinary);
+                m_writerRepeats.SetLast(record->level, record->category, record->formatId,
+                                        data, dataSize, record->timestamp);
+            }
+
+            if (record->formatId == kInvalidLogFormatId)
+            {
+                const std::wstring_view message(reinterpret_cast<const wchar_t*>(data), record->length);
+
+                if (writeBinary)
+                {
+                    BinaryLogWriter::AppendText(binaryBatch, record->level, record->category,
+                                                record->timestamp, message);
+                }
+
+                if (formatText)
+                {
+                    AppendLogMessage(batch, time, record->level, record->category, message);
+                }
+
+                if (sinks)
+                {
+                    DispatchToSinks(sinks, { record->timestamp, record->monotonicTimestamp, record->frameNumber,
+                                             record->threadId, record->level, record->category, message });
+                }
+                return;
+            }
+
+            const LogFormatInfo* info = LogFormatRegistry::Find(record->formatId);
+            if (!info)
+            {
+                return;
+            }
+
+            if (writeBinary)
+            {
+                // 포맷 문자열은 ID별로 처음 한 번만 기록
+                if (record->formatId >= m_writtenFormatIds.size())
+                {
+                    m_writtenFormatIds.resize(record->formatId + 1, false);
+                }
+
+                if (!m_writtenFormatIds[record->formatId])
+                {
+                    BinaryLogWriter::AppendFormatDefinition(binaryBatch, record->formatId, *info);
+                    m_writtenFormatIds[record->formatId] = true;
+                }
+
+                BinaryLogWriter::AppendMessage(binaryBatch, record->level, record->category,
+                                               record->timestamp, record->formatId, data, record->length);
+            }
+
+            if (formatMessage)
+            {
+                m_scratchMessage.clear();
+                FormatDeferredLogMessage(*info, data, record->length, m_scratchMessage);
+
+                if (formatText)
+                {
+                    AppendLogMessage(batch, time, record->level, record->category, m_scratchMessage);
+                }
+
+                if (sinks)
+                {
+                    DispatchToSinks(sinks, { record->timestamp, record->monotonicTimestamp, record->frameNumber,
+                                             record->threadId, record->level, record->category, m_scratchMessage });
+                }
+            }
+        });
+
+        // 버퍼 오버플로로 버려진 로그 요약
+        const uint64_t dropped = m_droppedCount.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0)
+        {
+            const std::wstring_view message = FormatToThreadBuffer(L"[Logger] Async buffer full, dropped {} messages", dropped);
+            const auto now = std::chrono::system_clock::now();
+
+            if (writeBinary)
+            {
+                BinaryLogWriter::AppendText(binaryBatch, LogLevel::Warning, LogCategory::Core,
+                                            now.time_since_epoch().count(), message);
+            }
+
+            AppendLogMessage(batch, now, LogLevel::Warning, LogCategory::Core, message);
+
+            if (sinks)
+            {
+                DispatchToSinks(sinks, { now.time_since_epoch().count(), GetMonotonicTimestamp(),
+                                         s_frameNumber.load(std::memory_order_relaxed), 0,
+                                         LogLevel::Warning, LogCategory::Core, message });
+            }
+        }
+
+        return count;
+    }
+
+    size_t Logger::FormatLogLine(wchar_t* buffer, size_t capacity, std::chrono::system_clock::time_point time,
+                                 LogLevel level, LogCategory category, std::wstring_view message)
     {
         // 포맷: [2026-01-20 22:30:15.123][INFO ][Engine  ] Message
-        std::wstringstream ss;
-        ss << L"[" << GetTimestamp() << L"]"
-           << L"[" << LogLevelToString(level) << L"]"
-           << L"[" << LogCategoryToString(category) << L"] "
-           << message << L"\n";
-        return ss.str();
+        const int64_t totalMs = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+        const int64_t second = totalMs >= 0 ? totalMs / 1000 : (totalMs - 999) / 1000;
+        const uint32_t ms = static_cast<uint32_t>(totalMs - second * 1000);
+
+        const wchar_t msDigits[3] = {
+            static_cast<wchar_t>(L'0' + ms / 100),
+            static_cast<wchar_t>(L'0' + ms / 10 % 10),
+            static_cast<wchar_t>(L'0' + ms % 10) };
+
+        wchar_t* dst = buffer;
+        const wchar_t* end = buffer + capacity - 1;     // 널 문자 자리
+
+        dst = AppendText(dst, end, L"[");
+        dst = AppendText(dst, end, std::wstring_view(GetCachedTimestamp(second), kTimestampSecondsLength));
+        dst = AppendText(dst, end, L".");
+        dst = AppendText(dst, end, std::wstring_view(msDigits, 3));
+        dst = AppendText(dst, end, L"][");
+        dst = AppendText(dst, end, LogLevelToString(level));
+        dst = AppendText(dst, end, L"][");
+        dst = AppendText(dst, end, LogCategoryToString(category));
+        dst = AppendText(dst, end, L"] ");
+        dst = AppendText(dst, end, message);
+        dst = AppendText(dst, end, L"\n");
+        *dst = L'\0';
+
+        return static_cast<size_t>(dst - buffer);
+    }
+
+    void Logger::AppendLogMessage(std::wstring& output, std::chrono::system_clock::time_point time,
+                                  LogLevel level, LogCategory category, std::wstring_view message)
+    {
+        const size_t lineLength = FormatLogLine(t_lineBuffer, kMaxLogLineLength, time, level, category, message);
+        output.append(t_lineBuffer, lineLength);
+    }
+
+    void Logger::AppendRepeatSummary(std::wstring& batch, std::vector<uint8_t>& binaryBatch,
+                                     bool formatText, bool writeBinary)
+    {
+        const int64_t firstTimestamp = m_writerRepeats.GetFirstRepeatTimestamp();
+        const int64_t lastTimestamp = m_writerRepeats.GetLastRepeatTimestamp();
+        const uint32_t count = m_writerRepeats.TakeRepeatCount();
+        if (count == 0)
+        {
+            return;
+        }
+
+        wchar_t buffer[kRepeatSummaryLength];
+        const std::wstring_view message = FormatRepeatSummary(buffer, count, lastTimestamp - firstTimestamp);
+
+        if (writeBinary)
+        {
+            BinaryLogWriter::AppendText(binaryBatch, m_writerRepeats.GetLevel(), m_writerRepeats.GetCategory(),
+                                        lastTimestamp, message);
+        }
+
+        if (formatText)
+        {
+            const std::chrono::system_clock::time_point time{ std::chrono::system_clock::duration(lastTimestamp) };
+            AppendLogMessage(batch, time, m_writerRepeats.GetLevel(), m_writerRepeats.GetCategory(), message);
+        }
+
+        DispatchToSinks(m_writerSinks.get(), { lastTimestamp, GetMonotonicTimestamp(),
+                                               s_frameNumber.load(std::memory_order_relaxed), 0,
+                                               m_writerRepeats.GetLevel(), m_writerRepeats.GetCategory(), message });
     }
 
-    const wchar_t* Logger::LogLevelToString(LogLevel level)
+    bool Logger::WriteRepeatSummary(LogRecord& summary)
     {
-        // 5자 고정 폭
-        switch (level)
+        const int64_t firstTimestamp = m_syncRepeats.GetFirstRepeatTimestamp();
+        const int64_t lastTimestamp = m_syncRepeats.GetLastRepeatTimestamp();
+        const uint32_t count = m_syncRepeats.TakeRepeatCount();
+        if (count == 0)
         {
-        case LogLevel::Trace:   return L"TRACE";
-        case LogLevel::Debug:   return L"DEBUG";
-        case LogLevel::Info:    return L"INFO ";
-        case LogLevel::Warning: return L"WARN ";
-        case LogLevel::Error:   return L"ERROR";
-        case LogLevel::Fatal:   return L"FATAL";
-        default:                return L"?????";
+            return false;
         }
+
+        const std::wstring_view message = FormatRepeatSummary(t_repeatSummaryBuffer, count,
+                                                              lastTimestamp - firstTimestamp);
+
+        const std::chrono::system_clock::time_point time{ std::chrono::system_clock::duration(lastTimestamp) };
+        const size_t lineLength = FormatLogLine(t_lineBuffer, kMaxLogLineLength, time,
+                                                m_syncRepeats.GetLevel(), m_syncRepeats.GetCategory(), message);
+        WriteOutput(t_lineBuffer, lineLength);
+
+        summary = { lastTimestamp, GetMonotonicTimestamp(), s_frameNumber.load(std::memory_order_relaxed), 0,
+                    m_syncRepeats.GetLevel(), m_syncRepeats.GetCategory(), message };
+        return true;
     }
 
-    const wchar_t* Logger::LogCategoryToString(LogCategory category)
+    void Logger::AddSink(std::shared_ptr<ILogSink> sink)
     {
-        // 8자 고정 폭
-        switch (category)
+        if (!sink)
         {
-        case LogCategory::Engine:   return L"Engine  ";
-        case LogCategory::Renderer: return L"Renderer";
-        case LogCategory::Device:   return L"Device  ";
-        case LogCategory::Window:   return L"Window  ";
-        case LogCategory::Input:    return L"Input   ";
-        case LogCategory::Resource: return L"Resource";
-        case LogCategory::Shader:   return L"Shader  ";
-        case LogCategory::Memory:   return L"Memory  ";
-        case LogCategory::Core:     return L"Core    ";
-        default:                    return L"????????";
+            return;
         }
+
+        std::lock_guard<std::mutex> lock(m_sinkMutex);
+
+        auto sinks = m_sinks ? std::make_shared<LogSinkList>(*m_sinks) : std::make_shared<LogSinkList>();
+        sinks->push_back(std::move(sink));
+        m_sinks = std::move(sinks);
     }
 
-    std::wstring Logger::GetTimestamp()
+    void Logger::RemoveSink(const ILogSink* sink)
     {
-        auto now = std::chrono::system_clock::now();
-        auto time = std::chrono::system_clock::to_time_t(now);
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-            now.time_since_epoch()) % 1000;
+        std::lock_guard<std::mutex> lock(m_sinkMutex);
+
+        if (!m_sinks)
+        {
+            return;
+        }
 
-        std::tm localTime;
-        localtime_s(&localTime, &time);
+        auto sinks = std::make_shared<LogSinkList>(*m_sinks);
+        std::erase_if(*sinks, [sink](const std::shared_ptr<ILogSink>& entry) { return entry.get() == sink; });
 
-        std::wstringstream ss;
-        ss << std::put_time(&localTime, L"%Y-%m-%d %H:%M:%S")
-           << L"." << std::setfill(L'0') << std::setw(3) << ms.count();
-        return ss.str();
+        if (sinks->empty())
+        {
+            m_sinks.reset();
+        }
+        else
+        {
+            m_sinks = std::move(sinks);
+        }
+    }
+
+    std::shared_ptr<const LogSinkList> Logger::GetSinks() const
+    {
+        std::lock_guard<std::mutex> lock(m_sinkMutex);
+        return m_sinks;
+    }
+
+    void Logger::DispatchToSinks(const LogSinkList* sinks, const LogRecord& record)
+    {
+        if (!sinks)
+        {
+            return;
+        }
+
+        for (const std::shared_ptr<ILogSink>& sink : *sinks)
+        {
+            sink->Write(record);
+        }
+    }
+
+    void Logger::FlushSinks(const LogSinkList* sinks)
+    {
+        if (!sinks)
+        {
+            return;
+        }
+
+        for (const std::shared_ptr<ILogSink>& sink : *sinks)
+        {
+            sink->Flush();
+        }
+    }
+
+    std::filesystem::path Logger::GetLogFilePath(std::wstring_view extension) const
+    {
+        return GetLogDirectory() / (m_logFileBaseName + std::wstring(extension));
     }
 }
@@ -8,40 +8,109 @@
 
 #pragma once
 
+#include "LogTypes.h"
+#include <Core/BuildConfig.h>
+#include "BinaryLog.h"
+#include "LogRingBuffer.h"
+#include "MappedLogFile.h"
+#include "FlightRecorder.h"
+#include "LogRateLimit.h"
+#include "LogSink.h"
 #include <string>
 #include <format>
 #include <mutex>
 #include <fstream>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <vector>
+#include <algorithm>
+#include <string_view>
+#include <filesystem>
+#include <memory>
 
 namespace DX12GameEngine
 {
     /**
-     * @brief 로그 레벨
+     * @brief 컴파일되는 최소 로그 레벨
+     *
+     * 이 레벨 미만의 LOG_* 호출은 출력 경로에서 제거됩니다.
+     * 인자 평가까지 제거되는 것은 EnableFlightRecorder가 false이거나 Info 이상 레벨일 때뿐이며,
+     * 플라이트 레코더가 켜져 있으면 Trace/Debug 호출은 인자를 평가해 레코더에 인코딩합니다.
+     */
+    static constexpr LogLevel kCompiledMinLogLevel = BUILD_DEFAULT(MinLogLevel);
+
+    /**
+     * @brief 한 로그 메시지의 최대 길이 (문자 수, 초과분은 잘림)
+     */
+    static constexpr size_t kMaxLogMessageLength = 8192;
+
+    /**
+     * @brief 로그 출력 모드
+     */
+    enum class LogMode : uint8_t
+    {
+        Synchronous,    // 호출 스레드에서 즉시 포맷/출력 (디버깅용)
+        Asynchronous    // 링 버퍼에 넣고 전용 writer 스레드가 일괄 출력
+    };
+
+    /**
+     * @brief 비동기 모드에서 링 버퍼가 가득 찼을 때의 처리 정책
+     */
+    enum class LogOverflowPolicy : uint8_t
+    {
+        Drop,           // 조용히 버림
+        Block,          // 공간이 생길 때까지 호출 스레드 대기
+        DropAndCount    // 버리고 개수를 세어 writer가 요약 로그로 출력
+    };
+
+    /**
+     * @brief 로그 파일 형식
      */
-    enum class LogLevel : uint8_t
+    enum class LogFileFormat : uint8_t
     {
-        Trace,      // 가장 상세한 디버깅 정보
-        Debug,      // 디버깅 정보
-        Info,       // 일반 정보
-        Warning,    // 경고
-        Error,      // 오류
-        Fatal       // 치명적 오류
+        Text,           // UTF-8 텍스트 (.log)
+        Binary          // 지연 포맷 바이너리 레코드 (.blog, LogDecoder로 변환) - 비동기 모드 전용
     };
 
     /**
-     * @brief 로그 카테고리
+     * @brief 로거 설정
      */
-    enum class LogCategory : uint8_t
+    struct LoggerDesc
     {
-        Engine,     // 엔진 코어
-        Renderer,   // 렌더링
-        Device,     // DirectX 디바이스
-        Window,     // 윈도우 시스템
-        Input,      // 입력 시스템
-        Resource,   // 리소스 관리
-        Shader,     // 셰이더
-        Memory,     // 메모리 관리
-        Core        // 기타 코어 시스템
+        LogLevel minLevel;                  // 최소 로그 레벨
+        bool logToFile;                     // 파일 출력
+        bool logToConsole;                  // 콘솔 출력 (false면 OutputDebugStringW)
+        std::wstring logFilePrefix;         // 로그 파일 접두사
+        LogMode mode;                       // 동기/비동기 모드
+        LogFileFormat fileFormat;           // 로그 파일 형식
+        bool deferredFormatting;            // 비동기 모드에서 인자 포맷팅을 writer로 미룸
+        LogOverflowPolicy overflowPolicy;   // 비동기 버퍼 오버플로 정책
+        uint32_t bufferSize;                // 비동기 링 버퍼 크기 (바이트)
+        uint32_t flushIntervalMs;           // writer 스레드 최대 대기 간격
+        uint32_t fileSegmentSize;           // 0이 아니면 메모리 맵 세그먼트 파일 크기 (바이트, 회전)
+        uint32_t maxFileSegments;           // 유지할 최근 세그먼트 수
+        bool enableFlightRecorder;          // 출력되지 않는 Trace/Debug를 메모리에 보관하고 오류 시 덤프
+        bool coalesceRepeats;               // 연속된 같은 메시지를 "repeated xN" 레코드로 병합
+
+        LoggerDesc()
+            : minLevel(LogLevel::Trace)
+            , logToFile(true)
+            , logToConsole(false)
+            , logFilePrefix(L"Engine")
+            , mode(LogMode::Synchronous)
+            , fileFormat(LogFileFormat::Text)
+            , deferredFormatting(true)
+            , overflowPolicy(LogOverflowPolicy::DropAndCount)
+            , bufferSize(1024 * 1024)
+            , flushIntervalMs(5)
+            , fileSegmentSize(0)
+            , maxFileSegments(8)
+            , enableFlightRecorder(false)
+            , coalesceRepeats(true)
+        {
+        }
     };
 
     /**
@@ -49,6 +118,23 @@ namespace DX12GameEngine
      *
      * 스레드 안전한 로깅을 제공합니다.
      * OutputDebugStringW와 파일 출력을 동시에 지원합니다.
+     *
+     * 비동기 모드에서는 호출 스레드가 레코드를 락 없는 링 버퍼에 넣기만 하고,
+     * 전용 writer 스레드가 타임스탬프/레벨 포맷팅과 출력을 일괄 처리합니다.
+     * 파일 flush도 배치당 한 번만 수행합니다.
+     *
+     * 지연 포맷(deferredFormatting)이 켜져 있으면 LOG_* 호출 지점은 포맷 문자열 ID와
+     * 인자 원시 바이트만 레코드에 복사하고, 문자열 포맷팅은 writer 스레드
+     * (또는 바이너리 로그 파일의 경우 오프라인 LogDecoder)에서 수행합니다.
+     *
+     * 포맷 경로는 스레드 로컬 고정 버퍼와 초 단위로 캐시한 타임스탬프를 사용하므로
+     * 워밍업 이후 메시지당 힙 할당이 없습니다.
+     *
+     * fileSegmentSize를 지정하면 파일 출력이 메모리 맵 세그먼트(MappedLogFile)로 바뀌어
+     * 크기가 제한되고 최근 maxFileSegments개만 유지되며, flush 없이 OS 페이지 캐시가 기록합니다.
+     *
+     * 기본 출력(콘솔/디버그 출력/파일) 외의 대상은 ILogSink로 구현해 AddSink로 등록합니다.
+     * 싱크 목록은 copy-on-write로 관리되어 writer가 배치마다 스냅샷을 잡고 락 없이 순회합니다.
      */
     class Logger
     {
@@ -66,8 +152,16 @@ namespace DX12GameEngine
          */
         void Initialize(LogLevel minLevel, bool logToFile = true, const std::wstring& logFilePrefix = L"Engine");
 
+        /**
+         * @brief 로거 초기화 (상세 설정)
+         * @param desc 로거 설정
+         */
+        void Initialize(const LoggerDesc& desc);
+
         /**
          * @brief 로거 종료
+         *
+         * 비동기 모드에서는 종료 전까지 커밋된 모든 레코드를 기록한 뒤 writer 스레드를 종료합니다.
          */
         void Shutdown();
 
@@ -77,7 +171,7 @@ namespace DX12GameEngine
          * @param category 로그 카테고리
          * @param message 메시지
          */
-        void Log(LogLevel level, LogCategory category, const std::wstring& message);
+        void Log(LogLevel level, LogCategory category, std::wstring_view message);
 
         /**
          * @brief 포맷된 로그 메시지 출력
@@ -90,25 +184,145 @@ namespace DX12GameEngine
         template<typename... Args>
         void Log(LogLevel level, LogCategory category, std::wformat_string<Args...> fmt, Args&&... args)
         {
-            if (level < m_minLevel)
+            if (!IsEnabled(level, category))
             {
                 return;
             }
 
-            std::wstring message = std::format(fmt, std::forward<Args>(args)...);
+            Log(level, category, FormatToThreadBuffer(fmt, std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief 로그 메시지 출력 (LOG_* 매크로용, 호출 지점 정보 포함)
+         */
+        void Log(LogFormatSite& site, LogLevel level, LogCategory category, std::wstring_view message)
+        {
+            (void)site;
             Log(level, category, message);
         }
 
         /**
-         * @brief 최소 로그 레벨 설정
+         * @brief 포맷된 로그 메시지 출력 (LOG_* 매크로용)
+         *
+         * 비동기 모드에서 모든 인자가 지연 포맷 가능한 타입이면
+         * 포맷 ID + 인자 바이트만 링 버퍼에 복사합니다.
+         *
+         * @param site 호출 지점별 포맷 문자열 식별자
+         */
+        template<typename... Args>
+        void Log(LogFormatSite& site, LogLevel level, LogCategory category,
+                 std::wformat_string<Args...> fmt, Args&&... args)
+        {
+            if (!IsEnabled(level, category))
+            {
+                return;
+            }
+
+            if constexpr (kAreLogArgsDeferrable<Args...>)
+            {
+                if (m_deferredFormatting && m_asyncRunning.load(std::memory_order_acquire))
+                {
+                    uint32_t formatId = site.GetId();
+                    if (formatId == kInvalidLogFormatId)
+                    {
+                        const LogArgType argTypes[] = { LogArgTraits<std::decay_t<Args>>::kType..., LogArgType::Int32 };
+                        formatId = LogFormatRegistry::Register(site, fmt.get(), argTypes, sizeof...(Args));
+                    }
+
+                    if (formatId != kInvalidLogFormatId && EnqueueDeferredRecord(level, category, formatId, args...))
+                    {
+                        if (level >= LogLevel::Error)
+                        {
+                            FlightRecorder::Get().DumpOnError(level, category);
+                        }
+                        return;
+                    }
+                }
+            }
+
+            Log(level, category, FormatToThreadBuffer(fmt, std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief 레벨/카테고리 필터 검사
+         *
+         * 카테고리별 레벨 테이블에서 relaxed 로드 한 번과 비교만 수행합니다.
+         */
+        static bool IsEnabled(LogLevel level, LogCategory category)
+        {
+            return static_cast<uint8_t>(level) >=
+                   s_categoryLevels[static_cast<uint32_t>(category)].load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 최소 로그 레벨 설정 (모든 카테고리)
          */
-        void SetMinLevel(LogLevel level) { m_minLevel = level; }
+        void SetMinLevel(LogLevel level);
 
         /**
          * @brief 현재 최소 로그 레벨 반환
          */
         LogLevel GetMinLevel() const { return m_minLevel; }
 
+        /**
+         * @brief 카테고리별 최소 로그 레벨 설정
+         *
+         * 예: Renderer만 Trace로 내리고 나머지는 Warning 유지.
+         * kCompiledMinLogLevel 미만 레벨은 출력 경로가 컴파일에서 제거되어 출력되지 않습니다.
+         * (플라이트 레코더가 켜져 있으면 Trace/Debug는 출력되지 않아도 레코더에는 기록됨)
+         */
+        static void SetCategoryLevel(LogCategory category, LogLevel level)
+        {
+            s_categoryLevels[static_cast<uint32_t>(category)].store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 카테고리별 최소 로그 레벨 반환
+         */
+        static LogLevel GetCategoryLevel(LogCategory category)
+        {
+            return static_cast<LogLevel>(s_categoryLevels[static_cast<uint32_t>(category)].load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief 출력 싱크 등록 (등록 이후 기록되는 레코드부터 전달)
+         */
+        void AddSink(std::shared_ptr<ILogSink> sink);
+
+        /**
+         * @brief 출력 싱크 제거
+         *
+         * writer가 이미 잡은 스냅샷에는 남아 있을 수 있으므로, 싱크는 shared_ptr로 수명이 유지됩니다.
+         */
+        void RemoveSink(const ILogSink* sink);
+
+        /**
+         * @brief 현재 엔진 프레임 번호 설정 (이후 레코드의 frameNumber 필드)
+         */
+        static void SetFrameNumber(uint64_t frameNumber) { s_frameNumber.store(frameNumber, std::memory_order_relaxed); }
+
+        /**
+         * @brief 현재 엔진 프레임 번호 반환
+         */
+        static uint64_t GetFrameNumber() { return s_frameNumber.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief 이번 실행의 로그 파일과 같은 이름으로 다른 확장자의 경로 반환
+         *
+         * 예: GetLogFilePath(L".jsonl") → Build/Logs/Engine_2026-01-20_22-30-15.jsonl
+         */
+        std::filesystem::path GetLogFilePath(std::wstring_view extension) const;
+
+        /**
+         * @brief 비동기 모드 동작 여부
+         */
+        bool IsAsync() const { return m_asyncRunning.load(std::memory_order_acquire); }
+
+        /**
+         * @brief 비동기 버퍼 오버플로로 버려진 로그 수 (누적)
+         */
+        uint64_t GetDroppedCount() const { return m_totalDroppedCount.load(std::memory_order_relaxed); }
+
     private:
         Logger() = default;
         ~Logger();
@@ -120,50 +334,402 @@ namespace DX12GameEngine
         Logger& operator=(Logger&&) = delete;
 
         /**
-         * @brief 로그 메시지 포맷팅
-         * @return 포맷된 전체 로그 문자열
+         * @brief 비동기 레코드 헤더 (링 버퍼 payload 앞부분, 뒤에 wchar_t 메시지가 이어짐)
+         */
+        struct AsyncRecord
+        {
+            int64_t timestamp;              // system_clock 틱
+            int64_t monotonicTimestamp;     // steady_clock 나노초
+            uint64_t frameNumber;
+            uint32_t length;                // 텍스트: 메시지 길이 (문자 수), 지연 포맷: 인자 바이트 수
+            uint32_t formatId;              // kInvalidLogFormatId면 텍스트 레코드
+            uint32_t threadId;
+            LogLevel level;
+            LogCategory category;
+        };
+
+        /**
+         * @brief 레코드 헤더 채우기 (시각, 프레임 번호, 스레드 ID 포함)
+         */
+        static void FillRecordHeader(AsyncRecord* record, LogLevel level, LogCategory category,
+                                     uint32_t formatId, uint32_t length);
+
+        /**
+         * @brief 호출 스레드의 고정 버퍼에 메시지 포맷 (힙 할당 없음, 초과분은 잘림)
+         * @return 버퍼를 가리키는 메시지 (같은 스레드의 다음 호출 전까지 유효)
+         */
+        template<typename... Args>
+        static std::wstring_view FormatToThreadBuffer(std::wformat_string<Args...> fmt, Args&&... args)
+        {
+            wchar_t* buffer = GetThreadFormatBuffer();
+            const auto result = std::format_to_n(buffer, kMaxLogMessageLength, fmt, std::forward<Args>(args)...);
+            const size_t length = std::min(static_cast<size_t>(result.size), kMaxLogMessageLength);
+            return std::wstring_view(buffer, length);
+        }
+
+        /**
+         * @brief 호출 스레드의 메시지 포맷 버퍼 (kMaxLogMessageLength 문자)
+         */
+        static wchar_t* GetThreadFormatBuffer();
+
+        /**
+         * @brief 현재 싱크 목록 스냅샷 (비어 있으면 nullptr)
+         */
+        std::shared_ptr<const LogSinkList> GetSinks() const;
+
+        /**
+         * @brief 싱크들에 레코드 전달
          */
-        std::wstring FormatLogMessage(LogLevel level, LogCategory category, const std::wstring& message);
+        static void DispatchToSinks(const LogSinkList* sinks, const LogRecord& record);
 
         /**
-         * @brief 로그 레벨을 문자열로 변환 (5자 고정)
+         * @brief 싱크들의 버퍼 출력
          */
-        static const wchar_t* LogLevelToString(LogLevel level);
+        static void FlushSinks(const LogSinkList* sinks);
 
         /**
-         * @brief 로그 카테고리를 문자열로 변환 (8자 고정)
+         * @brief 로그 폴더 경로 (Build/Logs, 없으면 생성)
          */
-        static const wchar_t* LogCategoryToString(LogCategory category);
+        static std::filesystem::path GetLogDirectory();
 
         /**
-         * @brief 현재 타임스탬프 문자열 반환
+         * @brief 로그 파일 열기
          */
-        std::wstring GetTimestamp();
+        void OpenLogFile(const LoggerDesc& desc);
+
+        /**
+         * @brief 레코드를 링 버퍼에 추가 (비동기 모드)
+         * @return 추가되었거나 정책에 따라 버려졌으면 true, 동기 경로로 처리해야 하면 false
+         */
+        bool EnqueueRecord(LogLevel level, LogCategory category, std::wstring_view message);
+
+        /**
+         * @brief 지연 포맷 레코드를 링 버퍼에 추가 (비동기 모드)
+         * @return 추가되었거나 정책에 따라 버려졌으면 true, 즉시 포맷해야 하면 false
+         */
+        template<typename... Args>
+        bool EnqueueDeferredRecord(LogLevel level, LogCategory category, uint32_t formatId, const Args&... args)
+        {
+            // 링 버퍼는 생산자 구간 안에서만 접근 (종료 중 해제된 버퍼를 읽지 않도록)
+            ProducerScope producer(*this);
+            if (!producer.IsAsync())
+            {
+                return false;
+            }
+
+            const size_t argsSize = GetEncodedLogArgsSize(args...);
+            if (argsSize + sizeof(AsyncRecord) > m_ringBuffer.GetMaxPayloadSize())
+            {
+                return false;
+            }
+
+            bool dropped = false;
+            void* payload = ReserveRecord(static_cast<uint32_t>(sizeof(AsyncRecord) + argsSize), dropped);
+            if (!payload)
+            {
+                return dropped;
+            }
+
+            AsyncRecord* record = static_cast<AsyncRecord*>(payload);
+            FillRecordHeader(record, level, category, formatId, static_cast<uint32_t>(argsSize));
+            EncodeLogArgs(reinterpret_cast<uint8_t*>(record + 1), args...);
+
+            CommitRecord(payload, level);
+            return true;
+        }
+
+        /**
+         * @brief 링 버퍼 생산자 구간 (예약 ~ 커밋)
+         *
+         * 진행 중인 생산자 수를 세어, StopWriterThread가 모든 예약이 커밋된 뒤에
+         * 마지막 드레인과 링 버퍼 해제를 하도록 합니다.
+         * 수를 올린 뒤 m_asyncRunning을 다시 확인하므로, 종료가 시작된 뒤 들어온 생산자는 동기 경로로 넘어갑니다.
+         */
+        class ProducerScope
+        {
+        public:
+            explicit ProducerScope(Logger& logger)
+                : m_logger(logger)
+            {
+                m_logger.m_activeProducers.fetch_add(1, std::memory_order_seq_cst);
+                m_async = m_logger.m_asyncRunning.load(std::memory_order_seq_cst);
+            }
+
+            ~ProducerScope()
+            {
+                m_logger.m_activeProducers.fetch_sub(1, std::memory_order_release);
+            }
+
+            ProducerScope(const ProducerScope&) = delete;
+            ProducerScope& operator=(const ProducerScope&) = delete;
+
+            /** @brief 링 버퍼에 기록해도 되는지 (false면 동기 경로로 처리) */
+            bool IsAsync() const { return m_async; }
+
+        private:
+            Logger& m_logger;
+            bool m_async;
+        };
+
+        /**
+         * @brief 링 버퍼 공간 예약 (오버플로 정책 적용)
+         * @param payloadSize 레코드 크기
+         * @param dropped 정책에 따라 버려졌으면 true로 설정
+         * @return payload 포인터 (nullptr면 dropped 값에 따라 버림/동기 처리)
+         */
+        void* ReserveRecord(uint32_t payloadSize, bool& dropped);
+
+        /**
+         * @brief 예약한 레코드 커밋
+         */
+        void CommitRecord(void* payload, LogLevel level);
+
+        /**
+         * @brief 바이너리 로그 배치를 파일에 기록 (m_mutex 보유 상태에서 호출)
+         */
+        void WriteBinaryOutput(const std::vector<uint8_t>& bytes);
+
+        /**
+         * @brief 텍스트 로그 파일에 UTF-8 바이트 기록 (m_mutex 보유 상태에서 호출)
+         */
+        void WriteTextFileBytes(const char* data, size_t size);
+
+        /**
+         * @brief 메모리 맵 세그먼트를 회전하고 바이너리 로그면 헤더/포맷 정의를 다시 기록
+         * @return 성공 시 true
+         */
+        bool RotateMappedLogFile();
+
+        /**
+         * @brief 포맷된 로그를 콘솔/디버그 출력/파일에 기록 (m_mutex 보유 상태에서 호출)
+         * @param text 널 종료된 텍스트 (OutputDebugStringW 요구사항)
+         * @param length 문자 수
+         */
+        void WriteOutput(const wchar_t* text, size_t length);
+
+        /**
+         * @brief writer 스레드 시작
+         */
+        void StartWriterThread();
+
+        /**
+         * @brief writer 스레드 종료 (남은 레코드를 모두 기록)
+         */
+        void StopWriterThread();
+
+        /**
+         * @brief writer 스레드 깨우기
+         */
+        void WakeWriterThread();
+
+        /**
+         * @brief writer 스레드 메인 루프
+         */
+        void WriterThreadMain();
+
+        /**
+         * @brief 모은 배치를 출력하고 비움 (용량 유지)
+         * @param flush 파일 flush 여부 (배치 마지막에만)
+         */
+        void WriteBatch(std::wstring& batch, std::vector<uint8_t>& binaryBatch, bool flush);
+
+        /**
+         * @brief 링 버퍼의 커밋된 레코드를 포맷해 batch에 추가
+         * @return 처리한 레코드 수
+         */
+        uint32_t DrainRecords(std::wstring& batch, std::vector<uint8_t>& binaryBatch, bool formatText);
+
+        /**
+         * @brief 로그 한 줄 포맷팅
+         *
+         * 포맷: [2026-01-20 22:30:15.123][INFO ][Engine  ] Message
+         * 날짜/시각 부분은 스레드별로 캐시해 초가 바뀔 때만 다시 계산합니다.
+         *
+         * @param buffer 출력 버퍼 (널 종료)
+         * @param capacity 버퍼 크기 (문자 수, 널 포함)
+         * @return 기록한 문자 수 (널 제외)
+         */
+        static size_t FormatLogLine(wchar_t* buffer, size_t capacity, std::chrono::system_clock::time_point time,
+                                    LogLevel level, LogCategory category, std::wstring_view message);
+
+        /**
+         * @brief 로그 한 줄 포맷팅 (결과를 output 뒤에 추가)
+         */
+        static void AppendLogMessage(std::wstring& output, std::chrono::system_clock::time_point time,
+                                     LogLevel level, LogCategory category, std::wstring_view message);
+
+        /**
+         * @brief 병합된 반복 횟수를 요약 레코드로 batch에 추가 (writer 스레드 전용)
+         */
+        void AppendRepeatSummary(std::wstring& batch, std::vector<uint8_t>& binaryBatch,
+                                 bool formatText, bool writeBinary);
+
+        /**
+         * @brief 병합된 반복 횟수를 요약 레코드로 바로 출력 (동기 경로, m_mutex 보유 상태에서 호출)
+         * @param summary 싱크에 전달할 요약 레코드 (메시지는 호출 스레드 버퍼를 가리킴)
+         * @return 요약을 출력했으면 true (싱크 전달은 호출자가 m_mutex를 놓은 뒤 수행)
+         */
+        bool WriteRepeatSummary(LogRecord& summary);
+
+        /**
+         * @brief 동기 경로의 레코드를 싱크에 전달 (m_mutex 밖에서 호출)
+         * @param summary 먼저 전달할 반복 요약 (없으면 nullptr)
+         * @param record 전달할 레코드 (없으면 nullptr)
+         * @param flush 전달 후 싱크 flush 여부
+         */
+        void DispatchSyncRecords(const LogRecord* summary, const LogRecord* record, bool flush);
 
     private:
+        // 카테고리별 최소 레벨 (LOG_* 매크로가 싱글톤 접근 없이 검사)
+        inline static std::atomic<uint8_t> s_categoryLevels[kLogCategoryCount] = {};
+        inline static std::atomic<uint64_t> s_frameNumber{ 0 };
+
         std::mutex m_mutex;
-        std::wofstream m_logFile;
+        std::ofstream m_logFile;                // UTF-8 텍스트 (바이너리 모드로 열어 변환 없이 기록)
+        std::string m_utf8Buffer;               // UTF-8 변환 버퍼 (m_mutex 보호, 용량 재사용)
+        std::ofstream m_binaryLogFile;
+        MappedLogFile m_mappedLogFile;          // fileSegmentSize 지정 시 위 스트림 대신 사용
+        LogFileFormat m_fileFormat = LogFileFormat::Text;
+        bool m_deferredFormatting = true;
+        bool m_coalesceRepeats = true;
         LogLevel m_minLevel = LogLevel::Trace;
         bool m_initialized = false;
         bool m_logToFile = false;
+        bool m_logToConsole = false;
+
+        // 비동기 모드
+        LogRingBuffer m_ringBuffer;
+        LogOverflowPolicy m_overflowPolicy = LogOverflowPolicy::DropAndCount;
+        std::chrono::milliseconds m_flushInterval{ 5 };
+        std::thread m_writerThread;
+        std::mutex m_wakeMutex;
+        std::condition_variable m_wakeCondition;
+        std::atomic<bool> m_asyncRunning{ false };
+        std::atomic<uint32_t> m_activeProducers{ 0 };      // 예약 ~ 커밋 중인 생산자 수 (ProducerScope)
+        std::atomic<bool> m_stopRequested{ false };
+        std::atomic<bool> m_wakeRequested{ false };
+        std::atomic<uint64_t> m_droppedCount{ 0 };         // writer가 아직 보고하지 않은 수
+        std::atomic<uint64_t> m_totalDroppedCount{ 0 };
+
+        // writer 스레드 전용 (바이너리 파일에 이미 기록한 포맷 정의)
+        std::vector<bool> m_writtenFormatIds;
+        std::wstring m_scratchMessage;
+
+        // 연속 중복 병합 (동기 경로는 m_mutex 보호, 비동기 경로는 writer 스레드 전용)
+        LogRepeatTracker m_syncRepeats;
+        LogRepeatTracker m_writerRepeats;
+
+        // 출력 싱크 (copy-on-write, m_sinkMutex는 목록 교체에만 사용)
+        mutable std::mutex m_sinkMutex;
+        std::mutex m_sinkDispatchMutex;                     // 싱크 Write/Flush 직렬화 (m_mutex를 잡은 채 얻지 않음)
+        std::shared_ptr<const LogSinkList> m_sinks;
+        std::shared_ptr<const LogSinkList> m_writerSinks;  // writer 스레드가 배치마다 잡는 스냅샷
+        std::wstring m_logFileBaseName;                     // "<prefix>_<시각>"
     };
 }
 
 // 로깅 매크로
+// - kCompiledMinLogLevel 미만 레벨은 if constexpr로 출력 경로를 제거
+//   (인자도 평가되지 않는 것은 EnableFlightRecorder가 false일 때뿐, 켜져 있으면 Trace/Debug는 레코더에 기록)
+// - 런타임 필터는 카테고리별 레벨의 relaxed 로드 + 분기 한 번
+// - 호출 지점마다 상수 초기화되는 LogFormatSite를 두어 지연 포맷 시 포맷 문자열 ID로 사용
+// - 출력되지 않는 Trace/Debug는 플라이트 레코더에 보관 (EnableFlightRecorder 빌드 설정)
+#define DX12_LOG(level, category, ...) \
+    do \
+    { \
+        static ::DX12GameEngine::LogFormatSite s_logFormatSite; \
+        if constexpr ((level) >= ::DX12GameEngine::kCompiledMinLogLevel) \
+        { \
+            if (::DX12GameEngine::Logger::IsEnabled(level, category)) \
+            { \
+                ::DX12GameEngine::Logger::Get().Log(s_logFormatSite, level, category, __VA_ARGS__); \
+            } \
+            else if constexpr (::DX12GameEngine::IsFlightRecorderLevel(level)) \
+            { \
+                ::DX12GameEngine::FlightRecorder::Record(s_logFormatSite, level, category, __VA_ARGS__); \
+            } \
+        } \
+        else if constexpr (::DX12GameEngine::IsFlightRecorderLevel(level)) \
+        { \
+            ::DX12GameEngine::FlightRecorder::Record(s_logFormatSite, level, category, __VA_ARGS__); \
+        } \
+    } while (false)
+
+// 빈도 제한 로깅 매크로 (매 프레임 호출되는 경로용)
+// - 호출 지점마다 락 없는 static LogRateLimitSite를 두고, 걸러진 호출은 카운터만 증가 (포맷/기록 없음)
+// - 다시 통과할 때 걸러진 횟수를 요약 레코드로 함께 출력
+// - 런타임 레벨로 출력되지 않는 호출은 DX12_LOG와 같이 처리 (플라이트 레코더)
+#define DX12_LOG_RATE_LIMITED(level, category, shouldLogCall, ...) \
+    do \
+    { \
+        if constexpr ((level) >= ::DX12GameEngine::kCompiledMinLogLevel || \
+                      ::DX12GameEngine::IsFlightRecorderLevel(level)) \
+        { \
+            static ::DX12GameEngine::LogRateLimitSite s_logRateLimitSite; \
+            uint32_t logSuppressedCount = 0; \
+            if (!::DX12GameEngine::Logger::IsEnabled(level, category) || s_logRateLimitSite.shouldLogCall) \
+            { \
+                DX12_LOG(level, category, __VA_ARGS__); \
+                if (logSuppressedCount > 0) \
+                { \
+                    DX12_LOG(level, category, L"(suppressed {} similar messages)", logSuppressedCount); \
+                } \
+            } \
+        } \
+    } while (false)
+
+// intervalMs마다 최대 한 번 출력
+#define DX12_LOG_EVERY_MS(level, category, intervalMs, ...) \
+    DX12_LOG_RATE_LIMITED(level, category, ShouldLogEveryMs(intervalMs, logSuppressedCount), __VA_ARGS__)
+
+// 처음 limit번 출력, 이후에는 누적 횟수가 limit의 2의 거듭제곱 배일 때만 요약과 함께 출력
+#define DX12_LOG_FIRST_N(level, category, limit, ...) \
+    DX12_LOG_RATE_LIMITED(level, category, ShouldLogFirstN(limit, logSuppressedCount), __VA_ARGS__)
+
 #define LOG_TRACE(category, ...) \
-    ::DX12GameEngine::Logger::Get().Log(::DX12GameEngine::LogLevel::Trace, category, __VA_ARGS__)
+    DX12_LOG(::DX12GameEngine::LogLevel::Trace, category, __VA_ARGS__)
 
 #define LOG_DEBUG(category, ...) \
-    ::DX12GameEngine::Logger::Get().Log(::DX12GameEngine::LogLevel::Debug, category, __VA_ARGS__)
+    DX12_LOG(::DX12GameEngine::LogLevel::Debug, category, __VA_ARGS__)
 
 #define LOG_INFO(category, ...) \
-    ::DX12GameEngine::Logger::Get().Log(::DX12GameEngine::LogLevel::Info, category, __VA_ARGS__)
+    DX12_LOG(::DX12GameEngine::LogLevel::Info, category, __VA_ARGS__)
 
 #define LOG_WARNING(category, ...) \
-    ::DX12GameEngine::Logger::Get().Log(::DX12GameEngine::LogLevel::Warning, category, __VA_ARGS__)
+    DX12_LOG(::DX12GameEngine::LogLevel::Warning, category, __VA_ARGS__)
 
 #define LOG_ERROR(category, ...) \
-    ::DX12GameEngine::Logger::Get().Log(::DX12GameEngine::LogLevel::Error, category, __VA_ARGS__)
+    DX12_LOG(::DX12GameEngine::LogLevel::Error, category, __VA_ARGS__)
 
 #define LOG_FATAL(category, ...) \
-    ::DX12GameEngine::Logger::Get().Log(::DX12GameEngine::LogLevel::Fatal, category, __VA_ARGS__)
+    DX12_LOG(::DX12GameEngine::LogLevel::Fatal, category, __VA_ARGS__)
+
+#define LOG_TRACE_EVERY_MS(category, intervalMs, ...) \
+    DX12_LOG_EVERY_MS(::DX12GameEngine::LogLevel::Trace, category, intervalMs, __VA_ARGS__)
+
+#define LOG_DEBUG_EVERY_MS(category, intervalMs, ...) \
+    DX12_LOG_EVERY_MS(::DX12GameEngine::LogLevel::Debug, category, intervalMs, __VA_ARGS__)
+
+#define LOG_INFO_EVERY_MS(category, intervalMs, ...) \
+    DX12_LOG_EVERY_MS(::DX12GameEngine::LogLevel::Info, category, intervalMs, __VA_ARGS__)
+
+#define LOG_WARNING_EVERY_MS(category, intervalMs, ...) \
+    DX12_LOG_EVERY_MS(::DX12GameEngine::LogLevel::Warning, category, intervalMs, __VA_ARGS__)
+
+#define LOG_ERROR_EVERY_MS(category, intervalMs, ...) \
+    DX12_LOG_EVERY_MS(::DX12GameEngine::LogLevel::Error, category, intervalMs, __VA_ARGS__)
+
+#define LOG_TRACE_FIRST_N(category, limit, ...) \
+    DX12_LOG_FIRST_N(::DX12GameEngine::LogLevel::Trace, category, limit, __VA_ARGS__)
+
+#define LOG_DEBUG_FIRST_N(category, limit, ...) \
+    DX12_LOG_FIRST_N(::DX12GameEngine::LogLevel::Debug, category, limit, __VA_ARGS__)
+
+#define LOG_INFO_FIRST_N(category, limit, ...) \
+    DX12_LOG_FIRST_N(::DX12GameEngine::LogLevel::Info, category, limit, __VA_ARGS__)
+
+#define LOG_WARNING_FIRST_N(category, limit, ...) \
+    DX12_LOG_FIRST_N(::DX12GameEngine::LogLevel::Warning, category, limit, __VA_ARGS__)
+
+#define LOG_ERROR_FIRST_N(category, limit, ...) \
+    DX12_LOG_FIRST_N(::DX12GameEngine::LogLevel::Error, category, limit, __VA_ARGS__)
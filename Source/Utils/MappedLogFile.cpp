@@ -0,0 +1,162 @@
+/**
+ * @file MappedLogFile.cpp
+ * @brief 메모리 맵 기반 크기 제한 로그 파일 구현
+ */
+
+#include "MappedLogFile.h"
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <system_error>
+
+namespace DX12GameEngine
+{
+    MappedLogFile::~MappedLogFile()
+    {
+        Close();
+    }
+
+    bool MappedLogFile::Open(const MappedLogFileDesc& desc)
+    {
+        Close();
+
+        m_desc = desc;
+        m_desc.segmentSize = std::max(desc.segmentSize, kMinSegmentSize);
+        m_desc.maxSegments = std::max(desc.maxSegments, 1u);
+        m_segmentIndex = 0;
+        m_segmentPaths.clear();
+
+        return OpenSegment();
+    }
+
+    void MappedLogFile::Close()
+    {
+        CloseSegment();
+    }
+
+    bool MappedLogFile::Write(const void* data, size_t size)
+    {
+        if (!m_view || size > m_capacity - m_writeOffset)
+        {
+            return false;
+        }
+
+        std::memcpy(m_view + m_header->headerSize + m_writeOffset, data, size);
+        m_writeOffset += size;
+
+        // 데이터 복사가 끝난 뒤 커밋 오프셋 공개 (크래시 시 이 범위까지 유효)
+        std::atomic_ref<uint64_t>(m_header->committedSize).store(m_writeOffset, std::memory_order_release);
+        return true;
+    }
+
+    bool MappedLogFile::Rotate()
+    {
+        CloseSegment();
+        m_segmentIndex++;
+
+        // 최근 maxSegments - 1개 + 새 세그먼트만 유지
+        while (m_segmentPaths.size() >= m_desc.maxSegments)
+        {
+            std::error_code error;
+            std::filesystem::remove(m_segmentPaths.front(), error);
+            m_segmentPaths.pop_front();
+        }
+
+        return OpenSegment();
+    }
+
+    bool MappedLogFile::OpenSegment()
+    {
+        const std::filesystem::path path = GetSegmentPath(m_segmentIndex);
+        const uint64_t segmentSize = m_desc.segmentSize;
+
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+                                  nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            std::wcerr << L"[Logger] Warning: Failed to create log segment " << path.wstring() << L"\n";
+            return false;
+        }
+
+        // 매핑 생성 시 파일이 segmentSize로 미리 할당됨
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READWRITE,
+                                            static_cast<DWORD>(segmentSize >> 32),
+                                            static_cast<DWORD>(segmentSize & 0xFFFFFFFFull), nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            std::wcerr << L"[Logger] Warning: Failed to map log segment " << path.wstring() << L"\n";
+            return false;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(segmentSize));
+        if (!view)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            std::wcerr << L"[Logger] Warning: Failed to map log segment " << path.wstring() << L"\n";
+            return false;
+        }
+
+        m_file = file;
+        m_mapping = mapping;
+        m_view = static_cast<uint8_t*>(view);
+        m_capacity = segmentSize - sizeof(MappedLogSegmentHeader);
+        m_writeOffset = 0;
+
+        m_header = reinterpret_cast<MappedLogSegmentHeader*>(m_view);
+        std::memset(m_header, 0, sizeof(MappedLogSegmentHeader));
+        std::memcpy(m_header->magic, kMappedLogMagic, sizeof(kMappedLogMagic));
+        m_header->version = kMappedLogVersion;
+        m_header->headerSize = sizeof(MappedLogSegmentHeader);
+        m_header->capacity = m_capacity;
+        m_header->committedSize = 0;
+        m_header->segmentIndex = m_segmentIndex;
+        m_header->content = m_desc.content;
+        m_header->closedCleanly = 0;
+
+        m_segmentPaths.push_back(path);
+        return true;
+    }
+
+    void MappedLogFile::CloseSegment()
+    {
+        if (!m_view)
+        {
+            return;
+        }
+
+        const uint64_t fileSize = m_header->headerSize + m_writeOffset;
+        m_header->closedCleanly = 1;
+
+        UnmapViewOfFile(m_view);
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+
+        // 미리 할당한 미사용 영역 잘라내기
+        LARGE_INTEGER size;
+        size.QuadPart = static_cast<LONGLONG>(fileSize);
+        if (SetFilePointerEx(static_cast<HANDLE>(m_file), size, nullptr, FILE_BEGIN))
+        {
+            SetEndOfFile(static_cast<HANDLE>(m_file));
+        }
+        CloseHandle(static_cast<HANDLE>(m_file));
+
+        m_file = nullptr;
+        m_mapping = nullptr;
+        m_view = nullptr;
+        m_header = nullptr;
+        m_capacity = 0;
+        m_writeOffset = 0;
+    }
+
+    std::filesystem::path MappedLogFile::GetSegmentPath(uint32_t segmentIndex) const
+    {
+        return m_desc.directory / std::format(L"{}_{:03}{}", m_desc.baseName, segmentIndex, m_desc.extension);
+    }
+}
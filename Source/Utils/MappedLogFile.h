@@ -0,0 +1,158 @@
+/**
+ * @file MappedLogFile.h
+ * @brief 메모리 맵 기반 크기 제한 로그 파일 (세그먼트 회전)
+ *
+ * 미리 할당한 세그먼트 파일을 메모리에 매핑해 로그 바이트를 복사하고,
+ * 세그먼트가 가득 차면 새 세그먼트로 회전합니다. 최근 N개 세그먼트만 유지합니다.
+ * 디스크 반영은 OS 페이지 캐시가 담당하므로 줄 단위 flush가 필요 없습니다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <string>
+
+namespace DX12GameEngine
+{
+    /**
+     * @brief 세그먼트에 담긴 로그 데이터 종류
+     */
+    enum class MappedLogContent : uint8_t
+    {
+        Text = 0,       // UTF-8 텍스트 로그
+        Binary = 1      // 바이너리 로그 (BinaryLogFileHeader부터 시작, 세그먼트마다 독립적으로 디코딩 가능)
+    };
+
+    /**
+     * @brief 세그먼트 파일 헤더 (파일 앞 64바이트)
+     *
+     * committedSize는 데이터를 복사한 뒤 release 순서로 갱신되므로,
+     * 프로세스가 크래시해도 헤더에 기록된 범위까지는 완전한 로그입니다.
+     * 정상 종료 시에는 파일을 headerSize + committedSize 크기로 잘라냅니다.
+     */
+    struct alignas(8) MappedLogSegmentHeader
+    {
+        char magic[8];              // "DX12MLG"
+        uint32_t version;
+        uint32_t headerSize;        // 데이터 시작 오프셋
+        uint64_t capacity;          // 데이터 영역 크기 (바이트)
+        uint64_t committedSize;     // 기록 완료된 데이터 크기 (바이트)
+        uint32_t segmentIndex;      // 실행 중 세그먼트 순번 (0부터)
+        MappedLogContent content;
+        uint8_t closedCleanly;      // 정상 종료 시 1
+        uint8_t reserved[26];
+    };
+
+    static_assert(sizeof(MappedLogSegmentHeader) == 64, "MappedLogSegmentHeader must be 64 bytes");
+
+    static constexpr char kMappedLogMagic[8] = { 'D', 'X', '1', '2', 'M', 'L', 'G', '\0' };
+    static constexpr uint32_t kMappedLogVersion = 1;
+
+    /**
+     * @brief 메모리 맵 로그 파일 설정
+     */
+    struct MappedLogFileDesc
+    {
+        std::filesystem::path directory;    // 세그먼트 저장 폴더
+        std::wstring baseName;              // 파일명 (실제: baseName_000.mlog)
+        std::wstring extension;             // 확장자 (점 포함)
+        uint64_t segmentSize;               // 세그먼트 파일 크기 (헤더 포함)
+        uint32_t maxSegments;               // 유지할 최근 세그먼트 수
+        MappedLogContent content;
+
+        MappedLogFileDesc()
+            : baseName(L"Engine")
+            , extension(L".mlog")
+            , segmentSize(16 * 1024 * 1024)
+            , maxSegments(8)
+            , content(MappedLogContent::Text)
+        {
+        }
+    };
+
+    /**
+     * @brief 메모리 맵 회전 로그 파일
+     *
+     * 단일 writer 전용입니다 (Logger의 m_mutex 아래에서 사용).
+     * Write()는 세그먼트 경계를 넘지 않으며, 공간이 부족하면 호출자가 Rotate()를 호출합니다.
+     * (바이너리 로그는 회전 직후 파일 헤더와 포맷 정의를 다시 기록해야 하기 때문)
+     */
+    class MappedLogFile
+    {
+    public:
+        /**
+         * @brief 최소 세그먼트 크기 (writer 배치 하나가 항상 빈 세그먼트에 들어가도록)
+         */
+        static constexpr uint64_t kMinSegmentSize = 1024 * 1024;
+
+        MappedLogFile() = default;
+        ~MappedLogFile();
+
+        // 복사 및 이동 금지
+        MappedLogFile(const MappedLogFile&) = delete;
+        MappedLogFile& operator=(const MappedLogFile&) = delete;
+        MappedLogFile(MappedLogFile&&) = delete;
+        MappedLogFile& operator=(MappedLogFile&&) = delete;
+
+        /**
+         * @brief 첫 세그먼트 생성 및 매핑
+         * @param desc 설정
+         * @return 성공 시 true
+         */
+        bool Open(const MappedLogFileDesc& desc);
+
+        /**
+         * @brief 현재 세그먼트를 닫고 실제 기록 크기로 잘라냄
+         */
+        void Close();
+
+        /**
+         * @brief 데이터 추가 후 커밋 오프셋 갱신
+         * @return 현재 세그먼트에 공간이 부족하면 false (아무것도 기록하지 않음)
+         */
+        bool Write(const void* data, size_t size);
+
+        /**
+         * @brief 현재 세그먼트를 닫고 다음 세그먼트 열기 (오래된 세그먼트 삭제)
+         * @return 성공 시 true
+         */
+        bool Rotate();
+
+        /**
+         * @brief 열려 있는지 여부
+         */
+        bool IsOpen() const { return m_view != nullptr; }
+
+        /**
+         * @brief 현재 세그먼트의 남은 데이터 공간 (바이트)
+         */
+        uint64_t GetRemaining() const { return m_view ? m_capacity - m_writeOffset : 0; }
+
+        /**
+         * @brief 빈 세그먼트의 데이터 공간 (바이트)
+         */
+        uint64_t GetCapacity() const { return m_desc.segmentSize - sizeof(MappedLogSegmentHeader); }
+
+    private:
+        bool OpenSegment();
+        void CloseSegment();
+        std::filesystem::path GetSegmentPath(uint32_t segmentIndex) const;
+
+    private:
+        MappedLogFileDesc m_desc;
+
+        // Windows 핸들 (헤더에 Windows.h를 노출하지 않기 위해 void*)
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+        uint8_t* m_view = nullptr;
+
+        MappedLogSegmentHeader* m_header = nullptr;
+        uint64_t m_capacity = 0;
+        uint64_t m_writeOffset = 0;
+        uint32_t m_segmentIndex = 0;
+
+        std::deque<std::filesystem::path> m_segmentPaths;   // 유지 중인 세그먼트 (오래된 순)
+    };
+}
@@ -0,0 +1,459 @@
+/**
+ * @file RenderCommandStreamTest.cpp
+ * @brief 렌더 명령 스트림 테스트 (D3D12 없이 실행)
+ *
+ * 명령별 기록 / 재생 왕복, 가변 길이 데이터(힙, 루트 상수, 버텍스 버퍼, 렌더 타겟, 배리어),
+ * Append로 합치기, 버퍼 확장(Grow), 재사용한 버퍼에서도 같은 바이트가 나오는지와 Reset 후 재사용을 검사합니다.
+ * 실패하면 위치를 출력하고 0이 아닌 값을 반환합니다 (Release에서도 검사하도록 assert는 쓰지 않음).
+ */
+
+#include <Graphics/RenderCommandStream.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace DX12GameEngine;
+
+namespace
+{
+    int s_failureCount = 0;
+
+#define CHECK(condition)                                                                    \
+    do                                                                                      \
+    {                                                                                       \
+        if (!(condition))                                                                   \
+        {                                                                                   \
+            std::printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition);            \
+            s_failureCount++;                                                               \
+        }                                                                                   \
+    } while (0)
+
+    /**
+     * @brief 스트림의 명령을 순서대로 모음 (검사용)
+     */
+    std::vector<const RenderCommandHeader*> Collect(const RenderCommandStream& stream)
+    {
+        std::vector<const RenderCommandHeader*> commands;
+        for (const RenderCommandHeader& header : stream)
+        {
+            commands.push_back(&header);
+        }
+        return commands;
+    }
+
+    /**
+     * @brief 명령 크기 합이 스트림 크기와 같고 모두 8바이트 배수인지 확인
+     */
+    void CheckLayout(const RenderCommandStream& stream)
+    {
+        size_t totalSize = 0;
+        uint32_t count = 0;
+        for (const RenderCommandHeader& header : stream)
+        {
+            CHECK(header.size > 0 && header.size % sizeof(uint64_t) == 0);
+            CHECK(static_cast<uint32_t>(header.type) < kRenderCommandTypeCount);
+            totalSize += header.size;
+            count++;
+        }
+        CHECK(totalSize == stream.GetSizeInBytes());
+        CHECK(count == stream.GetCommandCount());
+    }
+
+    void TestEmpty()
+    {
+        RenderCommandStream stream;
+        CHECK(stream.IsEmpty());
+        CHECK(stream.GetCommandCount() == 0);
+        CHECK(stream.GetSizeInBytes() == 0);
+        CHECK(stream.begin() == stream.end());
+    }
+
+    void TestFixedCommands()
+    {
+        RenderCommandStream stream;
+        const RenderViewport viewport = { 1.0f, 2.0f, 1920.0f, 1080.0f, 0.0f, 1.0f };
+        const RenderRect rect = { -4, 8, 640, 480 };
+        const IndexBufferBinding indexBuffer = { 0x1000, 256, IndexFormat::Uint16 };
+        const float color[4] = { 0.1f, 0.2f, 0.3f, 1.0f };
+
+        stream.SetPipelineState(0x11);
+        stream.SetGraphicsRootSignature(0x22);
+        stream.SetGraphicsRootDescriptorTable(3, 0x33);
+        stream.SetPrimitiveTopology(PrimitiveTopology::TriangleStrip);
+        stream.SetIndexBuffer(indexBuffer);
+        stream.SetViewport(viewport);
+        stream.SetScissorRect(rect);
+        stream.ClearRenderTarget(0x44, color);
+        stream.ClearDepthStencil(0x55, true, false, 0.5f, 7);
+        stream.Draw(3, 2, 10, 1);
+        stream.DrawIndexed(36, 4, 6, -2, 5);
+        stream.Dispatch(8, 4, 2);
+
+        CHECK(!stream.IsEmpty());
+        CHECK(stream.GetCommandCount() == 12);
+        CheckLayout(stream);
+
+        const std::vector<const RenderCommandHeader*> commands = Collect(stream);
+        if (commands.size() != 12)
+        {
+            CHECK(commands.size() == 12);
+            return;
+        }
+
+        CHECK(commands[0]->type == RenderCommandType::SetPipelineState);
+        CHECK(commands[0]->As<RenderCommand::SetPipelineState>().pipelineState == 0x11);
+
+        CHECK(commands[1]->type == RenderCommandType::SetRootSignature);
+        CHECK(commands[1]->As<RenderCommand::SetRootSignature>().rootSignature == 0x22);
+
+        CHECK(commands[2]->type == RenderCommandType::SetRootDescriptorTable);
+        const auto& table = commands[2]->As<RenderCommand::SetRootDescriptorTable>();
+        CHECK(table.rootParameterIndex == 3 && table.gpuDescriptor == 0x33);
+
+        CHECK(commands[3]->type == RenderCommandType::SetPrimitiveTopology);
+        CHECK(commands[3]->As<RenderCommand::SetPrimitiveTopology>().topology == PrimitiveTopology::TriangleStrip);
+
+        CHECK(commands[4]->type == RenderCommandType::SetIndexBuffer);
+        const auto& index = commands[4]->As<RenderCommand::SetIndexBuffer>().binding;
+        CHECK(index.gpuAddress == 0x1000 && index.sizeInBytes == 256 && index.format == IndexFormat::Uint16);
+
+        CHECK(commands[5]->type == RenderCommandType::SetViewport);
+        CHECK(std::memcmp(&commands[5]->As<RenderCommand::SetViewport>().viewport, &viewport, sizeof(viewport)) == 0);
+
+        CHECK(commands[6]->type == RenderCommandType::SetScissorRect);
+        CHECK(std::memcmp(&commands[6]->As<RenderCommand::SetScissorRect>().rect, &rect, sizeof(rect)) == 0);
+
+        CHECK(commands[7]->type == RenderCommandType::ClearRenderTarget);
+        const auto& clear = commands[7]->As<RenderCommand::ClearRenderTarget>();
+        CHECK(clear.renderTarget == 0x44 && std::memcmp(clear.color, color, sizeof(color)) == 0);
+
+        CHECK(commands[8]->type == RenderCommandType::ClearDepthStencil);
+        const auto& clearDepth = commands[8]->As<RenderCommand::ClearDepthStencil>();
+        CHECK(clearDepth.depthStencil == 0x55 && clearDepth.clearDepth && !clearDepth.clearStencil);
+        CHECK(clearDepth.depth == 0.5f && clearDepth.stencil == 7);
+
+        CHECK(commands[9]->type == RenderCommandType::Draw);
+        const auto& draw = commands[9]->As<RenderCommand::Draw>();
+        CHECK(draw.vertexCount == 3 && draw.instanceCount == 2 && draw.startVertex == 10 && draw.startInstance == 1);
+
+        CHECK(commands[10]->type == RenderCommandType::DrawIndexed);
+        const auto& drawIndexed = commands[10]->As<RenderCommand::DrawIndexed>();
+        CHECK(drawIndexed.indexCount == 36 && drawIndexed.instanceCount == 4 && drawIndexed.startIndex == 6);
+        CHECK(drawIndexed.baseVertex == -2 && drawIndexed.startInstance == 5);
+
+        CHECK(commands[11]->type == RenderCommandType::Dispatch);
+        const auto& dispatch = commands[11]->As<RenderCommand::Dispatch>();
+        CHECK(dispatch.groupCountX == 8 && dispatch.groupCountY == 4 && dispatch.groupCountZ == 2);
+
+        for (uint32_t type = 0; type < kRenderCommandTypeCount; type++)
+        {
+            CHECK(std::strcmp(GetRenderCommandTypeName(static_cast<RenderCommandType>(type)), "Unknown") != 0);
+        }
+        CHECK(std::strcmp(GetRenderCommandTypeName(RenderCommandType::Count), "Unknown") == 0);
+    }
+
+    void TestVariableLengthCommands()
+    {
+        RenderCommandStream stream;
+        const RenderHandle heaps[2] = { 0xA0, 0xB0 };
+        const uint32_t constants[3] = { 7, 8, 9 };
+        const VertexBufferBinding bindings[2] = { { 0x2000, 96, 12 }, { 0x3000, 128, 16 } };
+        const uint64_t renderTargets[kMaxRenderTargets + 2] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        const RenderBarrier barriers[2] =
+        {
+            { 0xC0, 0, ResourceState::Present, ResourceState::RenderTarget },
+            { 0xD0, 2, ResourceState::CopyDest, ResourceState::ShaderResource }
+        };
+
+        stream.SetDescriptorHeaps(2, heaps);
+        stream.SetGraphicsRoot32BitConstants(1, 3, constants, 4);
+        stream.SetGraphicsRoot32BitConstants(2, 0, constants);
+        stream.SetVertexBuffers(1, 2, bindings);
+        stream.SetRenderTargets(2, renderTargets, 0x99);
+        stream.SetRenderTargets(kMaxRenderTargets + 2, renderTargets);
+        stream.ResourceBarrier(2, barriers);
+        stream.Transition(0xE0, ResourceState::RenderTarget, ResourceState::Present);
+
+        CHECK(stream.GetCommandCount() == 8);
+        CheckLayout(stream);
+
+        const std::vector<const RenderCommandHeader*> commands = Collect(stream);
+        if (commands.size() != 8)
+        {
+            CHECK(commands.size() == 8);
+            return;
+        }
+
+        const auto& heapCommand = commands[0]->As<RenderCommand::SetDescriptorHeaps>();
+        CHECK(commands[0]->type == RenderCommandType::SetDescriptorHeaps);
+        CHECK(commands[0]->size == sizeof(RenderCommand::SetDescriptorHeaps) + sizeof(heaps));
+        CHECK(heapCommand.count == 2 && std::memcmp(heapCommand.GetHeaps(), heaps, sizeof(heaps)) == 0);
+
+        // 값 3개(12바이트)는 8바이트 경계까지 패딩
+        const auto& constantCommand = commands[1]->As<RenderCommand::SetRootConstants>();
+        CHECK(commands[1]->type == RenderCommandType::SetRootConstants);
+        CHECK(commands[1]->size == sizeof(RenderCommand::SetRootConstants) + 16);
+        CHECK(constantCommand.rootParameterIndex == 1 && constantCommand.count == 3 && constantCommand.destOffset == 4);
+        CHECK(std::memcmp(constantCommand.GetValues(), constants, sizeof(constants)) == 0);
+
+        const auto& emptyConstants = commands[2]->As<RenderCommand::SetRootConstants>();
+        CHECK(commands[2]->size == sizeof(RenderCommand::SetRootConstants));
+        CHECK(emptyConstants.rootParameterIndex == 2 && emptyConstants.count == 0);
+
+        const auto& vertexCommand = commands[3]->As<RenderCommand::SetVertexBuffers>();
+        CHECK(commands[3]->type == RenderCommandType::SetVertexBuffers);
+        CHECK(commands[3]->size == sizeof(RenderCommand::SetVertexBuffers) + sizeof(bindings));
+        CHECK(vertexCommand.startSlot == 1 && vertexCommand.count == 2);
+        CHECK(std::memcmp(vertexCommand.GetBindings(), bindings, sizeof(bindings)) == 0);
+
+        const auto& targetCommand = commands[4]->As<RenderCommand::SetRenderTargets>();
+        CHECK(commands[4]->type == RenderCommandType::SetRenderTargets);
+        CHECK(targetCommand.count == 2 && targetCommand.depthStencil == 0x99);
+        CHECK(std::memcmp(targetCommand.GetRenderTargets(), renderTargets, 2 * sizeof(uint64_t)) == 0);
+
+        // kMaxRenderTargets를 넘는 수는 잘림
+        const auto& clampedCommand = commands[5]->As<RenderCommand::SetRenderTargets>();
+        CHECK(clampedCommand.count == kMaxRenderTargets && clampedCommand.depthStencil == 0);
+        CHECK(commands[5]->size == sizeof(RenderCommand::SetRenderTargets) + kMaxRenderTargets * sizeof(uint64_t));
+        CHECK(std::memcmp(clampedCommand.GetRenderTargets(), renderTargets, kMaxRenderTargets * sizeof(uint64_t)) == 0);
+
+        const auto& barrierCommand = commands[6]->As<RenderCommand::ResourceBarrier>();
+        CHECK(commands[6]->type == RenderCommandType::ResourceBarrier);
+        CHECK(barrierCommand.count == 2 && std::memcmp(barrierCommand.GetBarriers(), barriers, sizeof(barriers)) == 0);
+
+        const auto& transition = commands[7]->As<RenderCommand::ResourceBarrier>();
+        CHECK(transition.count == 1);
+        const RenderBarrier& barrier = transition.GetBarriers()[0];
+        CHECK(barrier.resource == 0xE0 && barrier.subresource == kAllSubresources);
+        CHECK(barrier.before == ResourceState::RenderTarget && barrier.after == ResourceState::Present);
+    }
+
+    void TestAppend()
+    {
+        RenderCommandStream first;
+        RenderCommandStream second;
+        RenderCommandStream empty;
+        const uint32_t value = 42;
+
+        first.SetPipelineState(0x10);
+        first.Draw(3, 1, 0, 0);
+        second.SetGraphicsRoot32BitConstants(0, 1, &value);
+        second.Dispatch(1, 2, 3);
+
+        RenderCommandStream merged;
+        merged.Append(empty);
+        CHECK(merged.IsEmpty() && merged.GetSizeInBytes() == 0);
+
+        merged.Append(first);
+        merged.Append(empty);
+        merged.Append(second);
+        CHECK(merged.GetCommandCount() == first.GetCommandCount() + second.GetCommandCount());
+        CHECK(merged.GetSizeInBytes() == first.GetSizeInBytes() + second.GetSizeInBytes());
+        CheckLayout(merged);
+
+        const std::vector<const RenderCommandHeader*> commands = Collect(merged);
+        if (commands.size() != 4)
+        {
+            CHECK(commands.size() == 4);
+            return;
+        }
+        CHECK(commands[0]->As<RenderCommand::SetPipelineState>().pipelineState == 0x10);
+        CHECK(commands[1]->As<RenderCommand::Draw>().vertexCount == 3);
+        CHECK(commands[2]->As<RenderCommand::SetRootConstants>().GetValues()[0] == value);
+        CHECK(commands[3]->As<RenderCommand::Dispatch>().groupCountZ == 3);
+
+        // 원본은 그대로 남고, 합친 뒤에도 계속 기록 가능
+        CHECK(first.GetCommandCount() == 2 && second.GetCommandCount() == 2);
+        merged.Draw(6, 1, 0, 0);
+        CHECK(merged.GetCommandCount() == 5);
+        CheckLayout(merged);
+
+        // 자기 자신보다 큰 스트림을 합쳐 확장이 일어나도 앞의 명령이 유지됨
+        RenderCommandStream large;
+        for (uint32_t draw = 0; draw < 10000; draw++)
+        {
+            large.Draw(draw, 1, 0, 0);
+        }
+        RenderCommandStream target;
+        target.SetPipelineState(0x20);
+        target.Append(large);
+        CHECK(target.GetCommandCount() == 10001);
+        CheckLayout(target);
+
+        uint32_t expected = 0;
+        bool inOrder = true;
+        for (const RenderCommandHeader& header : target)
+        {
+            if (header.type == RenderCommandType::SetPipelineState)
+            {
+                CHECK(expected == 0 && header.As<RenderCommand::SetPipelineState>().pipelineState == 0x20);
+                continue;
+            }
+            inOrder = inOrder && header.As<RenderCommand::Draw>().vertexCount == expected;
+            expected++;
+        }
+        CHECK(inOrder && expected == 10000);
+    }
+
+    void TestGrow()
+    {
+        // 64KB 초기 크기를 넘어 여러 번 두 배로 확장되도록 기록
+        constexpr uint32_t kDrawCount = 100000;
+
+        RenderCommandStream stream;
+        for (uint32_t draw = 0; draw < kDrawCount; draw++)
+        {
+            stream.SetGraphicsRoot32BitConstants(0, 1, &draw);
+            stream.Draw(3, 1, draw * 3, 0);
+        }
+        CHECK(stream.GetCommandCount() == kDrawCount * 2);
+        CHECK(stream.GetSizeInBytes() > 64 * 1024 * 8);
+        CheckLayout(stream);
+
+        uint32_t index = 0;
+        bool valid = true;
+        for (const RenderCommandHeader& header : stream)
+        {
+            const uint32_t draw = index / 2;
+            if (index % 2 == 0)
+            {
+                valid = valid && header.type == RenderCommandType::SetRootConstants &&
+                        header.As<RenderCommand::SetRootConstants>().GetValues()[0] == draw;
+            }
+            else
+            {
+                valid = valid && header.type == RenderCommandType::Draw &&
+                        header.As<RenderCommand::Draw>().startVertex == draw * 3;
+            }
+            index++;
+        }
+        CHECK(valid && index == kDrawCount * 2);
+
+        // 가변 데이터 하나가 남은 공간보다 큰 경우도 한 번에 확장
+        RenderCommandStream barrierStream;
+        std::vector<RenderBarrier> barriers(20000);
+        for (uint32_t index = 0; index < barriers.size(); index++)
+        {
+            barriers[index] = { index, index, ResourceState::Common, ResourceState::CopyDest };
+        }
+        barrierStream.Draw(1, 1, 0, 0);
+        barrierStream.ResourceBarrier(static_cast<uint32_t>(barriers.size()), barriers.data());
+        CHECK(barrierStream.GetCommandCount() == 2);
+        CheckLayout(barrierStream);
+        const std::vector<const RenderCommandHeader*> commands = Collect(barrierStream);
+        if (commands.size() == 2)
+        {
+            const auto& barrierCommand = commands[1]->As<RenderCommand::ResourceBarrier>();
+            CHECK(barrierCommand.count == barriers.size());
+            CHECK(std::memcmp(barrierCommand.GetBarriers(), barriers.data(), barriers.size() * sizeof(RenderBarrier)) == 0);
+        }
+        else
+        {
+            CHECK(commands.size() == 2);
+        }
+    }
+
+    /**
+     * @brief reserved 필드나 가변 데이터 뒤 패딩이 있는 명령 기록
+     */
+    void RecordPaddedCommands(RenderCommandStream& stream)
+    {
+        const uint32_t constants[3] = { 1, 2, 3 };
+        const RenderHandle heap = 0x10;
+        const RenderBarrier barrier = { 0x20, kAllSubresources, ResourceState::Common, ResourceState::CopyDest };
+
+        stream.SetPrimitiveTopology(PrimitiveTopology::LineList);
+        stream.SetGraphicsRoot32BitConstants(0, 3, constants);
+        stream.SetDescriptorHeaps(1, &heap);
+        stream.ClearDepthStencil(0x30, true, true, 1.0f, 0);
+        stream.ResourceBarrier(1, &barrier);
+        stream.DrawIndexed(6, 1, 0, 0, 0);
+        stream.Dispatch(1, 1, 1);
+    }
+
+    /**
+     * @brief 같은 명령을 기록하면 버퍼 재사용 여부와 관계없이 바이트가 같은지 확인 (해시 / 비교 / 덤프용)
+     */
+    void TestDeterministicBytes()
+    {
+        RenderCommandStream fresh;
+        RecordPaddedCommands(fresh);
+
+        // 이전 프레임에 모든 바이트를 0xFF로 채운 뒤 Reset하고 같은 명령을 기록
+        RenderCommandStream reused;
+        const uint32_t dirty[64] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+                                     0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+        for (uint32_t index = 0; index < 16; index++)
+        {
+            reused.SetGraphicsRoot32BitConstants(0xFFFFFFFF, 12, dirty);
+        }
+        reused.Reset();
+        RecordPaddedCommands(reused);
+
+        CHECK(reused.GetSizeInBytes() == fresh.GetSizeInBytes());
+        if (reused.GetSizeInBytes() == fresh.GetSizeInBytes())
+        {
+            CHECK(std::memcmp(&*reused.begin(), &*fresh.begin(), fresh.GetSizeInBytes()) == 0);
+        }
+    }
+
+    void TestResetAndReserve()
+    {
+        RenderCommandStream stream;
+        stream.Reserve(1024 * 1024);
+        const RenderCommandHeader* base = &*stream.begin();
+
+        for (uint32_t draw = 0; draw < 1000; draw++)
+        {
+            stream.Draw(draw, 1, 0, 0);
+        }
+        // 확보한 범위 안에서는 재할당하지 않음
+        CHECK(&*stream.begin() == base);
+
+        stream.Reset();
+        CHECK(stream.IsEmpty() && stream.GetSizeInBytes() == 0 && stream.begin() == stream.end());
+
+        // Reset 후 메모리를 재사용하고 이전 명령이 남지 않음
+        stream.Dispatch(1, 1, 1);
+        CHECK(&*stream.begin() == base);
+        CHECK(stream.GetCommandCount() == 1);
+        CHECK(stream.begin()->type == RenderCommandType::Dispatch);
+        CheckLayout(stream);
+    }
+}
+
+int main()
+{
+    struct TestCase
+    {
+        const char* name;
+        void (*function)();
+    };
+
+    const TestCase testCases[] =
+    {
+        { "Empty", TestEmpty },
+        { "FixedCommands", TestFixedCommands },
+        { "VariableLengthCommands", TestVariableLengthCommands },
+        { "Append", TestAppend },
+        { "Grow", TestGrow },
+        { "DeterministicBytes", TestDeterministicBytes },
+        { "ResetAndReserve", TestResetAndReserve }
+    };
+
+    for (const TestCase& testCase : testCases)
+    {
+        const int failuresBefore = s_failureCount;
+        testCase.function();
+        std::printf("[%s] %s\n", s_failureCount == failuresBefore ? "PASS" : "FAIL", testCase.name);
+    }
+
+    if (s_failureCount > 0)
+    {
+        std::printf("%d check(s) failed\n", s_failureCount);
+        return 1;
+    }
+
+    std::printf("All tests passed\n");
+    return 0;
+}
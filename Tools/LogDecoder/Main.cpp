@@ -0,0 +1,239 @@
+/**
+ * @file Main.cpp
+ * @brief 바이너리 로그 디코더
+ *
+ * Logger가 기록한 다음 파일을 엔진 텍스트 로그와 같은 UTF-8 텍스트로 변환합니다.
+ * - .blog  : 바이너리 로그 (LogFileFormat::Binary)
+ * - .mlog  : 메모리 맵 텍스트 세그먼트 (헤더 제거, 커밋된 범위만 출력)
+ * - .mblog : 메모리 맵 바이너리 세그먼트
+ *
+ * 사용법:
+ *   LogDecoder.exe <input>                 (표준 출력)
+ *   LogDecoder.exe <input> <output.log>    (파일 출력)
+ */
+
+#include <Utils/BinaryLog.h>
+#include <Utils/MappedLogFile.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace DX12GameEngine;
+
+namespace
+{
+    /**
+     * @brief 파일 전체 읽기
+     */
+    bool ReadFileBytes(const char* path, std::vector<uint8_t>& outBytes)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        const std::streamsize size = file.tellg();
+        file.seekg(0, std::ios::beg);
+
+        outBytes.resize(static_cast<size_t>(size));
+        return size == 0 || file.read(reinterpret_cast<char*>(outBytes.data()), size).good();
+    }
+
+    /**
+     * @brief wchar_t 문자열을 UTF-8로 변환해 output 뒤에 추가 (UTF-16/UTF-32 모두 처리)
+     */
+    void AppendUtf8(std::string& output, std::wstring_view text)
+    {
+        for (size_t i = 0; i < text.size(); i++)
+        {
+            uint32_t codePoint = static_cast<uint32_t>(text[i]);
+
+            // UTF-16 서로게이트 쌍
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF && i + 1 < text.size())
+            {
+                const uint32_t low = static_cast<uint32_t>(text[i + 1]);
+                if (low >= 0xDC00 && low <= 0xDFFF)
+                {
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    i++;
+                }
+            }
+
+            if (codePoint < 0x80)
+            {
+                output += static_cast<char>(codePoint);
+            }
+            else if (codePoint < 0x800)
+            {
+                output += static_cast<char>(0xC0 | (codePoint >> 6));
+                output += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else if (codePoint < 0x10000)
+            {
+                output += static_cast<char>(0xE0 | (codePoint >> 12));
+                output += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                output += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                output += static_cast<char>(0xF0 | (codePoint >> 18));
+                output += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                output += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                output += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+        }
+    }
+
+    /**
+     * @brief 파일 헤더의 틱 단위를 사용해 타임스탬프 문자열 생성
+     *
+     * 포맷: 2026-01-20 22:30:15.123 (로컬 시간, 엔진 텍스트 로그와 동일)
+     */
+    std::string FormatTimestamp(int64_t ticks, const BinaryLogFileHeader& header)
+    {
+        const double seconds = static_cast<double>(ticks) *
+            static_cast<double>(header.clockPeriodNum) / static_cast<double>(header.clockPeriodDen);
+        const int64_t totalMs = static_cast<int64_t>(seconds * 1000.0);
+
+        std::time_t timeT = static_cast<std::time_t>(totalMs / 1000);
+        std::tm localTime = {};
+#ifdef _WIN32
+        localtime_s(&localTime, &timeT);
+#else
+        localtime_r(&timeT, &localTime);
+#endif
+
+        char buffer[32];
+        const size_t length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &localTime);
+        std::snprintf(buffer + length, sizeof(buffer) - length, ".%03d", static_cast<int>(totalMs % 1000));
+        return buffer;
+    }
+
+    /**
+     * @brief 디코딩된 엔트리를 텍스트 한 줄로 추가
+     *
+     * 포맷: [2026-01-20 22:30:15.123][INFO ][Engine  ] Message
+     */
+    void AppendEntry(std::string& output, const DecodedLogEntry& entry, const BinaryLogFileHeader& header)
+    {
+        output += "[";
+        output += FormatTimestamp(entry.timestamp, header);
+        output += "][";
+        AppendUtf8(output, LogLevelToString(entry.level));
+        output += "][";
+        AppendUtf8(output, LogCategoryToString(entry.category));
+        output += "] ";
+        AppendUtf8(output, entry.message);
+        output += "\n";
+    }
+
+    /**
+     * @brief 바이너리 로그 디코딩
+     * @return 유효한 바이너리 로그면 true
+     */
+    bool DecodeBinaryLog(const uint8_t* data, size_t size, std::string& output, uint64_t& entryCount)
+    {
+        BinaryLogReader reader;
+        if (!reader.Open(data, size))
+        {
+            return false;
+        }
+
+        DecodedLogEntry entry;
+        while (reader.Next(entry))
+        {
+            AppendEntry(output, entry, reader.GetHeader());
+            entryCount++;
+        }
+        return true;
+    }
+}
+
+/**
+ * @brief 로그 디코더 진입점
+ */
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cout << "사용법:\n";
+        std::cout << "  LogDecoder.exe <input.blog|input.mlog|input.mblog> [output.log]\n";
+        return 0;
+    }
+
+    std::vector<uint8_t> bytes;
+    if (!ReadFileBytes(argv[1], bytes))
+    {
+        std::cerr << "입력 파일을 열 수 없습니다: " << argv[1] << "\n";
+        return 1;
+    }
+
+    std::string output;
+    uint64_t entryCount = 0;
+    bool valid = false;
+
+    MappedLogSegmentHeader segmentHeader = {};
+    if (bytes.size() >= sizeof(segmentHeader))
+    {
+        std::memcpy(&segmentHeader, bytes.data(), sizeof(segmentHeader));
+    }
+
+    if (std::memcmp(segmentHeader.magic, kMappedLogMagic, sizeof(kMappedLogMagic)) == 0 &&
+        segmentHeader.version == kMappedLogVersion && segmentHeader.headerSize <= bytes.size())
+    {
+        // 메모리 맵 세그먼트: 커밋된 범위까지만 유효 (크래시 시 뒤쪽은 0으로 채워진 미사용 영역)
+        const uint8_t* payload = bytes.data() + segmentHeader.headerSize;
+        const size_t payloadSize = static_cast<size_t>(std::min<uint64_t>(segmentHeader.committedSize,
+                                                                          bytes.size() - segmentHeader.headerSize));
+
+        if (!segmentHeader.closedCleanly)
+        {
+            std::cerr << "정상 종료되지 않은 세그먼트입니다. 커밋된 " << payloadSize << " 바이트까지 변환합니다.\n";
+        }
+
+        if (segmentHeader.content == MappedLogContent::Binary)
+        {
+            valid = DecodeBinaryLog(payload, payloadSize, output, entryCount);
+        }
+        else
+        {
+            output.assign(reinterpret_cast<const char*>(payload), payloadSize);
+            valid = true;
+        }
+    }
+    else
+    {
+        valid = DecodeBinaryLog(bytes.data(), bytes.size(), output, entryCount);
+    }
+
+    if (!valid)
+    {
+        std::cerr << "로그 파일이 아니거나 지원하지 않는 버전입니다: " << argv[1] << "\n";
+        return 1;
+    }
+
+    if (argc >= 3)
+    {
+        std::ofstream outputFile(argv[2], std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!outputFile.is_open())
+        {
+            std::cerr << "출력 파일을 열 수 없습니다: " << argv[2] << "\n";
+            return 1;
+        }
+        outputFile.write(output.data(), static_cast<std::streamsize>(output.size()));
+    }
+    else
+    {
+        std::fwrite(output.data(), 1, output.size(), stdout);
+    }
+
+    std::cerr << entryCount << " entries decoded\n";
+    return 0;
+}